@@ -0,0 +1,63 @@
+-- Copyright 2020 Dhiraj Wishal
+-- SPDX-License-Identifier: Apache-2.0
+
+---------- Benchmarks project description ----------
+
+project "Benchmarks"
+	kind "ConsoleApp"
+	language "C++"
+	systemversion "latest"
+	cppdialect "C++20"
+	staticruntime "On"
+
+	targetdir "$(SolutionDir)Builds/Benchmarks/Binaries/$(Configuration)-$(Platform)"
+	objdir "$(SolutionDir)Builds/Benchmarks/Intermediate/$(Configuration)-$(Platform)/$(ProjectName)"
+
+	debugdir "$(SolutionDir)"
+
+	files {
+		"**.txt",
+		"**.cpp",
+		"**.h",
+		"**.lua",
+		"**.md",
+	}
+
+	includedirs {
+		"$(SolutionDir)Framework/",
+		"$(SolutionDir)Benchmarks/",
+		"$(SolutionDir)Dependencies/ThirdParty/SPIRV-Cross",
+		"%{IncludeDir.xxhash}",
+	}
+
+	libdirs {
+		"%{IncludeLib.xxhash}",
+	}
+
+	links {
+		"Core",
+		"Thread",
+		"GraphicsCore",
+		"NullBackend",
+		"ShaderTools",
+		"AssetLoader",
+	}
+
+	filter "configurations:Debug"
+		libdirs {
+			"%{IncludeLib.FreeImageD}",
+		}
+
+	filter "configurations:Release"
+		libdirs {
+			"%{IncludeLib.FreeImageR}",
+		}
+
+	filter "system:linux"
+		links {
+			"pthread",
+			"dl",
+			"tbb",	-- libstdc++ runs the std::execution policies on TBB.
+		}
+
+	filter ""
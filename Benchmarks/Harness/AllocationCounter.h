@@ -0,0 +1,21 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Core/Types/DataTypes.h"
+
+namespace DMK
+{
+	namespace Benchmarks
+	{
+		/**
+		 * Get the number of allocations the calling thread made using operator new.
+		 * The benchmark executable replaces the global operator new to count them. The count is per thread, so
+		 * counting costs no synchronization and the allocations of other threads are not included.
+		 *
+		 * @return The allocation count.
+		 */
+		UI64 GetThreadAllocationCount();
+	}
+}
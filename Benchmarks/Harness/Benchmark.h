@@ -0,0 +1,249 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Core/Types/DataTypes.h"
+#include "Core/Macros/Global.h"
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+
+#endif
+
+namespace DMK
+{
+	namespace Benchmarks
+	{
+		/**
+		 * Prevent the compiler from optimizing a value (and the code which computed it) away.
+		 *
+		 * @param value: The value.
+		 */
+		template<class Type>
+		DMK_FORCEINLINE void DoNotOptimize(const Type& value)
+		{
+#ifdef _MSC_VER
+			static volatile const void* pSink = nullptr;
+			pSink = &value;
+			_ReadWriteBarrier();
+
+#else
+			asm volatile("" : : "r,m"(value) : "memory");
+
+#endif
+		}
+
+		/**
+		 * Force the compiler to assume that all memory was read and written.
+		 */
+		DMK_FORCEINLINE void ClobberMemory()
+		{
+#ifdef _MSC_VER
+			_ReadWriteBarrier();
+
+#else
+			asm volatile("" : : : "memory");
+
+#endif
+		}
+
+		/**
+		 * Benchmark Counter structure.
+		 * A custom value reported by a benchmark (a percentile, a test statistic, etc).
+		 */
+		struct BenchmarkCounter {
+			String mName;	// Counter name.
+			double mValue = 0.0;	// Counter value.
+		};
+
+		/**
+		 * Benchmark Settings structure.
+		 * The runner settings which the benchmarks can see.
+		 */
+		struct BenchmarkSettings {
+			std::chrono::nanoseconds mWarmupTime = std::chrono::milliseconds(100);	// Time to run before measuring.
+			std::chrono::nanoseconds mRepetitionTime = std::chrono::milliseconds(50);	// Minimum time of one repetition.
+			UI64 mRepetitionCount = 10;	// Number of measured repetitions.
+			std::vector<I32> mCPUs;	// CPUs to pin to. The main thread uses the first. Empty to not pin.
+			String mAssetDirectory = "Assets";	// The asset directory.
+		};
+
+		/**
+		 * Benchmark State object.
+		 * This is passed to every benchmark. The benchmark prepares its data and then calls Run() or Measure()
+		 * exactly once with the code to be measured. Everything outside of those calls is not measured.
+		 */
+		class BenchmarkState {
+		public:
+			/**
+			 * Measure the code which is executed by calling a batch function.
+			 * The batch function executes the code the given number of times and returns the elapsed time. Use this
+			 * when the code has to time itself (for example when it runs on other threads).
+			 *
+			 * @param batch: The batch function. It receives the iteration count and returns the elapsed nanoseconds.
+			 */
+			void Measure(const std::function<double(UI64)>& batch);
+
+			/**
+			 * Measure a function. One iteration is one call.
+			 *
+			 * @param function: The function to measure.
+			 */
+			template<class Function>
+			void Run(Function&& function)
+			{
+				Measure([&function](UI64 iterations) -> double
+					{
+						const auto beginTime = std::chrono::steady_clock::now();
+						for (UI64 index = 0; index < iterations; index++)
+							function();
+
+						return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - beginTime).count());
+					});
+			}
+
+			/**
+			 * Set the number of bytes one iteration processes, to report the throughput.
+			 *
+			 * @param bytes: The number of bytes.
+			 */
+			void SetBytesPerIteration(UI64 bytes) { mBytesPerIteration = bytes; }
+
+			/**
+			 * Set the number of items one iteration processes, to report the throughput.
+			 *
+			 * @param items: The number of items.
+			 */
+			void SetItemsPerIteration(UI64 items) { mItemsPerIteration = items; }
+
+			/**
+			 * Use a fixed number of iterations per repetition instead of calibrating it. This is meant for slow
+			 * benchmarks.
+			 *
+			 * @param iterations: The number of iterations.
+			 */
+			void SetIterations(UI64 iterations) { mFixedIterations = iterations; }
+
+			/**
+			 * Report a custom value.
+			 *
+			 * @param pName: The counter name.
+			 * @param value: The value.
+			 */
+			void SetCounter(const char* pName, double value);
+
+			/**
+			 * Skip the benchmark, for example when an asset or a hardware feature is not available.
+			 *
+			 * @param pReason: The reason.
+			 */
+			void Skip(const char* pReason) { mSkipReason = pReason; }
+
+			/**
+			 * Get the path of an asset.
+			 *
+			 * @param pAsset: The path relative to the asset directory.
+			 * @return The path string.
+			 */
+			String GetAssetPath(const char* pAsset) const;
+
+			/**
+			 * Pin the calling worker thread to one of the selected CPUs.
+			 * Worker 0 uses the second selected CPU, worker 1 the third and so on, wrapping around. Nothing happens
+			 * if no CPUs were selected.
+			 *
+			 * @param workerIndex: The index of the worker thread.
+			 */
+			void PinWorkerThread(UI64 workerIndex) const;
+
+		public:
+			/**
+			 * Construct the state.
+			 *
+			 * @param settings: The runner settings.
+			 */
+			BenchmarkState(const BenchmarkSettings& settings) : mSettings(settings) {}
+
+			const BenchmarkSettings& mSettings;	// Runner settings.
+			std::vector<double> mSamples;	// Nanoseconds per iteration of every repetition.
+			std::vector<BenchmarkCounter> mCounters;	// Custom values.
+			String mSkipReason;	// Why the benchmark was skipped. Empty if it ran.
+			UI64 mIterations = 0;	// Iterations per repetition.
+			UI64 mFixedIterations = 0;	// Fixed iterations per repetition. 0 to calibrate.
+			UI64 mBytesPerIteration = 0;	// Bytes processed per iteration.
+			UI64 mItemsPerIteration = 0;	// Items processed per iteration.
+			bool bHasMeasured = false;	// Whether Run() or Measure() was called.
+		};
+
+		/**
+		 * Console Silencer object.
+		 * This redirects the standard output to the null device while it exists, for benchmarks of code which
+		 * writes to the console (like the logger).
+		 */
+		class ConsoleSilencer {
+		public:
+			ConsoleSilencer();
+			~ConsoleSilencer();
+
+			ConsoleSilencer(const ConsoleSilencer&) = delete;
+			ConsoleSilencer& operator=(const ConsoleSilencer&) = delete;
+
+		private:
+			I32 mSavedOutput = -1;	// Duplicate of the original standard output descriptor.
+		};
+
+		using BenchmarkFunction = void(*)(BenchmarkState&);
+
+		/**
+		 * Benchmark Entry structure.
+		 */
+		struct BenchmarkEntry {
+			String mName;	// The benchmark name ("Module/Group/Name").
+			std::function<void(BenchmarkState&)> mFunction;	// The benchmark function.
+		};
+
+		/**
+		 * Register a benchmark.
+		 * This is usually done using DMK_BENCHMARK. Call this from a static initializer to register generated
+		 * benchmarks, like one benchmark per thread count.
+		 *
+		 * @param name: The benchmark name.
+		 * @param function: The benchmark function.
+		 */
+		void RegisterBenchmark(const String& name, std::function<void(BenchmarkState&)> function);
+
+		/**
+		 * Get all the registered benchmarks.
+		 *
+		 * @return The benchmark entries.
+		 */
+		std::vector<BenchmarkEntry>& GetBenchmarks();
+
+		/**
+		 * Benchmark Registrar structure.
+		 * Registers a benchmark when a static instance is constructed.
+		 */
+		struct BenchmarkRegistrar {
+			BenchmarkRegistrar(const char* pName, BenchmarkFunction function) { RegisterBenchmark(pName, function); }
+			BenchmarkRegistrar(const char* pName, std::function<void(BenchmarkState&)> function) { RegisterBenchmark(pName, std::move(function)); }
+		};
+	}
+}
+
+#define DMK_BENCHMARK_CONCAT_IMPL(a, b)	a##b
+#define DMK_BENCHMARK_CONCAT(a, b)		DMK_BENCHMARK_CONCAT_IMPL(a, b)
+
+/**
+ * Define and register a benchmark.
+ * Usage: DMK_BENCHMARK("Core/Hash/GetHash_4KiB") { ...; state.Run([&] { ... }); }
+ */
+#define DMK_BENCHMARK(name)																												\
+	static void DMK_BENCHMARK_CONCAT(_Benchmark, __LINE__)(::DMK::Benchmarks::BenchmarkState& state);										\
+	static ::DMK::Benchmarks::BenchmarkRegistrar DMK_BENCHMARK_CONCAT(_benchmarkRegistrar, __LINE__)(name, DMK_BENCHMARK_CONCAT(_Benchmark, __LINE__));	\
+	static void DMK_BENCHMARK_CONCAT(_Benchmark, __LINE__)(::DMK::Benchmarks::BenchmarkState& state)
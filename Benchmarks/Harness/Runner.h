@@ -0,0 +1,135 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Harness/Benchmark.h"
+
+namespace DMK
+{
+	namespace Benchmarks
+	{
+		/**
+		 * Benchmark Result structure.
+		 * The times are in nanoseconds per iteration, over all the repetitions.
+		 */
+		struct BenchmarkResult {
+			String mName;	// The benchmark name.
+			String mSkipReason;	// Why the benchmark was skipped. Empty if it ran.
+			std::vector<BenchmarkCounter> mCounters;	// Custom values.
+			UI64 mIterations = 0;	// Iterations per repetition.
+			UI64 mRepetitions = 0;	// Number of repetitions.
+			double mMean = 0.0;	// Mean time.
+			double mMedian = 0.0;	// Median time.
+			double mStandardDeviation = 0.0;	// Sample standard deviation of the time.
+			double mMin = 0.0;	// Fastest repetition.
+			double mMax = 0.0;	// Slowest repetition.
+			double mBytesPerSecond = 0.0;	// Throughput in bytes, based on the median. 0 if not reported.
+			double mItemsPerSecond = 0.0;	// Throughput in items, based on the median. 0 if not reported.
+
+			/**
+			 * Get the coefficient of variation (standard deviation / mean).
+			 */
+			double GetVariation() const { return mMean > 0.0 ? mStandardDeviation / mMean : 0.0; }
+		};
+
+		/**
+		 * Baseline Entry structure.
+		 */
+		struct BaselineEntry {
+			String mName;	// The benchmark name.
+			double mMedian = 0.0;	// Median time in nanoseconds.
+			double mStandardDeviation = 0.0;	// Standard deviation in nanoseconds.
+		};
+
+		/**
+		 * Runner Options structure.
+		 */
+		struct RunnerOptions {
+			BenchmarkSettings mSettings;	// Settings passed to the benchmarks.
+			String mFilter;	// Only benchmarks which contain this string are run. Empty to run all.
+			String mOutputPath;	// JSON output file. Empty to not write one.
+			String mBaselinePath;	// JSON file of a previous run to compare to. Empty to not compare.
+			double mRegressionThreshold = 5.0;	// Slowdown in percent which counts as a regression.
+			bool bListOnly = false;	// Only list the benchmark names.
+			bool bShowHelp = false;	// Only print the usage.
+		};
+
+		/**
+		 * Parse the command line arguments.
+		 * Prints the usage and returns false if the arguments are invalid. --help prints the usage, sets
+		 * RunnerOptions::bShowHelp and returns true.
+		 *
+		 * @param argc: The argument count.
+		 * @param argv: The arguments.
+		 * @param options: The options to fill.
+		 * @return Boolean value.
+		 */
+		bool ParseArguments(int argc, char** argv, RunnerOptions& options);
+
+		constexpr I32 MaxPinnableCPUCount = 64;	// CPUs a thread can be pinned to, as Windows affinity masks have 64 bits.
+
+		/**
+		 * Pin the calling thread to a CPU.
+		 *
+		 * @param cpu: The CPU index. Must be less than MaxPinnableCPUCount.
+		 * @return False if the thread could not be pinned.
+		 */
+		bool PinCurrentThread(I32 cpu);
+
+		/**
+		 * Run one benchmark: warm up, calibrate the iteration count and measure the repetitions.
+		 *
+		 * @param entry: The benchmark.
+		 * @param settings: The settings.
+		 * @return The result.
+		 */
+		BenchmarkResult RunBenchmark(const BenchmarkEntry& entry, const BenchmarkSettings& settings);
+
+		/**
+		 * Compute the statistics of a result from its samples.
+		 *
+		 * @param samples: Nanoseconds per iteration of every repetition.
+		 * @param result: The result to fill.
+		 */
+		void ComputeStatistics(std::vector<double> samples, BenchmarkResult& result);
+
+		/**
+		 * Print a result to the console.
+		 *
+		 * @param result: The result.
+		 */
+		void PrintResult(const BenchmarkResult& result);
+
+		/**
+		 * Write the results as JSON. Every benchmark is written on its own line.
+		 *
+		 * @param pFilePath: The output file path.
+		 * @param results: The results.
+		 * @param settings: The settings the results were measured with.
+		 * @return False if the file could not be written.
+		 */
+		bool WriteJSON(const char* pFilePath, const std::vector<BenchmarkResult>& results, const BenchmarkSettings& settings);
+
+		/**
+		 * Load a JSON file written by WriteJSON as a baseline.
+		 *
+		 * @param pFilePath: The file path.
+		 * @param baseline: The entries to fill.
+		 * @return False if the file could not be read.
+		 */
+		bool LoadBaseline(const char* pFilePath, std::vector<BaselineEntry>& baseline);
+
+		/**
+		 * Compare results to a baseline and print the differences.
+		 * A benchmark regressed if its median is slower than the baseline by more than the threshold and by more
+		 * than the combined standard deviations, so that noisy benchmarks do not fail the run.
+		 *
+		 * @param results: The results.
+		 * @param baseline: The baseline.
+		 * @param threshold: The slowdown in percent which counts as a regression.
+		 * @return The number of regressed benchmarks.
+		 */
+		UI64 CompareToBaseline(const std::vector<BenchmarkResult>& results, const std::vector<BaselineEntry>& baseline, double threshold);
+	}
+}
@@ -0,0 +1,48 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Harness/AllocationCounter.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace DMK
+{
+	namespace Benchmarks
+	{
+		namespace _Helpers
+		{
+			thread_local UI64 ThreadAllocationCount = 0;	// Allocations made by the thread.
+		}
+
+		UI64 GetThreadAllocationCount()
+		{
+			return _Helpers::ThreadAllocationCount;
+		}
+	}
+}
+
+/*
+ * The array and nothrow forms call these, and the aligned forms are left to the runtime as they use their own
+ * allocation functions.
+ */
+
+void* operator new(std::size_t size)
+{
+	DMK::Benchmarks::_Helpers::ThreadAllocationCount++;
+
+	if (void* pMemory = std::malloc(size ? size : 1))
+		return pMemory;
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void* pMemory) noexcept
+{
+	std::free(pMemory);
+}
+
+void operator delete(void* pMemory, std::size_t) noexcept
+{
+	std::free(pMemory);
+}
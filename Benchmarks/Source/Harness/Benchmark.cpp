@@ -0,0 +1,140 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Harness/Benchmark.h"
+#include "Harness/Runner.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fcntl.h>
+
+#ifdef _WIN32
+#include <io.h>
+
+#else
+#include <unistd.h>
+
+#endif
+
+namespace DMK
+{
+	namespace Benchmarks
+	{
+		void BenchmarkState::Measure(const std::function<double(UI64)>& batch)
+		{
+			bHasMeasured = true;
+
+			const double warmupTime = static_cast<double>(mSettings.mWarmupTime.count());
+			const double repetitionTime = static_cast<double>(mSettings.mRepetitionTime.count());
+
+			// Warm up, and grow the iteration count until one batch takes the repetition time.
+			UI64 iterations = mFixedIterations ? mFixedIterations : 1;
+			double elapsed = 0.0;
+			double warmedUp = 0.0;
+
+			do
+			{
+				elapsed = batch(iterations);
+				warmedUp += elapsed;
+
+				if (!mFixedIterations && elapsed < repetitionTime)
+				{
+					const double scale = elapsed > 0.0 ? std::min(repetitionTime / elapsed * 1.1, 10.0) : 10.0;
+					iterations = std::max(iterations + 1, static_cast<UI64>(static_cast<double>(iterations) * scale));
+				}
+			} while (warmedUp < warmupTime || (!mFixedIterations && elapsed < repetitionTime));
+
+			mIterations = iterations;
+			mSamples.clear();
+			mSamples.reserve(mSettings.mRepetitionCount);
+
+			for (UI64 repetition = 0; repetition < mSettings.mRepetitionCount; repetition++)
+				mSamples.push_back(batch(iterations) / static_cast<double>(iterations));
+		}
+
+		void BenchmarkState::SetCounter(const char* pName, double value)
+		{
+			for (auto& counter : mCounters)
+			{
+				if (counter.mName == pName)
+				{
+					counter.mValue = value;
+					return;
+				}
+			}
+
+			mCounters.push_back({ pName, value });
+		}
+
+		String BenchmarkState::GetAssetPath(const char* pAsset) const
+		{
+			if (mSettings.mAssetDirectory.empty())
+				return pAsset;
+
+			return mSettings.mAssetDirectory + "/" + pAsset;
+		}
+
+		void BenchmarkState::PinWorkerThread(UI64 workerIndex) const
+		{
+			if (mSettings.mCPUs.empty())
+				return;
+
+			PinCurrentThread(mSettings.mCPUs[(workerIndex + 1) % mSettings.mCPUs.size()]);
+		}
+
+		ConsoleSilencer::ConsoleSilencer()
+		{
+			fflush(stdout);
+
+#ifdef _WIN32
+			mSavedOutput = _dup(_fileno(stdout));
+			const I32 nullDevice = _open("NUL", _O_WRONLY);
+			if (nullDevice >= 0)
+			{
+				_dup2(nullDevice, _fileno(stdout));
+				_close(nullDevice);
+			}
+
+#else
+			mSavedOutput = dup(fileno(stdout));
+			const I32 nullDevice = open("/dev/null", O_WRONLY);
+			if (nullDevice >= 0)
+			{
+				dup2(nullDevice, fileno(stdout));
+				close(nullDevice);
+			}
+
+#endif
+		}
+
+		ConsoleSilencer::~ConsoleSilencer()
+		{
+			fflush(stdout);
+
+			if (mSavedOutput < 0)
+				return;
+
+#ifdef _WIN32
+			_dup2(mSavedOutput, _fileno(stdout));
+			_close(mSavedOutput);
+
+#else
+			dup2(mSavedOutput, fileno(stdout));
+			close(mSavedOutput);
+
+#endif
+		}
+
+		void RegisterBenchmark(const String& name, std::function<void(BenchmarkState&)> function)
+		{
+			GetBenchmarks().push_back({ name, std::move(function) });
+		}
+
+		std::vector<BenchmarkEntry>& GetBenchmarks()
+		{
+			// Constructed on first use, so that the static registrars of every file can use it.
+			static std::vector<BenchmarkEntry> mBenchmarks;
+			return mBenchmarks;
+		}
+	}
+}
@@ -0,0 +1,445 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Harness/Runner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <thread>
+
+#ifdef _WIN32
+#include <Windows.h>
+
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+
+#endif
+
+namespace DMK
+{
+	namespace Benchmarks
+	{
+		namespace _Helpers
+		{
+			/**
+			 * Get the value of an argument of the form --name=value.
+			 *
+			 * @param pArgument: The argument.
+			 * @param pName: The argument name, including the dashes and the equal sign.
+			 * @return The value. nullptr if the argument has a different name.
+			 */
+			const char* GetArgumentValue(const char* pArgument, const char* pName)
+			{
+				const UI64 length = strlen(pName);
+				return strncmp(pArgument, pName, length) == 0 ? pArgument + length : nullptr;
+			}
+
+			/**
+			 * Print the command line usage.
+			 */
+			void PrintUsage(const char* pProgram)
+			{
+				printf("Usage: %s [options]\n", pProgram);
+				printf("  --help                 Print this message and exit.\n");
+				printf("  --filter=<text>        Only run the benchmarks whose name contains the text.\n");
+				printf("  --list                 List the benchmarks and exit.\n");
+				printf("  --warmup=<ms>          Warmup time per benchmark. Default is 100.\n");
+				printf("  --min-time=<ms>        Minimum time per repetition. Default is 50.\n");
+				printf("  --repetitions=<count>  Number of measured repetitions. Default is 10.\n");
+				printf("  --cpus=<a,b,...>       Pin the main thread to the first CPU and worker threads to the rest. CPUs are below %d.\n", MaxPinnableCPUCount);
+				printf("  --assets=<directory>   The asset directory. Default is Assets.\n");
+				printf("  --json=<file>          Write the results as JSON.\n");
+				printf("  --baseline=<file>      Compare the results to a JSON file of a previous run.\n");
+				printf("  --threshold=<percent>  Slowdown which counts as a regression. Default is 5.\n");
+			}
+
+			/**
+			 * Format a time in nanoseconds using a readable unit.
+			 */
+			String FormatTime(double nanoseconds)
+			{
+				char buffer[32] = {};
+				if (nanoseconds < 1e3)
+					snprintf(buffer, sizeof(buffer), "%.2f ns", nanoseconds);
+				else if (nanoseconds < 1e6)
+					snprintf(buffer, sizeof(buffer), "%.2f us", nanoseconds / 1e3);
+				else if (nanoseconds < 1e9)
+					snprintf(buffer, sizeof(buffer), "%.2f ms", nanoseconds / 1e6);
+				else
+					snprintf(buffer, sizeof(buffer), "%.2f s", nanoseconds / 1e9);
+
+				return buffer;
+			}
+
+			/**
+			 * Format a rate using a readable unit.
+			 */
+			String FormatRate(double rate, const char* pUnit)
+			{
+				const char* PREFIXES[] = { "", "K", "M", "G", "T" };
+
+				UI64 prefix = 0;
+				while (rate >= 1000.0 && prefix < 4)
+				{
+					rate /= 1000.0;
+					prefix++;
+				}
+
+				char buffer[32] = {};
+				snprintf(buffer, sizeof(buffer), "%.2f %s%s/s", rate, PREFIXES[prefix], pUnit);
+				return buffer;
+			}
+
+			/**
+			 * Write a string as a JSON string.
+			 */
+			void WriteJSONString(FILE* pFile, const String& string)
+			{
+				fputc('"', pFile);
+				for (const char character : string)
+				{
+					if (character == '"' || character == '\\')
+						fputc('\\', pFile);
+
+					fputc(character, pFile);
+				}
+				fputc('"', pFile);
+			}
+
+			/**
+			 * Read a number which follows a key in a JSON line.
+			 *
+			 * @param line: The line.
+			 * @param pKey: The key, including the quotes and the colon.
+			 * @param value: The variable to store the value in.
+			 * @return False if the key is not in the line.
+			 */
+			bool ReadJSONNumber(const String& line, const char* pKey, double& value)
+			{
+				const UI64 position = line.find(pKey);
+				if (position == String::npos)
+					return false;
+
+				value = strtod(line.c_str() + position + strlen(pKey), nullptr);
+				return true;
+			}
+
+			/**
+			 * Get the name of the build configuration.
+			 */
+			const char* GetConfigurationName()
+			{
+#if defined(DMK_DEBUG)
+				return "Debug";
+
+#elif defined(DMK_RELEASE)
+				return "Release";
+
+#elif defined(DMK_DISTRIBUTION)
+				return "Distribution";
+
+#else
+				return "Unknown";
+
+#endif
+			}
+		}
+
+		bool ParseArguments(int argc, char** argv, RunnerOptions& options)
+		{
+			for (I32 index = 1; index < argc; index++)
+			{
+				const char* pArgument = argv[index];
+				const char* pValue = nullptr;
+
+				if (strcmp(pArgument, "--help") == 0)
+				{
+					_Helpers::PrintUsage(argv[0]);
+					options.bShowHelp = true;
+					return true;
+				}
+				else if ((pValue = _Helpers::GetArgumentValue(pArgument, "--filter=")))
+					options.mFilter = pValue;
+				else if (strcmp(pArgument, "--list") == 0)
+					options.bListOnly = true;
+				else if ((pValue = _Helpers::GetArgumentValue(pArgument, "--warmup=")))
+					options.mSettings.mWarmupTime = std::chrono::milliseconds(strtoull(pValue, nullptr, 10));
+				else if ((pValue = _Helpers::GetArgumentValue(pArgument, "--min-time=")))
+					options.mSettings.mRepetitionTime = std::chrono::milliseconds(std::max(1ULL, strtoull(pValue, nullptr, 10)));
+				else if ((pValue = _Helpers::GetArgumentValue(pArgument, "--repetitions=")))
+					options.mSettings.mRepetitionCount = std::max(1ULL, strtoull(pValue, nullptr, 10));
+				else if ((pValue = _Helpers::GetArgumentValue(pArgument, "--assets=")))
+					options.mSettings.mAssetDirectory = pValue;
+				else if ((pValue = _Helpers::GetArgumentValue(pArgument, "--json=")))
+					options.mOutputPath = pValue;
+				else if ((pValue = _Helpers::GetArgumentValue(pArgument, "--baseline=")))
+					options.mBaselinePath = pValue;
+				else if ((pValue = _Helpers::GetArgumentValue(pArgument, "--threshold=")))
+					options.mRegressionThreshold = strtod(pValue, nullptr);
+				else if ((pValue = _Helpers::GetArgumentValue(pArgument, "--cpus=")))
+				{
+					options.mSettings.mCPUs.clear();
+					while (*pValue)
+					{
+						char* pEnd = nullptr;
+						const long cpu = strtol(pValue, &pEnd, 10);
+						if (pEnd == pValue || cpu < 0 || cpu >= MaxPinnableCPUCount)
+						{
+							_Helpers::PrintUsage(argv[0]);
+							return false;
+						}
+
+						options.mSettings.mCPUs.push_back(static_cast<I32>(cpu));
+						pValue = *pEnd == ',' ? pEnd + 1 : pEnd;
+					}
+				}
+				else
+				{
+					_Helpers::PrintUsage(argv[0]);
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		bool PinCurrentThread(I32 cpu)
+		{
+			if (cpu < 0 || cpu >= MaxPinnableCPUCount)
+				return false;
+
+#ifdef _WIN32
+			return SetThreadAffinityMask(GetCurrentThread(), 1ULL << cpu) != 0;
+
+#elif defined(__linux__)
+			cpu_set_t set;
+			CPU_ZERO(&set);
+			CPU_SET(cpu, &set);
+
+			return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+
+#else
+			return false;
+
+#endif
+		}
+
+		BenchmarkResult RunBenchmark(const BenchmarkEntry& entry, const BenchmarkSettings& settings)
+		{
+			BenchmarkState state(settings);
+			entry.mFunction(state);
+
+			BenchmarkResult result;
+			result.mName = entry.mName;
+			result.mCounters = state.mCounters;
+
+			if (!state.mSkipReason.empty() || !state.bHasMeasured || state.mSamples.empty())
+			{
+				result.mSkipReason = state.mSkipReason.empty() ? "Nothing was measured" : state.mSkipReason;
+				return result;
+			}
+
+			result.mIterations = state.mIterations;
+			ComputeStatistics(state.mSamples, result);
+
+			if (result.mMedian > 0.0)
+			{
+				result.mBytesPerSecond = static_cast<double>(state.mBytesPerIteration) * 1e9 / result.mMedian;
+				result.mItemsPerSecond = static_cast<double>(state.mItemsPerIteration) * 1e9 / result.mMedian;
+			}
+
+			return result;
+		}
+
+		void ComputeStatistics(std::vector<double> samples, BenchmarkResult& result)
+		{
+			result.mRepetitions = samples.size();
+			if (samples.empty())
+				return;
+
+			std::sort(samples.begin(), samples.end());
+
+			const UI64 count = samples.size();
+			result.mMin = samples.front();
+			result.mMax = samples.back();
+			result.mMedian = count % 2 ? samples[count / 2] : (samples[count / 2 - 1] + samples[count / 2]) / 2.0;
+
+			double sum = 0.0;
+			for (const double sample : samples)
+				sum += sample;
+
+			result.mMean = sum / static_cast<double>(count);
+
+			double squaredDifferences = 0.0;
+			for (const double sample : samples)
+				squaredDifferences += (sample - result.mMean) * (sample - result.mMean);
+
+			result.mStandardDeviation = count > 1 ? std::sqrt(squaredDifferences / static_cast<double>(count - 1)) : 0.0;
+		}
+
+		void PrintResult(const BenchmarkResult& result)
+		{
+			if (!result.mSkipReason.empty())
+			{
+				printf("%-56s skipped: %s\n", result.mName.c_str(), result.mSkipReason.c_str());
+				return;
+			}
+
+			printf("%-56s %12s %12s %7.2f%% %12s %12s %12llu",
+				result.mName.c_str(),
+				_Helpers::FormatTime(result.mMedian).c_str(),
+				_Helpers::FormatTime(result.mMean).c_str(),
+				result.GetVariation() * 100.0,
+				_Helpers::FormatTime(result.mMin).c_str(),
+				_Helpers::FormatTime(result.mMax).c_str(),
+				result.mIterations);
+
+			if (result.mBytesPerSecond > 0.0)
+				printf("  %s", _Helpers::FormatRate(result.mBytesPerSecond, "B").c_str());
+
+			if (result.mItemsPerSecond > 0.0)
+				printf("  %s", _Helpers::FormatRate(result.mItemsPerSecond, "items").c_str());
+
+			for (const auto& counter : result.mCounters)
+				printf("  %s=%g", counter.mName.c_str(), counter.mValue);
+
+			printf("\n");
+			fflush(stdout);
+		}
+
+		bool WriteJSON(const char* pFilePath, const std::vector<BenchmarkResult>& results, const BenchmarkSettings& settings)
+		{
+			FILE* pFile = fopen(pFilePath, "w");
+			if (!pFile)
+				return false;
+
+			char date[32] = {};
+			const time_t now = time(nullptr);
+			strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+
+			fprintf(pFile, "{\n\"context\":{\"date\":\"%s\",\"configuration\":\"%s\",\"hardware_threads\":%u,\"warmup_ms\":%lld,\"repetition_ms\":%lld,\"repetitions\":%llu,\"cpus\":[",
+				date, _Helpers::GetConfigurationName(), std::thread::hardware_concurrency(),
+				static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(settings.mWarmupTime).count()),
+				static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(settings.mRepetitionTime).count()),
+				settings.mRepetitionCount);
+
+			for (UI64 index = 0; index < settings.mCPUs.size(); index++)
+				fprintf(pFile, index ? ",%d" : "%d", settings.mCPUs[index]);
+
+			fprintf(pFile, "]},\n\"benchmarks\":[");
+
+			for (UI64 index = 0; index < results.size(); index++)
+			{
+				const auto& result = results[index];
+
+				fprintf(pFile, index ? ",\n{\"name\":" : "\n{\"name\":");
+				_Helpers::WriteJSONString(pFile, result.mName);
+
+				if (!result.mSkipReason.empty())
+				{
+					fprintf(pFile, ",\"skipped\":");
+					_Helpers::WriteJSONString(pFile, result.mSkipReason);
+					fprintf(pFile, "}");
+					continue;
+				}
+
+				fprintf(pFile, ",\"iterations\":%llu,\"repetitions\":%llu,\"median_ns\":%.4f,\"mean_ns\":%.4f,\"stddev_ns\":%.4f,\"min_ns\":%.4f,\"max_ns\":%.4f,\"cv\":%.6f,\"bytes_per_second\":%.1f,\"items_per_second\":%.1f,\"counters\":{",
+					result.mIterations, result.mRepetitions, result.mMedian, result.mMean, result.mStandardDeviation,
+					result.mMin, result.mMax, result.GetVariation(), result.mBytesPerSecond, result.mItemsPerSecond);
+
+				for (UI64 counter = 0; counter < result.mCounters.size(); counter++)
+				{
+					if (counter)
+						fputc(',', pFile);
+
+					_Helpers::WriteJSONString(pFile, result.mCounters[counter].mName);
+					fprintf(pFile, ":%.6g", result.mCounters[counter].mValue);
+				}
+
+				fprintf(pFile, "}}");
+			}
+
+			fprintf(pFile, "\n]\n}\n");
+			fclose(pFile);
+
+			return true;
+		}
+
+		bool LoadBaseline(const char* pFilePath, std::vector<BaselineEntry>& baseline)
+		{
+			std::ifstream file(pFilePath);
+			if (!file.is_open())
+				return false;
+
+			// WriteJSON writes every benchmark on its own line.
+			String line;
+			while (std::getline(file, line))
+			{
+				const UI64 namePosition = line.find("{\"name\":\"");
+				if (namePosition == String::npos)
+					continue;
+
+				BaselineEntry entry;
+				for (UI64 index = namePosition + 9; index < line.size() && line[index] != '"'; index++)
+				{
+					if (line[index] == '\\' && index + 1 < line.size())
+						index++;
+
+					entry.mName.push_back(line[index]);
+				}
+
+				// Skipped benchmarks have no times.
+				if (!_Helpers::ReadJSONNumber(line, "\"median_ns\":", entry.mMedian))
+					continue;
+
+				_Helpers::ReadJSONNumber(line, "\"stddev_ns\":", entry.mStandardDeviation);
+				baseline.push_back(entry);
+			}
+
+			return true;
+		}
+
+		UI64 CompareToBaseline(const std::vector<BenchmarkResult>& results, const std::vector<BaselineEntry>& baseline, double threshold)
+		{
+			printf("\n%-56s %12s %12s %9s\n", "Comparison", "Baseline", "Current", "Change");
+
+			UI64 regressionCount = 0;
+			for (const auto& result : results)
+			{
+				if (!result.mSkipReason.empty())
+					continue;
+
+				const auto itr = std::find_if(baseline.begin(), baseline.end(), [&result](const BaselineEntry& entry) { return entry.mName == result.mName; });
+				if (itr == baseline.end() || itr->mMedian <= 0.0)
+				{
+					printf("%-56s %12s %12s %9s\n", result.mName.c_str(), "-", _Helpers::FormatTime(result.mMedian).c_str(), "new");
+					continue;
+				}
+
+				const double difference = result.mMedian - itr->mMedian;
+				const double change = difference / itr->mMedian * 100.0;
+				const double noise = result.mStandardDeviation + itr->mStandardDeviation;
+
+				const char* pVerdict = "";
+				if (change > threshold && difference > noise)
+				{
+					pVerdict = "  REGRESSION";
+					regressionCount++;
+				}
+				else if (change < -threshold && -difference > noise)
+					pVerdict = "  improved";
+
+				printf("%-56s %12s %12s %+8.2f%%%s\n", result.mName.c_str(), _Helpers::FormatTime(itr->mMedian).c_str(), _Helpers::FormatTime(result.mMedian).c_str(), change, pVerdict);
+			}
+
+			printf("\n%llu regression(s) above %.2f%%.\n", regressionCount, threshold);
+			return regressionCount;
+		}
+	}
+}
@@ -0,0 +1,79 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * Benchmarks.
+ * This runs the registered micro benchmarks of the engine modules without a window or a graphics device.
+ *
+ * Every benchmark is warmed up, its iteration count is calibrated to the minimum repetition time, and then the
+ * repetitions are measured. The median, mean, coefficient of variation, min and max time per iteration are
+ * printed, and can be written as JSON and compared to a previous run.
+ *
+ * Usage: Benchmarks [--filter=<text>] [--cpus=<a,b,...>] [--json=<file>] [--baseline=<file>] [--threshold=<percent>]
+ * Run with --help for all the options. The exit code is 1 if a benchmark regressed, 2 if the arguments are invalid.
+ */
+
+#include "Harness/Runner.h"
+
+#include <algorithm>
+#include <cstdio>
+
+using namespace DMK;
+using namespace DMK::Benchmarks;
+
+int main(int argc, char** argv)
+{
+	RunnerOptions options;
+	if (!ParseArguments(argc, argv, options))
+		return 2;
+
+	if (options.bShowHelp)
+		return 0;
+
+	auto benchmarks = GetBenchmarks();
+	std::sort(benchmarks.begin(), benchmarks.end(), [](const BenchmarkEntry& lhs, const BenchmarkEntry& rhs) { return lhs.mName < rhs.mName; });
+
+	if (options.bListOnly)
+	{
+		for (const auto& entry : benchmarks)
+			if (entry.mName.find(options.mFilter) != String::npos)
+				printf("%s\n", entry.mName.c_str());
+
+		return 0;
+	}
+
+	if (!options.mSettings.mCPUs.empty() && !PinCurrentThread(options.mSettings.mCPUs.front()))
+		printf("Warning: Unable to pin the main thread to CPU %d.\n", options.mSettings.mCPUs.front());
+
+#ifdef DMK_DEBUG
+	printf("Warning: This is a debug build. The results are not representative.\n");
+
+#endif
+
+	printf("%-56s %12s %12s %8s %12s %12s %12s\n", "Benchmark", "Median", "Mean", "CV", "Min", "Max", "Iterations");
+
+	std::vector<BenchmarkResult> results;
+	for (const auto& entry : benchmarks)
+	{
+		if (entry.mName.find(options.mFilter) == String::npos)
+			continue;
+
+		results.push_back(RunBenchmark(entry, options.mSettings));
+		PrintResult(results.back());
+	}
+
+	if (!options.mOutputPath.empty() && !WriteJSON(options.mOutputPath.c_str(), results, options.mSettings))
+		printf("Unable to write the results to %s.\n", options.mOutputPath.c_str());
+
+	if (options.mBaselinePath.empty())
+		return 0;
+
+	std::vector<BaselineEntry> baseline;
+	if (!LoadBaseline(options.mBaselinePath.c_str(), baseline))
+	{
+		printf("Unable to read the baseline %s.\n", options.mBaselinePath.c_str());
+		return 2;
+	}
+
+	return CompareToBaseline(results, baseline, options.mRegressionThreshold) ? 1 : 0;
+}
@@ -0,0 +1,29 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Harness/Benchmark.h"
+
+#include "AssetLoader/ImageLoader.h"
+
+#include <filesystem>
+
+using namespace DMK;
+using namespace DMK::Benchmarks;
+
+DMK_BENCHMARK("AssetLoader/LoadImageData_SkyBoxJPEG")
+{
+	const String assetPath = state.GetAssetPath("Textures/SkyBox/front.jpg");
+	if (!std::filesystem::exists(assetPath))
+	{
+		state.Skip("Image asset not found");
+		return;
+	}
+
+	// Decoding takes milliseconds, so use a small fixed iteration count instead of calibrating.
+	state.SetIterations(4);
+	state.SetBytesPerIteration(std::filesystem::file_size(assetPath));
+	state.Run([&]
+		{
+			DoNotOptimize(AssetLoader::LoadImageData(assetPath.c_str()));
+		});
+}
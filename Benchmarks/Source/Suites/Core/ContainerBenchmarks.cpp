@@ -0,0 +1,90 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Harness/Benchmark.h"
+
+#include "Core/Types/RingBuffer.h"
+#include "Core/Types/SparseSet.h"
+#include "Core/Types/StaticQueue.h"
+
+#include <memory>
+
+using namespace DMK;
+using namespace DMK::Benchmarks;
+
+DMK_BENCHMARK("Core/Containers/RingBuffer_PushPop")
+{
+	auto pBuffer = std::make_unique<RingBuffer<UI64, 1024>>();
+	UI64 value = 0;
+
+	state.SetItemsPerIteration(1);
+	state.Run([&]
+		{
+			pBuffer->TryPush(value++);
+			pBuffer->TryPop(value);
+			DoNotOptimize(value);
+		});
+}
+
+DMK_BENCHMARK("Core/Containers/RingBuffer_BulkPushPop_256")
+{
+	auto pBuffer = std::make_unique<RingBuffer<UI64, 1024>>();
+	UI64 values[256] = {};
+
+	state.SetItemsPerIteration(256);
+	state.Run([&]
+		{
+			pBuffer->TryPush(values, 256);
+
+			UI64 count = 0;
+			while (pBuffer->FrontRange(count))
+			{
+				DoNotOptimize(count);
+				pBuffer->Pop(count);
+			}
+		});
+}
+
+DMK_BENCHMARK("Core/Containers/StaticQueue_PushPop")
+{
+	StaticQueue<UI64, 64> queue;
+	UI64 value = 0;
+
+	state.SetItemsPerIteration(1);
+	state.Run([&]
+		{
+			queue.Push(value++);
+			value = queue.GetAndPop();
+			DoNotOptimize(value);
+		});
+}
+
+DMK_BENCHMARK("Core/Containers/SparseSet_Insert_1024")
+{
+	state.SetItemsPerIteration(1024);
+	state.Run([&]
+		{
+			SparseSet<UI64> set;
+			for (UI64 index = 0; index < 1024; index++)
+				set.Insert(index);
+
+			DoNotOptimize(set);
+		});
+}
+
+DMK_BENCHMARK("Core/Containers/SparseSet_Iterate_4096")
+{
+	SparseSet<UI64> set;
+	for (UI64 index = 0; index < 4096; index++)
+		set.Insert(index);
+
+	state.SetItemsPerIteration(4096);
+	state.Run([&]
+		{
+			UI64 sum = 0;
+			for (auto itr = set.Begin(); itr != set.End(); itr++)
+				sum += *itr;
+
+			DoNotOptimize(sum);
+		});
+}
@@ -0,0 +1,113 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Harness/Benchmark.h"
+
+#include "Core/Hash/Hasher.h"
+#include "Core/Hash/CompileTimeHash.h"
+#include "Core/Random/RandomEngine.h"
+
+#include <cstring>
+#include <thread>
+
+using namespace DMK;
+using namespace DMK::Benchmarks;
+
+namespace
+{
+	/**
+	 * Create a buffer of random bytes.
+	 */
+	std::vector<UI8> CreateData(UI64 size)
+	{
+		std::vector<UI64> words((size + sizeof(UI64) - 1) / sizeof(UI64));
+		Random::BatchRandomEngine().Fill(words.data(), words.size());
+
+		std::vector<UI8> data(size);
+		memcpy(data.data(), words.data(), size);
+
+		return data;
+	}
+
+	/**
+	 * Register a GetHash benchmark for a data size.
+	 */
+	void RegisterGetHash(const char* pName, UI64 size)
+	{
+		RegisterBenchmark(pName, [size](BenchmarkState& state)
+			{
+				const std::vector<UI8> data = CreateData(size);
+
+				state.SetBytesPerIteration(size);
+				state.Run([&]
+					{
+						DoNotOptimize(Hasher::GetHash(data.data(), size));
+					});
+			});
+	}
+
+	/**
+	 * Register the size sweep.
+	 */
+	struct GetHashRegistrar {
+		GetHashRegistrar()
+		{
+			RegisterGetHash("Core/Hash/GetHash_16B", 16);
+			RegisterGetHash("Core/Hash/GetHash_64B", 64);
+			RegisterGetHash("Core/Hash/GetHash_4KiB", 4 * 1024);
+			RegisterGetHash("Core/Hash/GetHash_1MiB", 1024 * 1024);
+		}
+	} Registrar;
+}
+
+DMK_BENCHMARK("Core/Hash/GetHash128_1MiB")
+{
+	const std::vector<UI8> data = CreateData(1024 * 1024);
+
+	state.SetBytesPerIteration(data.size());
+	state.Run([&]
+		{
+			DoNotOptimize(Hasher::GetHash128(data.data(), data.size()));
+		});
+}
+
+DMK_BENCHMARK("Core/Hash/StreamHasher_1MiB_4KiBChunks")
+{
+	const std::vector<UI8> data = CreateData(1024 * 1024);
+	Hasher::StreamHasher hasher;
+
+	state.SetBytesPerIteration(data.size());
+	state.Run([&]
+		{
+			hasher.Reset();
+			for (UI64 offset = 0; offset < data.size(); offset += 4 * 1024)
+				hasher.Update(data.data() + offset, 4 * 1024);
+
+			DoNotOptimize(hasher.Digest());
+		});
+}
+
+DMK_BENCHMARK("Core/Hash/GetHashParallel_64MiB")
+{
+	const std::vector<UI8> data = CreateData(64 * 1024 * 1024);
+
+	state.SetCounter("threads", static_cast<double>(std::thread::hardware_concurrency()));
+	state.SetBytesPerIteration(data.size());
+	state.Run([&]
+		{
+			DoNotOptimize(Hasher::GetHashParallel(data.data(), data.size()));
+		});
+}
+
+DMK_BENCHMARK("Core/Hash/GetHashFNV1a_Runtime_32B")
+{
+	// Read the string through a volatile pointer so that the hash is not computed at compile time.
+	static const char STRING[] = "DMK::Thread::CommandQueue<64>";
+	const char* volatile pString = STRING;
+
+	state.SetBytesPerIteration(sizeof(STRING) - 1);
+	state.Run([&]
+		{
+			DoNotOptimize(Hasher::GetHashFNV1a(pString, sizeof(STRING) - 1));
+		});
+}
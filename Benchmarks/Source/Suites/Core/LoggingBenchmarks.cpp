@@ -0,0 +1,113 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Harness/Benchmark.h"
+
+#include "Core/ErrorHandler/Logger.h"
+#include "Core/ErrorHandler/BinaryLogger.h"
+#include "Core/Benchmark/LatencyRecorder.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+
+using namespace DMK;
+using namespace DMK::Benchmarks;
+
+namespace
+{
+	constexpr UI64 LoggerBatchSize = 512;	// Messages logged before the logger is flushed (half a thread buffer).
+	constexpr UI64 BinaryLoggerBatchSize = 4096;	// Records logged before the binary logger is flushed.
+	constexpr UI64 LatencySampleCount = 20000;	// Number of individually timed calls for the percentiles.
+
+	/**
+	 * Time a function call by call and report the percentiles as counters.
+	 * The values include the cost of reading the clock.
+	 *
+	 * @param state: The benchmark state.
+	 * @param batchSize: The number of calls after which flush is called.
+	 * @param function: The function to time.
+	 * @param flush: The function which drains the buffers.
+	 */
+	template<class Function, class Flush>
+	void ReportLatencyPercentiles(BenchmarkState& state, UI64 batchSize, Function&& function, Flush&& flush)
+	{
+		Benchmark::LatencyHistogram histogram;
+		for (UI64 index = 0; index < LatencySampleCount; index++)
+		{
+			if (index % batchSize == 0)
+				flush();
+
+			const auto beginTime = std::chrono::steady_clock::now();
+			function();
+			histogram.Record(static_cast<UI64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - beginTime).count()));
+		}
+
+		flush();
+
+		state.SetCounter("p50_ns", static_cast<double>(histogram.GetPercentile(50.0)));
+		state.SetCounter("p99_ns", static_cast<double>(histogram.GetPercentile(99.0)));
+		state.SetCounter("p999_ns", static_cast<double>(histogram.GetPercentile(99.9)));
+	}
+
+	/**
+	 * Measure a logging function, flushing outside of the timed region so that the buffers never fill up.
+	 */
+	template<class Function, class Flush>
+	void MeasureEnqueue(BenchmarkState& state, UI64 batchSize, Function&& function, Flush&& flush)
+	{
+		state.SetItemsPerIteration(1);
+		state.Measure([&](UI64 iterations) -> double
+			{
+				double elapsed = 0.0;
+				for (UI64 logged = 0; logged < iterations;)
+				{
+					const UI64 count = std::min(batchSize, iterations - logged);
+					const auto beginTime = std::chrono::steady_clock::now();
+
+					for (UI64 index = 0; index < count; index++)
+						function();
+
+					elapsed += static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - beginTime).count());
+					logged += count;
+
+					flush();
+				}
+
+				return elapsed;
+			});
+	}
+}
+
+DMK_BENCHMARK("Core/Logging/Logger_LogInfo_Enqueue")
+{
+	ConsoleSilencer silencer;
+
+	const auto log = [] { Logger::LogInfo(TEXT("Benchmark message with a typical length for the engine log.")); };
+	const auto flush = [] { Logger::Flush(1000); };
+
+	MeasureEnqueue(state, LoggerBatchSize, log, flush);
+	ReportLatencyPercentiles(state, LoggerBatchSize, log, flush);
+}
+
+DMK_BENCHMARK("Core/Logging/BinaryLogger_Log_3Arguments")
+{
+	const String filePath = (std::filesystem::temp_directory_path() / "DynamikBenchmark.dmklog").string();
+	if (!BinaryLogger::Open(filePath.c_str()))
+	{
+		state.Skip("Unable to open the binary log file");
+		return;
+	}
+
+	UI64 counter = 0;
+	const auto log = [&counter] { DMK_BINARY_LOG_INFO("Frame {} took {} ms on thread {}", counter++, 16.6, "Main"); };
+	const auto flush = [] { BinaryLogger::Flush(1000); };
+
+	MeasureEnqueue(state, BinaryLoggerBatchSize, log, flush);
+	ReportLatencyPercentiles(state, BinaryLoggerBatchSize, log, flush);
+
+	state.SetCounter("dropped", static_cast<double>(BinaryLogger::GetDroppedRecordCount()));
+
+	BinaryLogger::Close();
+	std::remove(filePath.c_str());
+}
@@ -0,0 +1,182 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Harness/Benchmark.h"
+
+#include "Core/Maths/Matrix/Matrix44.h"
+#include "Core/Maths/Quantization.h"
+#include "Core/Random/RandomEngine.h"
+
+#include <cmath>
+
+using namespace DMK;
+using namespace DMK::Benchmarks;
+
+namespace
+{
+	constexpr UI64 ElementCount = 1 << 16;	// Number of values the batch benchmarks process.
+
+	/**
+	 * Create random floats in the range [lowerBound, upperBound).
+	 */
+	std::vector<float> CreateFloats(UI64 count, float lowerBound, float upperBound)
+	{
+		std::vector<float> values(count);
+		Random::BatchRandomEngine engine;
+		engine.FillFloat(values.data(), count, lowerBound, upperBound);
+
+		return values;
+	}
+
+	/**
+	 * Create random unit normals, 3 floats each.
+	 */
+	std::vector<float> CreateNormals(UI64 count)
+	{
+		std::vector<float> normals = CreateFloats(count * 3, -1.0f, 1.0f);
+		for (UI64 index = 0; index < count; index++)
+		{
+			float* pNormal = normals.data() + index * 3;
+			const float length = std::sqrt(pNormal[0] * pNormal[0] + pNormal[1] * pNormal[1] + pNormal[2] * pNormal[2]);
+			const float scale = length > 0.0f ? 1.0f / length : 0.0f;
+
+			pNormal[0] *= scale;
+			pNormal[1] *= scale;
+			pNormal[2] *= scale;
+		}
+
+		return normals;
+	}
+}
+
+DMK_BENCHMARK("Core/Maths/Vector4_MultiplyAdd")
+{
+	Vector4 accumulator(0.0f);
+	const Vector4 scale(1.0001f, 0.9999f, 1.0002f, 0.9998f);
+	const Vector4 offset(0.5f, 0.25f, 0.125f, 0.0625f);
+
+	state.Run([&]
+		{
+			accumulator = accumulator * scale + offset;
+			DoNotOptimize(accumulator);
+		});
+}
+
+DMK_BENCHMARK("Core/Maths/Matrix44_Multiply")
+{
+	Matrix44 lhs(1.0001f);
+	const Matrix44 rhs(Vector4(1.0f, 0.1f, 0.0f, 0.0f), Vector4(0.0f, 1.0f, 0.1f, 0.0f), Vector4(0.0f, 0.0f, 1.0f, 0.1f), Vector4(0.1f, 0.0f, 0.0f, 1.0f));
+
+	state.Run([&]
+		{
+			const Matrix44 product = static_cast<const Matrix44&>(lhs) * rhs;
+			DoNotOptimize(product);
+			ClobberMemory();
+		});
+}
+
+DMK_BENCHMARK("Core/Maths/Matrix44_TransformVector4_64K")
+{
+	const Matrix44 matrix(Vector4(1.0f, 0.1f, 0.0f, 0.0f), Vector4(0.0f, 1.0f, 0.1f, 0.0f), Vector4(0.0f, 0.0f, 1.0f, 0.1f), Vector4(0.1f, 0.0f, 0.0f, 1.0f));
+	const std::vector<float> source = CreateFloats(ElementCount * 4, -100.0f, 100.0f);
+	std::vector<Vector4> vectors(ElementCount);
+
+	state.SetItemsPerIteration(ElementCount);
+	state.SetBytesPerIteration(ElementCount * sizeof(Vector4));
+	state.Run([&]
+		{
+			for (UI64 index = 0; index < ElementCount; index++)
+				vectors[index] = matrix * Vector4(source.data() + index * 4);
+
+			DoNotOptimize(vectors.data());
+			ClobberMemory();
+		});
+}
+
+DMK_BENCHMARK("Core/Quantization/FloatToHalf_64K")
+{
+	const std::vector<float> source = CreateFloats(ElementCount, -65504.0f, 65504.0f);
+	std::vector<UI16> destination(ElementCount);
+
+	state.SetItemsPerIteration(ElementCount);
+	state.SetBytesPerIteration(ElementCount * sizeof(float));
+	state.Run([&]
+		{
+			Quantization::FloatToHalf(destination.data(), source.data(), ElementCount);
+			ClobberMemory();
+		});
+}
+
+DMK_BENCHMARK("Core/Quantization/HalfToFloat_64K")
+{
+	const std::vector<float> values = CreateFloats(ElementCount, -65504.0f, 65504.0f);
+	std::vector<UI16> source(ElementCount);
+	std::vector<float> destination(ElementCount);
+	Quantization::FloatToHalf(source.data(), values.data(), ElementCount);
+
+	state.SetItemsPerIteration(ElementCount);
+	state.SetBytesPerIteration(ElementCount * sizeof(UI16));
+	state.Run([&]
+		{
+			Quantization::HalfToFloat(destination.data(), source.data(), ElementCount);
+			ClobberMemory();
+		});
+}
+
+DMK_BENCHMARK("Core/Quantization/FloatToSNorm16_64K")
+{
+	const std::vector<float> source = CreateFloats(ElementCount, -1.0f, 1.0f);
+	std::vector<I16> destination(ElementCount);
+
+	state.SetItemsPerIteration(ElementCount);
+	state.SetBytesPerIteration(ElementCount * sizeof(float));
+	state.Run([&]
+		{
+			Quantization::FloatToSNorm16(destination.data(), source.data(), ElementCount);
+			ClobberMemory();
+		});
+}
+
+DMK_BENCHMARK("Core/Quantization/FloatToUNorm8_64K")
+{
+	const std::vector<float> source = CreateFloats(ElementCount, 0.0f, 1.0f);
+	std::vector<UI8> destination(ElementCount);
+
+	state.SetItemsPerIteration(ElementCount);
+	state.SetBytesPerIteration(ElementCount * sizeof(float));
+	state.Run([&]
+		{
+			Quantization::FloatToUNorm8(destination.data(), source.data(), ElementCount);
+			ClobberMemory();
+		});
+}
+
+DMK_BENCHMARK("Core/Quantization/EncodeOctahedral16_64K")
+{
+	const std::vector<float> normals = CreateNormals(ElementCount);
+	std::vector<UI32> destination(ElementCount);
+
+	state.SetItemsPerIteration(ElementCount);
+	state.SetBytesPerIteration(ElementCount * sizeof(float) * 3);
+	state.Run([&]
+		{
+			Quantization::EncodeOctahedral16(destination.data(), normals.data(), ElementCount);
+			ClobberMemory();
+		});
+}
+
+DMK_BENCHMARK("Core/Quantization/DecodeOctahedral16_64K")
+{
+	const std::vector<float> normals = CreateNormals(ElementCount);
+	std::vector<UI32> source(ElementCount);
+	std::vector<float> destination(ElementCount * 3);
+	Quantization::EncodeOctahedral16(source.data(), normals.data(), ElementCount);
+
+	state.SetItemsPerIteration(ElementCount);
+	state.SetBytesPerIteration(ElementCount * sizeof(UI32));
+	state.Run([&]
+		{
+			Quantization::DecodeOctahedral16(destination.data(), source.data(), ElementCount);
+			ClobberMemory();
+		});
+}
@@ -0,0 +1,133 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Harness/Benchmark.h"
+
+#include "Core/Benchmark/Profiler.h"
+#include "Core/Benchmark/LatencyRecorder.h"
+#include "Core/Benchmark/PerformanceCounters.h"
+#include "Core/Memory/StaticAllocator.h"
+
+#include <memory>
+
+using namespace DMK;
+using namespace DMK::Benchmarks;
+
+namespace
+{
+	/**
+	 * Allocate and deallocate blocks of mixed sizes through the static allocator.
+	 */
+	void AllocateMixedSizes(BenchmarkState& state)
+	{
+		constexpr UI64 BlockCount = 256;
+		BYTE* pBlocks[BlockCount] = {};
+		UI64 sizeIndex = 0;
+
+		state.SetItemsPerIteration(BlockCount);
+		state.Run([&]
+			{
+				for (UI64 index = 0; index < BlockCount; index++)
+					pBlocks[index] = StaticAllocator<BYTE>::RawAllocate(16 + (sizeIndex++ % 64) * 8);
+
+				for (UI64 index = 0; index < BlockCount; index++)
+					StaticAllocator<BYTE>::RawDeallocate(pBlocks[index], 0);
+			});
+	}
+}
+
+DMK_BENCHMARK("Core/Profiling/ProfilerZone_Recording")
+{
+	Benchmark::Profiler::BeginSession();
+
+	state.SetItemsPerIteration(1);
+	state.Measure([](UI64 iterations) -> double
+		{
+			return Benchmark::Profiler::MeasureZoneOverhead(iterations) * static_cast<double>(iterations);
+		});
+
+	state.SetCounter("dropped", static_cast<double>(Benchmark::Profiler::GetDroppedZoneCount()));
+	Benchmark::Profiler::EndSession();
+}
+
+DMK_BENCHMARK("Core/Profiling/ProfilerZone_Inactive")
+{
+	static constexpr Benchmark::ZoneDescriptor mDescriptor = { "Inactive", "ProfilerZone_Inactive", __FILE__, __LINE__ };
+
+	state.SetItemsPerIteration(1);
+	state.Run([&]
+		{
+			Benchmark::ProfilerZone zone(mDescriptor);
+			ClobberMemory();
+		});
+}
+
+DMK_BENCHMARK("Core/Profiling/LatencyRecorder_Record")
+{
+	auto pRecorder = std::make_unique<Benchmark::LatencyRecorder>("Benchmark");
+	UI64 value = 0;
+
+	state.SetItemsPerIteration(1);
+	state.Run([&]
+		{
+			pRecorder->Record(value);
+			value = (value + 7919) & 0xFFFFF;
+		});
+}
+
+DMK_BENCHMARK("Core/Profiling/LatencyScope")
+{
+	auto pRecorder = std::make_unique<Benchmark::LatencyRecorder>("Benchmark");
+
+	state.SetItemsPerIteration(1);
+	state.Run([&]
+		{
+			Benchmark::LatencyScope scope(*pRecorder);
+			ClobberMemory();
+		});
+}
+
+DMK_BENCHMARK("Core/Profiling/LatencyHistogram_Percentiles")
+{
+	auto pHistogram = std::make_unique<Benchmark::LatencyHistogram>();
+	for (UI64 value = 1; value < (1 << 20); value += 13)
+		pHistogram->Record(value);
+
+	state.Run([&]
+		{
+			DoNotOptimize(pHistogram->GetPercentile(99.0));
+		});
+}
+
+DMK_BENCHMARK("Core/Profiling/PerformanceCounters_Read")
+{
+	auto& counters = Benchmark::PerformanceCounters::ThreadLocal();
+	if (!counters.IsAvailable())
+	{
+		state.Skip("Hardware counters are not available");
+		return;
+	}
+
+	Benchmark::CounterValues values;
+	state.Run([&]
+		{
+			counters.Read(values);
+			DoNotOptimize(values);
+		});
+}
+
+DMK_BENCHMARK("Core/Profiling/StaticAllocator_Mixed_ProfilerDisabled")
+{
+	AllocationProfiler::Disable();
+	AllocateMixedSizes(state);
+}
+
+DMK_BENCHMARK("Core/Profiling/StaticAllocator_Mixed_ProfilerEnabled")
+{
+	AllocationProfiler::Enable();
+	AllocateMixedSizes(state);
+	AllocationProfiler::Disable();
+
+	state.SetCounter("call_sites", static_cast<double>(AllocationProfiler::GetCallSites().size()));
+	AllocationProfiler::Reset();
+}
@@ -0,0 +1,119 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Harness/Benchmark.h"
+
+#include "Core/Random/RandomEngine.h"
+
+#include <random>
+
+using namespace DMK;
+using namespace DMK::Benchmarks;
+
+namespace
+{
+	constexpr UI64 ElementCount = 1 << 16;	// Number of values the fill benchmarks generate.
+}
+
+DMK_BENCHMARK("Core/Random/RandomEngine_Next")
+{
+	Random::RandomEngine engine;
+
+	state.SetItemsPerIteration(1);
+	state.Run([&]
+		{
+			DoNotOptimize(engine.Next());
+		});
+}
+
+DMK_BENCHMARK("Core/Random/RandomEngine_NextBounded")
+{
+	Random::RandomEngine engine;
+
+	state.SetItemsPerIteration(1);
+	state.Run([&]
+		{
+			DoNotOptimize(engine.NextBounded(1000));
+		});
+
+	// Statistical smoke check: chi-square of 64 equally likely buckets (63 degrees of freedom). Values above
+	// 103.4 have a probability below 0.1% for a uniform generator.
+	constexpr UI64 BucketCount = 64;
+	constexpr UI64 SampleCount = 1 << 20;
+
+	UI64 buckets[BucketCount] = {};
+	for (UI64 index = 0; index < SampleCount; index++)
+		buckets[engine.NextBounded(BucketCount)]++;
+
+	const double expected = static_cast<double>(SampleCount) / static_cast<double>(BucketCount);
+	double chiSquare = 0.0;
+	for (const UI64 count : buckets)
+		chiSquare += (static_cast<double>(count) - expected) * (static_cast<double>(count) - expected) / expected;
+
+	state.SetCounter("chi_square", chiSquare);
+	state.SetCounter("uniform", chiSquare < 103.4 ? 1.0 : 0.0);
+}
+
+DMK_BENCHMARK("Core/Random/RandomEngine_NextDouble")
+{
+	Random::RandomEngine engine;
+
+	state.SetItemsPerIteration(1);
+	state.Run([&]
+		{
+			DoNotOptimize(engine.NextDouble());
+		});
+}
+
+DMK_BENCHMARK("Core/Random/RandomEngine_Fill_64K")
+{
+	Random::RandomEngine engine;
+	std::vector<UI64> values(ElementCount);
+
+	state.SetItemsPerIteration(ElementCount);
+	state.SetBytesPerIteration(ElementCount * sizeof(UI64));
+	state.Run([&]
+		{
+			engine.Fill(values.data(), ElementCount);
+			ClobberMemory();
+		});
+}
+
+DMK_BENCHMARK("Core/Random/BatchRandomEngine_Fill_64K")
+{
+	Random::BatchRandomEngine engine;
+	std::vector<UI64> values(ElementCount);
+
+	state.SetItemsPerIteration(ElementCount);
+	state.SetBytesPerIteration(ElementCount * sizeof(UI64));
+	state.Run([&]
+		{
+			engine.Fill(values.data(), ElementCount);
+			ClobberMemory();
+		});
+}
+
+DMK_BENCHMARK("Core/Random/BatchRandomEngine_FillFloat_64K")
+{
+	Random::BatchRandomEngine engine;
+	std::vector<float> values(ElementCount);
+
+	state.SetItemsPerIteration(ElementCount);
+	state.SetBytesPerIteration(ElementCount * sizeof(float));
+	state.Run([&]
+		{
+			engine.FillFloat(values.data(), ElementCount);
+			ClobberMemory();
+		});
+}
+
+DMK_BENCHMARK("Core/Random/StdMersenneTwister64_Reference")
+{
+	std::mt19937_64 engine;
+
+	state.SetItemsPerIteration(1);
+	state.Run([&]
+		{
+			DoNotOptimize(engine());
+		});
+}
@@ -0,0 +1,135 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Harness/Benchmark.h"
+
+#include "NullBackend/NullBackendAdapter.h"
+#include "Core/Maths/Matrix/Matrix44.h"
+#include "Core/Maths/Vector/Vector3.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+using namespace DMK;
+using namespace DMK::Benchmarks;
+
+namespace
+{
+	constexpr UI64 ObjectCount = 4096;	// Objects drawn per frame.
+	constexpr UI64 MeshCount = 16;	// Meshes the objects share.
+	constexpr UI32 MeshIndexCount = 36;	// Indices of a mesh (a cube).
+	constexpr UI64 UniformAlignment = 256;	// Offset alignment of the uniforms, the largest Vulkan requires.
+
+	/**
+	 * Scene object.
+	 */
+	struct SceneObject {
+		Matrix44 mModel = Matrix44(1.0f);	// Model matrix.
+		UI64 mMeshIndex = 0;	// Index of the mesh.
+	};
+
+	/**
+	 * Scene drawn with the null backend. Every frame traverses the objects, packs their model view projection
+	 * matrices to a uniform buffer and records an indexed draw for each.
+	 */
+	class NullScene {
+	public:
+		NullScene()
+		{
+			mAdapter.Initialize(false);
+
+			const auto display = mAdapter.CreateDisplay(1280, 720);
+			const auto device = mAdapter.CreateDevice(display);
+			mRenderTarget = mAdapter.CreateRenderTarget(device, GraphicsCore::RenderTargetType::SCREEN_BOUND_3D, Vector2(1280.0f, 720.0f));
+			mCommandBuffer = mAdapter.CreateCommandBuffer(mRenderTarget);
+
+			for (UI64 index = 0; index < MeshCount; index++)
+			{
+				mVertexBuffers.push_back(mAdapter.CreateBuffer(device, GraphicsCore::BufferType::VERTEX, 24 * sizeof(Vector3)));
+				mIndexBuffers.push_back(mAdapter.CreateBuffer(device, GraphicsCore::BufferType::INDEX, MeshIndexCount * sizeof(UI32)));
+			}
+
+			mUniformBuffer = mAdapter.CreateBuffer(device, GraphicsCore::BufferType::UNIFORM, ObjectCount * UniformAlignment);
+
+			for (UI64 index = 0; index < ObjectCount; index++)
+			{
+				SceneObject object;
+				object.mModel = Matrix44(Vector4(1.0f, 0.0f, 0.0f, 0.0f), Vector4(0.0f, 1.0f, 0.0f, 0.0f), Vector4(0.0f, 0.0f, 1.0f, 0.0f), Vector4(static_cast<float>(index), 0.0f, 0.0f, 1.0f));
+				object.mMeshIndex = index % MeshCount;
+				mObjects.push_back(object);
+			}
+		}
+
+		~NullScene() { mAdapter.Terminate(); }
+
+		/**
+		 * Draw a frame.
+		 *
+		 * @param bShouldMap: Whether to write the uniforms to the mapped buffer, instead of copying each.
+		 */
+		void DrawFrame(bool bShouldMap)
+		{
+			mViewProjection = mViewProjection * 1.0001f;
+
+			BYTE* pUniforms = bShouldMap ? static_cast<BYTE*>(mAdapter.MapBuffer(mUniformBuffer)) : nullptr;
+			mAdapter.BeginCommandBuffer(mCommandBuffer);
+
+			for (UI64 index = 0; index < mObjects.size(); index++)
+			{
+				const SceneObject& object = mObjects[index];
+				const Matrix44 modelViewProjection = static_cast<const Matrix44&>(mViewProjection) * object.mModel;
+
+				if (bShouldMap)
+					std::memcpy(pUniforms + index * UniformAlignment, &modelViewProjection, sizeof(Matrix44));
+				else
+					mAdapter.CopyToBuffer(mUniformBuffer, &modelViewProjection, sizeof(Matrix44), index * UniformAlignment);
+
+				mAdapter.BindVertexBuffer(mCommandBuffer, mVertexBuffers[object.mMeshIndex]);
+				mAdapter.BindIndexBuffer(mCommandBuffer, mIndexBuffers[object.mMeshIndex]);
+				mAdapter.BindUniformBuffer(mCommandBuffer, mUniformBuffer, 0, index * UniformAlignment);
+				mAdapter.DrawIndexed(mCommandBuffer, MeshIndexCount);
+			}
+
+			mAdapter.EndCommandBuffer(mCommandBuffer);
+			if (bShouldMap)
+				mAdapter.UnmapBuffer(mUniformBuffer);
+
+			mAdapter.SubmitCommandBuffer(mCommandBuffer);
+			mAdapter.Present(mRenderTarget);
+		}
+
+		NullBackend::NullBackendAdapter mAdapter;	// The backend.
+
+	private:
+		std::vector<SceneObject> mObjects;	// The scene objects.
+		std::vector<GraphicsCore::BufferHandle> mVertexBuffers;	// Vertex buffer of every mesh.
+		std::vector<GraphicsCore::BufferHandle> mIndexBuffers;	// Index buffer of every mesh.
+		GraphicsCore::BufferHandle mUniformBuffer = {};	// Uniforms of the objects.
+		GraphicsCore::RenderTargetHandle mRenderTarget = {};	// The render target.
+		GraphicsCore::CommandBuffer mCommandBuffer = {};	// The command buffer recorded every frame.
+		Matrix44 mViewProjection = Matrix44(1.0f);	// View projection matrix.
+	};
+
+	/**
+	 * Measure the CPU cost of a frame and report the work the backend was given.
+	 */
+	void MeasureFrame(BenchmarkState& state, bool bShouldMap)
+	{
+		NullScene scene;
+
+		state.SetItemsPerIteration(ObjectCount);
+		state.Run([&] { scene.DrawFrame(bShouldMap); });
+
+		const NullBackend::NullBackendStatistics statistics = scene.mAdapter.GetStatistics();
+		const double frameCount = static_cast<double>(std::max<UI64>(statistics.mSubmitCount, 1));
+
+		state.SetCounter("draws_per_frame", static_cast<double>(statistics.mSubmittedDrawCount) / frameCount);
+		state.SetCounter("binds_per_frame", static_cast<double>(statistics.mBindCount) / frameCount);
+		state.SetCounter("copies_per_frame", static_cast<double>(statistics.mCopyCount) / frameCount);
+		state.SetCounter("invalid_calls", static_cast<double>(statistics.mInvalidCallCount));
+	}
+}
+
+DMK_BENCHMARK("Graphics/NullBackend/Frame_4K_Mapped") { MeasureFrame(state, true); }
+DMK_BENCHMARK("Graphics/NullBackend/Frame_4K_Copied") { MeasureFrame(state, false); }
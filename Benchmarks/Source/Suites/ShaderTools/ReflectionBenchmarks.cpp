@@ -0,0 +1,51 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Harness/Benchmark.h"
+
+#include "GraphicsCore/Objects/ShaderCode.h"
+#include "ShaderTools/SPIR-V/Reflection.h"
+
+#include <filesystem>
+
+using namespace DMK;
+using namespace DMK::Benchmarks;
+
+namespace
+{
+	/**
+	 * Reflect a SPIR-V shader from the asset directory.
+	 *
+	 * @param state: The benchmark state.
+	 * @param pAsset: The shader asset, relative to the asset directory.
+	 * @param location: The shader location.
+	 */
+	void ReflectShader(BenchmarkState& state, const char* pAsset, GraphicsCore::ShaderLocation location)
+	{
+		const String assetPath = state.GetAssetPath(pAsset);
+		if (!std::filesystem::exists(assetPath))
+		{
+			state.Skip("Shader asset not found");
+			return;
+		}
+
+		GraphicsCore::ShaderCode shaderCode;
+		shaderCode.LoadCode(assetPath.c_str(), GraphicsCore::ShaderCodeType::SPIR_V, location);
+
+		ShaderTools::SPIRVReflection reflection;
+		state.Run([&]
+			{
+				DoNotOptimize(reflection.Reflect(shaderCode));
+			});
+	}
+}
+
+DMK_BENCHMARK("ShaderTools/SPIRVReflection_Reflect_Vertex")
+{
+	ReflectShader(state, "Shaders/3D/vert.spv", GraphicsCore::ShaderLocation::VERTEX);
+}
+
+DMK_BENCHMARK("ShaderTools/SPIRVReflection_Reflect_Fragment")
+{
+	ReflectShader(state, "Shaders/3D/frag.spv", GraphicsCore::ShaderLocation::FRAGMENT);
+}
@@ -0,0 +1,141 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Harness/Benchmark.h"
+
+#include "Thread/Commands/CommandDispatcher.h"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace DMK;
+using namespace DMK::Benchmarks;
+
+namespace
+{
+	constexpr UI64 CommandCount = 4096;	// Commands dispatched per iteration.
+
+	/**
+	 * Benchmark command. Every index is a different command type.
+	 */
+	template<UI32 Index>
+	struct IndexedCommand {
+		UI64 mValue = Index;
+	};
+
+	using IndexedCommandRegistry = Thread::CommandRegistry<
+		IndexedCommand<0>, IndexedCommand<1>, IndexedCommand<2>, IndexedCommand<3>,
+		IndexedCommand<4>, IndexedCommand<5>, IndexedCommand<6>, IndexedCommand<7>,
+		IndexedCommand<8>, IndexedCommand<9>, IndexedCommand<10>, IndexedCommand<11>,
+		IndexedCommand<12>, IndexedCommand<13>, IndexedCommand<14>, IndexedCommand<15>
+	>;
+
+	/**
+	 * Handler which sums the command values. The work differs per type, so that the compiler cannot merge the
+	 * cases of the switch.
+	 */
+	struct SumHandler {
+		template<UI32 Index>
+		bool operator()(Thread::Command<IndexedCommand<Index>>& command)
+		{
+			mSum = mSum * (2 * Index + 3) + command->mValue;
+			DoNotOptimize(mSum);
+			return true;
+		}
+
+		UI64 mSum = 0;
+	};
+
+	/**
+	 * Create a command of a type selected at runtime.
+	 */
+	template<UI32 Index = 0>
+	Thread::CommandBase* CreateCommand(UI32 index)
+	{
+		if constexpr (Index < IndexedCommandRegistry::Count)
+		{
+			if (index == Index)
+				return new Thread::Command<IndexedCommand<Index>>();
+
+			return CreateCommand<Index + 1>(index);
+		}
+		else
+			return nullptr;
+	}
+
+	/**
+	 * Create the commands, either cycling through the types, which the branch predictor learns, or in a random
+	 * but repeatable order, which it cannot learn.
+	 */
+	std::vector<std::unique_ptr<Thread::CommandBase>> CreateCommands(bool bShouldShuffle)
+	{
+		std::mt19937 engine(42);
+		std::uniform_int_distribution<UI32> distribution(0, IndexedCommandRegistry::Count - 1);
+
+		std::vector<std::unique_ptr<Thread::CommandBase>> commands;
+		for (UI64 index = 0; index < CommandCount; index++)
+			commands.emplace_back(CreateCommand(bShouldShuffle ? distribution(engine) : static_cast<UI32>(index % IndexedCommandRegistry::Count)));
+
+		return commands;
+	}
+
+/**
+ * Switch case of the hash switch benchmark.
+ */
+#define INDEXED_COMMAND_CASE(index)	case TypeId<IndexedCommand<index>>(): handler(*pCommand->Derived<IndexedCommand<index>>()); break
+
+	/**
+	 * Dispatch using a switch on the 64 bit type ID, like the backends did before the dispatcher.
+	 */
+	void SwitchDispatch(SumHandler& handler, Thread::CommandBase* pCommand)
+	{
+		switch (pCommand->GetCommandID())
+		{
+			INDEXED_COMMAND_CASE(0); INDEXED_COMMAND_CASE(1); INDEXED_COMMAND_CASE(2); INDEXED_COMMAND_CASE(3);
+			INDEXED_COMMAND_CASE(4); INDEXED_COMMAND_CASE(5); INDEXED_COMMAND_CASE(6); INDEXED_COMMAND_CASE(7);
+			INDEXED_COMMAND_CASE(8); INDEXED_COMMAND_CASE(9); INDEXED_COMMAND_CASE(10); INDEXED_COMMAND_CASE(11);
+			INDEXED_COMMAND_CASE(12); INDEXED_COMMAND_CASE(13); INDEXED_COMMAND_CASE(14); INDEXED_COMMAND_CASE(15);
+
+		default:
+			break;
+		}
+	}
+
+#undef INDEXED_COMMAND_CASE
+
+	void MeasureSwitchDispatch(BenchmarkState& state, bool bShouldShuffle)
+	{
+		const auto commands = CreateCommands(bShouldShuffle);
+		SumHandler handler;
+
+		state.SetItemsPerIteration(CommandCount);
+		state.Run([&]
+			{
+				for (const auto& pCommand : commands)
+					SwitchDispatch(handler, pCommand.get());
+
+				DoNotOptimize(handler.mSum);
+			});
+	}
+
+	void MeasureJumpTableDispatch(BenchmarkState& state, bool bShouldShuffle)
+	{
+		const auto commands = CreateCommands(bShouldShuffle);
+		SumHandler handler;
+
+		state.SetItemsPerIteration(CommandCount);
+		state.Run([&]
+			{
+				for (const auto& pCommand : commands)
+					Thread::CommandDispatcher<IndexedCommandRegistry>::Dispatch(handler, pCommand.get());
+
+				DoNotOptimize(handler.mSum);
+			});
+	}
+}
+
+DMK_BENCHMARK("Thread/CommandDispatch/HashSwitch_16Types_Cyclic") { MeasureSwitchDispatch(state, false); }
+DMK_BENCHMARK("Thread/CommandDispatch/HashSwitch_16Types_Random") { MeasureSwitchDispatch(state, true); }
+DMK_BENCHMARK("Thread/CommandDispatch/JumpTable_16Types_Cyclic") { MeasureJumpTableDispatch(state, false); }
+DMK_BENCHMARK("Thread/CommandDispatch/JumpTable_16Types_Random") { MeasureJumpTableDispatch(state, true); }
@@ -0,0 +1,369 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Harness/Benchmark.h"
+
+#include "Thread/Commands/CommandQueue.h"
+#include "Thread/Commands/CommandRing.h"
+
+#include <atomic>
+#include <ctime>
+#include <thread>
+
+using namespace DMK;
+using namespace DMK::Benchmarks;
+
+namespace
+{
+	/**
+	 * Benchmark command.
+	 */
+	struct EchoCommand {
+		UI64 mValue = 0;
+	};
+
+	/**
+	 * Stop command.
+	 */
+	struct StopCommand {};
+
+	/**
+	 * Consumer thread function, written like the backend thread functions.
+	 *
+	 * @param pCommandQueue: The command queue.
+	 * @param pProcessedCount: The number of processed commands.
+	 * @param bShouldPoll: Whether to poll Count() like the engine used to, instead of waiting for commands.
+	 */
+	void ConsumerFunction(Thread::CommandQueue<THREAD_MAX_COMMAND_COUNT>* pCommandQueue, std::atomic<UI64>* pProcessedCount, bool bShouldPoll)
+	{
+		bool bShouldRun = true;
+
+		do {
+			if (bShouldPoll ? pCommandQueue->Count() : pCommandQueue->WaitForCommand())
+			{
+				auto pCommand = pCommandQueue->GetCommand();
+				SET_COMMAND_EXECUTING(pCommand);
+
+				switch (pCommand->GetCommandID())
+				{
+				case TypeId<EchoCommand>():
+					DoNotOptimize(pCommand->GetData<EchoCommand>().mValue);
+					SET_COMMAND_SUCCESS(pCommand);
+					break;
+
+				case TypeId<StopCommand>():
+					SET_COMMAND_SUCCESS(pCommand);
+					bShouldRun = false;
+					break;
+
+				default:
+					SET_COMMAND_FAILED(pCommand);
+					break;
+				}
+
+				pCommandQueue->PopCommand();
+
+				pProcessedCount->fetch_add(1, std::memory_order_release);
+			}
+		} while (bShouldRun);
+	}
+
+	/**
+	 * Consumer Thread object.
+	 * Runs the consumer on its own thread and stops it when destroyed.
+	 */
+	class ConsumerThread {
+	public:
+		ConsumerThread(const BenchmarkState& state, bool bShouldPoll = false)
+		{
+			mThread = std::thread([this, &state, bShouldPoll]
+				{
+					state.PinWorkerThread(0);
+					ConsumerFunction(&mCommandQueue, &mProcessedCount, bShouldPoll);
+				});
+		}
+
+		~ConsumerThread()
+		{
+			mCommandQueue.PushCommand<StopCommand>();
+			mThread.join();
+		}
+
+		Thread::CommandQueue<THREAD_MAX_COMMAND_COUNT> mCommandQueue;	// The command queue.
+		std::atomic<UI64> mProcessedCount = { 0 };	// The number of processed commands.
+
+	private:
+		std::thread mThread;	// The consumer thread.
+	};
+}
+
+DMK_BENCHMARK("Thread/CommandQueue/RoundTrip")
+{
+	ConsumerThread consumer(state);
+	UI64 value = 0;
+
+	state.Run([&]
+		{
+			// The consumer writes the state from its thread, so read it as volatile like the engine does.
+			Thread::CommandState commandState = Thread::CommandState::PENDING;
+			consumer.mCommandQueue.PushCommand(EchoCommand{ value++ }, &commandState);
+
+			while (*static_cast<volatile Thread::CommandState*>(&commandState) != Thread::CommandState::SUCCESS);
+		});
+}
+
+DMK_BENCHMARK("Thread/CommandQueue/RoundTrip_Future")
+{
+	ConsumerThread consumer(state);
+	UI64 value = 0;
+
+	state.Run([&]
+		{
+			auto future = consumer.mCommandQueue.PushCommandAsync(EchoCommand{ value++ });
+			future.Wait();
+		});
+}
+
+DMK_BENCHMARK("Thread/CommandQueue/Throughput")
+{
+	ConsumerThread consumer(state);
+	UI64 value = 0;
+
+	state.SetItemsPerIteration(1);
+	state.Measure([&](UI64 iterations) -> double
+		{
+			const UI64 targetCount = consumer.mProcessedCount.load(std::memory_order_acquire) + iterations;
+			const auto beginTime = std::chrono::steady_clock::now();
+
+			for (UI64 index = 0; index < iterations; index++)
+				consumer.mCommandQueue.PushCommand(EchoCommand{ value++ });
+
+			while (consumer.mProcessedCount.load(std::memory_order_acquire) < targetCount);
+
+			return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - beginTime).count());
+		});
+}
+
+namespace
+{
+	/**
+	 * Measure the CPU time the process uses while the consumer is idle, as a percentage of one core.
+	 */
+	void MeasureIdleCPU(BenchmarkState& state, bool bShouldPoll)
+	{
+		ConsumerThread consumer(state, bShouldPoll);
+		double cpuPercent = 0.0;
+
+		state.SetIterations(4);
+		state.Run([&]
+			{
+				const std::clock_t beginClock = std::clock();
+				std::this_thread::sleep_for(std::chrono::milliseconds(50));
+				cpuPercent = 100.0 * static_cast<double>(std::clock() - beginClock) / CLOCKS_PER_SEC / 0.05;
+			});
+
+		state.SetCounter("idle_cpu_percent", cpuPercent);
+	}
+
+	/**
+	 * Measure the time from a push until the consumer executes the command, after the consumer has been idle
+	 * long enough to park.
+	 */
+	void MeasureWakeUpLatency(BenchmarkState& state, bool bShouldPoll)
+	{
+		ConsumerThread consumer(state, bShouldPoll);
+		UI64 value = 0;
+
+		state.SetIterations(32);
+		state.Measure([&](UI64 iterations) -> double
+			{
+				double totalTime = 0.0;
+				for (UI64 index = 0; index < iterations; index++)
+				{
+					std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+					Thread::CommandState commandState = Thread::CommandState::PENDING;
+					const auto beginTime = std::chrono::steady_clock::now();
+					consumer.mCommandQueue.PushCommand(EchoCommand{ value++ }, &commandState);
+
+					while (*static_cast<volatile Thread::CommandState*>(&commandState) != Thread::CommandState::SUCCESS);
+					totalTime += static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - beginTime).count());
+				}
+
+				return totalTime;
+			});
+	}
+}
+
+DMK_BENCHMARK("Thread/CommandQueue/IdleCPU_Polling") { MeasureIdleCPU(state, true); }
+DMK_BENCHMARK("Thread/CommandQueue/IdleCPU_Blocking") { MeasureIdleCPU(state, false); }
+DMK_BENCHMARK("Thread/CommandQueue/WakeUpLatency_Polling") { MeasureWakeUpLatency(state, true); }
+DMK_BENCHMARK("Thread/CommandQueue/WakeUpLatency_Blocking") { MeasureWakeUpLatency(state, false); }
+
+namespace
+{
+	/**
+	 * Push commands to a queue and wait till they are processed.
+	 */
+	void PushAndWait(ConsumerThread& consumer, UI64 commandCount)
+	{
+		const UI64 targetCount = consumer.mProcessedCount.load(std::memory_order_acquire) + commandCount;
+
+		for (UI64 index = 0; index < commandCount; index++)
+			consumer.mCommandQueue.PushCommand(EchoCommand{ index });
+
+		while (consumer.mProcessedCount.load(std::memory_order_acquire) < targetCount)
+			std::this_thread::yield();
+	}
+}
+
+DMK_BENCHMARK("Thread/CommandQueue/Contention_GraphicsAndAudio")
+{
+	// Two engines, each with its own queue and backend thread, fed by two producer threads at the same time.
+	ConsumerThread graphicsConsumer(state);
+	ConsumerThread audioConsumer(state);
+
+	state.SetItemsPerIteration(2);
+	state.Measure([&](UI64 iterations) -> double
+		{
+			const auto beginTime = std::chrono::steady_clock::now();
+
+			std::thread graphicsProducer([&] { PushAndWait(graphicsConsumer, iterations); });
+			PushAndWait(audioConsumer, iterations);
+			graphicsProducer.join();
+
+			return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - beginTime).count());
+		});
+}
+
+DMK_BENCHMARK("Thread/CommandQueue/Contention_4Producers")
+{
+	// Four producer threads pushing to the same queue.
+	ConsumerThread consumer(state);
+
+	state.SetItemsPerIteration(4);
+	state.Measure([&](UI64 iterations) -> double
+		{
+			const UI64 targetCount = consumer.mProcessedCount.load(std::memory_order_acquire) + iterations * 4;
+			const auto beginTime = std::chrono::steady_clock::now();
+
+			std::thread producers[4];
+			for (auto& producer : producers)
+				producer = std::thread([&]
+					{
+						for (UI64 index = 0; index < iterations; index++)
+							consumer.mCommandQueue.PushCommand(EchoCommand{ index });
+					});
+
+			for (auto& producer : producers)
+				producer.join();
+
+			while (consumer.mProcessedCount.load(std::memory_order_acquire) < targetCount)
+				std::this_thread::yield();
+
+			return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - beginTime).count());
+		});
+}
+
+namespace
+{
+	constexpr UI64 RingBatchSize = 16;	// Commands pushed per PushCommands() call.
+
+	using BenchmarkCommandRegistry = Thread::CommandRegistry<EchoCommand, StopCommand>;
+
+	/**
+	 * Command handler of the ring consumer.
+	 */
+	struct RingCommandHandler {
+		bool operator()(Thread::Command<EchoCommand>& command)
+		{
+			DoNotOptimize(command->mValue);
+			pProcessedCount->fetch_add(1, std::memory_order_release);
+			return true;
+		}
+
+		bool operator()(Thread::Command<StopCommand>&)
+		{
+			bShouldRun = false;
+			return true;
+		}
+
+		std::atomic<UI64>* pProcessedCount = nullptr;	// The number of processed commands.
+		bool bShouldRun = true;	// Consumer loop state.
+	};
+
+	/**
+	 * Ring Consumer Thread object.
+	 * Runs a command ring consumer on its own thread and stops it when destroyed.
+	 */
+	class RingConsumerThread {
+	public:
+		RingConsumerThread(const BenchmarkState& state)
+		{
+			mThread = std::thread([this, &state]
+				{
+					state.PinWorkerThread(0);
+
+					RingCommandHandler handler;
+					handler.pProcessedCount = &mProcessedCount;
+
+					while (handler.bShouldRun)
+					{
+						mCommandRing.WaitForCommands();
+						mCommandRing.ExecuteCommands<BenchmarkCommandRegistry>(handler);
+					}
+				});
+		}
+
+		~RingConsumerThread()
+		{
+			mCommandRing.PushCommand<StopCommand>();
+			mThread.join();
+		}
+
+		Thread::CommandRing<> mCommandRing;	// The command ring.
+		std::atomic<UI64> mProcessedCount = { 0 };	// The number of processed commands.
+
+	private:
+		std::thread mThread;	// The consumer thread.
+	};
+
+	/**
+	 * Measure the command throughput of the ring.
+	 *
+	 * @param batchSize: The number of commands pushed per call.
+	 */
+	void MeasureRingThroughput(BenchmarkState& state, UI64 batchSize)
+	{
+		RingConsumerThread consumer(state);
+		UI64 value = 0;
+
+		state.SetItemsPerIteration(batchSize);
+		state.Measure([&](UI64 iterations) -> double
+			{
+				const UI64 targetCount = consumer.mProcessedCount.load(std::memory_order_acquire) + iterations * batchSize;
+				const auto beginTime = std::chrono::steady_clock::now();
+
+				for (UI64 index = 0; index < iterations; index++)
+				{
+					if (batchSize == 1)
+						consumer.mCommandRing.PushCommand(EchoCommand{ value++ });
+					else
+					{
+						EchoCommand commands[RingBatchSize] = {};
+						for (auto& command : commands)
+							command.mValue = value++;
+
+						consumer.mCommandRing.PushCommandRange(commands, RingBatchSize);
+					}
+				}
+
+				while (consumer.mProcessedCount.load(std::memory_order_acquire) < targetCount);
+
+				return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - beginTime).count());
+			});
+	}
+}
+
+DMK_BENCHMARK("Thread/CommandRing/Throughput") { MeasureRingThroughput(state, 1); }
+DMK_BENCHMARK("Thread/CommandRing/Throughput_Batch16") { MeasureRingThroughput(state, RingBatchSize); }
@@ -0,0 +1,249 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Harness/AllocationCounter.h"
+#include "Harness/Benchmark.h"
+
+#include "AudioCore/Commands/CommandRegistry.h"
+#include "Thread/Commands/CommandReplayer.h"
+#include "Thread/FramePacer.h"
+
+#include <atomic>
+#include <random>
+#include <thread>
+
+using namespace DMK;
+using namespace DMK::Benchmarks;
+using namespace DMK::AudioCore::Commands;
+
+namespace
+{
+	constexpr UI64 TrafficCommandCount = 4096;	// Commands of the recording replayed at maximum speed.
+	constexpr UI64 PacedCommandCount = 100;	// Commands of the recording replayed at recorded speed.
+	constexpr double PacedFrequency = 1000.0;	// Rate the paced recording is made at, in hertz.
+
+	using AudioRecorder = Thread::CommandRecorder<AudioCommandRegistry>;
+	using AudioReplayer = Thread::CommandReplayer<AudioCommandRegistry>;
+
+	/**
+	 * Stand in for an audio backend. It does a little work per command so the loop, not the handler, is
+	 * measured.
+	 */
+	struct NullAudioHandler {
+		bool operator()(Thread::Command<InitializeBackend>&) { return true; }
+		bool operator()(Thread::Command<TerminateBackend>&) { bShouldRun = false; return true; }
+		bool operator()(Thread::Command<LoadAudioFromFile>& command) { mChecksum += command->pAsset[0]; return true; }
+		bool operator()(Thread::Command<GetAudioObjectCache>& command) { mChecksum += command->mHandle.mHandle; return true; }
+		bool operator()(Thread::Command<DirectPlayback>& command) { mChecksum += command->loopCount; return true; }
+		bool operator()(Thread::Command<BufferedPlayback>& command) { mChecksum += command->mHandle.mHandle; return true; }
+
+		UI64 mChecksum = 0;	// Keeps the work from being optimized away.
+		bool bShouldRun = true;	// Whether the backend loop should continue.
+	};
+
+	/**
+	 * Backend thread which runs a command loop written like the audio backend function.
+	 */
+	class NullAudioBackend {
+	public:
+		NullAudioBackend(const BenchmarkState& state)
+		{
+			mThread = std::thread([this, &state]
+				{
+					state.PinWorkerThread(0);
+
+					NullAudioHandler handler;
+					do {
+						if (mCommandQueue.WaitForCommand())
+						{
+							auto pCommand = mCommandQueue.GetCommand();
+							pCommand->SetState(Thread::CommandDispatcher<AudioCommandRegistry>::Dispatch(handler, pCommand));
+							mCommandQueue.PopCommand();
+
+							mProcessedCount.fetch_add(1, std::memory_order_release);
+						}
+					} while (handler.bShouldRun);
+
+					DoNotOptimize(handler.mChecksum);
+				});
+		}
+
+		~NullAudioBackend()
+		{
+			mCommandQueue.SetRecorder(nullptr);
+			mCommandQueue.PushCommand<TerminateBackend>();
+			mThread.join();
+		}
+
+		/**
+		 * Wait till the backend has executed a number of commands.
+		 */
+		void WaitForProcessedCount(UI64 count) const
+		{
+			while (mProcessedCount.load(std::memory_order_acquire) < count)
+				Thread::Utilities::Pause();
+		}
+
+		Thread::CommandQueue<THREAD_MAX_COMMAND_COUNT> mCommandQueue;	// The backend command queue.
+		std::atomic<UI64> mProcessedCount = { 0 };	// The number of executed commands.
+
+	private:
+		std::thread mThread;	// The backend thread.
+	};
+
+	/**
+	 * Record one command of a repeatable mix of audio traffic: mostly buffered playbacks, with some loads,
+	 * cache queries and direct playbacks of files.
+	 */
+	void RecordTrafficCommand(AudioRecorder& recorder, std::mt19937& engine)
+	{
+		static const wchar* pAssets[] = { L"Assets/Audio/Step.wav", L"Assets/Audio/Explosion.wav", L"Assets/Audio/Music.mp3" };
+
+		AudioCore::AudioObjectHandle handle;
+		handle.pName = "Step";
+		handle.mHandle = engine() % 16;
+
+		const UI32 roll = engine() % 16;
+		if (roll == 0)
+			recorder.Record(LoadAudioFromFile(pAssets[engine() % 3]));
+		else if (roll == 1)
+			recorder.Record(GetAudioObjectCache(handle));
+		else if (roll == 2)
+			recorder.Record(DirectPlayback(pAssets[engine() % 3], 1, 0.5f));
+		else
+			recorder.Record(BufferedPlayback(handle, nullptr, 1, 0.8f));
+	}
+
+	/**
+	 * Create the recording replayed at maximum speed.
+	 */
+	const std::vector<BYTE>& GetTrafficRecording()
+	{
+		static const std::vector<BYTE> recording = []
+		{
+			AudioRecorder recorder;
+			std::mt19937 engine(42);
+
+			for (UI64 index = 0; index < TrafficCommandCount; index++)
+				RecordTrafficCommand(recorder, engine);
+
+			return recorder.GetData();
+		}();
+
+		return recording;
+	}
+
+	/**
+	 * Measure the rate commands are pushed at to a backend, with or without a recorder on the queue, and the
+	 * allocations the producer makes per command.
+	 */
+	void MeasurePush(BenchmarkState& state, bool bShouldRecord)
+	{
+		NullAudioBackend backend(state);
+		AudioRecorder recorder;
+		if (bShouldRecord)
+			backend.mCommandQueue.SetRecorder(&recorder);
+
+		AudioCore::AudioObjectHandle handle;
+		handle.pName = "Step";
+
+		UI64 allocationCount = 0;
+		UI64 pushCount = 0;
+
+		state.SetItemsPerIteration(1);
+		state.Measure([&](UI64 iterations) -> double
+			{
+				const UI64 targetCount = backend.mProcessedCount.load(std::memory_order_acquire) + iterations;
+				const UI64 beginAllocationCount = GetThreadAllocationCount();
+				const auto beginTime = Thread::Utilities::Clock::now();
+
+				for (UI64 index = 0; index < iterations; index++)
+					backend.mCommandQueue.PushCommand(BufferedPlayback(handle, nullptr, 1, 0.8f));
+
+				allocationCount += GetThreadAllocationCount() - beginAllocationCount;
+				pushCount += iterations;
+
+				backend.WaitForProcessedCount(targetCount);
+				return static_cast<double>(std::chrono::duration_cast<Thread::Utilities::Nanoseconds>(Thread::Utilities::Clock::now() - beginTime).count());
+			});
+
+		state.SetCounter("allocations_per_command", static_cast<double>(allocationCount) / static_cast<double>(std::max<UI64>(pushCount, 1)));
+
+		if (bShouldRecord)
+			state.SetCounter("bytes_per_command", static_cast<double>(recorder.GetData().size()) / static_cast<double>(std::max<UI64>(recorder.GetCommandCount(), 1)));
+	}
+}
+
+DMK_BENCHMARK("Thread/CommandReplay/Push_Unrecorded") { MeasurePush(state, false); }
+DMK_BENCHMARK("Thread/CommandReplay/Push_Recorded") { MeasurePush(state, true); }
+
+DMK_BENCHMARK("Thread/CommandReplay/Dispatch_MaximumSpeed")
+{
+	AudioReplayer replayer;
+	replayer.Load(GetTrafficRecording());
+
+	NullAudioHandler handler;
+	state.SetItemsPerIteration(TrafficCommandCount);
+	state.Run([&]
+		{
+			replayer.Dispatch(handler);
+			replayer.ReleaseStrings();
+		});
+
+	DoNotOptimize(handler.mChecksum);
+	state.SetCounter("recording_bytes", static_cast<double>(GetTrafficRecording().size()));
+}
+
+DMK_BENCHMARK("Thread/CommandReplay/Replay_MaximumSpeed")
+{
+	NullAudioBackend backend(state);
+
+	AudioReplayer replayer;
+	replayer.Load(GetTrafficRecording());
+
+	state.SetItemsPerIteration(TrafficCommandCount);
+	state.Run([&]
+		{
+			const UI64 targetCount = backend.mProcessedCount.load(std::memory_order_acquire) + TrafficCommandCount;
+			replayer.Replay(backend.mCommandQueue, Thread::CommandReplaySpeed::MAXIMUM);
+
+			backend.WaitForProcessedCount(targetCount);
+			replayer.ReleaseStrings();
+		});
+}
+
+DMK_BENCHMARK("Thread/CommandReplay/Replay_Recorded_1kHz")
+{
+	// Record traffic at a fixed rate, then check how closely the replays follow it.
+	AudioRecorder recorder;
+	std::mt19937 engine(42);
+
+	UI64 recordedCount = 0;
+	Thread::FramePacer pacer(Thread::Utilities::GetPeriod(PacedFrequency));
+	pacer.Run([&]
+		{
+			RecordTrafficCommand(recorder, engine);
+			return ++recordedCount < PacedCommandCount;
+		});
+
+	NullAudioBackend backend(state);
+
+	AudioReplayer replayer;
+	replayer.Load(recorder.GetData());
+
+	Thread::CommandReplayStatistics statistics;
+	state.SetIterations(4);
+	state.SetItemsPerIteration(PacedCommandCount);
+	state.Run([&]
+		{
+			const UI64 targetCount = backend.mProcessedCount.load(std::memory_order_acquire) + PacedCommandCount;
+			statistics = replayer.Replay(backend.mCommandQueue, Thread::CommandReplaySpeed::RECORDED);
+
+			backend.WaitForProcessedCount(targetCount);
+			replayer.ReleaseStrings();
+		});
+
+	state.SetCounter("recorded_ms", Thread::Utilities::ToMilliseconds(replayer.GetDuration()));
+	state.SetCounter("replayed_ms", Thread::Utilities::ToMilliseconds(statistics.mElapsedTime));
+	state.SetCounter("max_lag_us", Thread::Utilities::ToMicroseconds(statistics.mMaxLag));
+}
@@ -0,0 +1,113 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Harness/Benchmark.h"
+
+#include "Thread/Coroutines/CoroutineExecutor.h"
+
+#include <chrono>
+#include <vector>
+
+using namespace DMK;
+using namespace DMK::Benchmarks;
+
+namespace
+{
+	constexpr UI64 FrameSize = 256;	// Frame size of the allocation benchmarks.
+	constexpr UI64 FrameBatchSize = 64;	// Frames alive at once in the allocation benchmarks.
+
+	/**
+	 * Leaf task. Completes without suspending.
+	 */
+	Thread::Task<UI64> Leaf(UI64 value)
+	{
+		co_return value;
+	}
+
+	/**
+	 * Await a number of leaf tasks. Every await creates a frame, switches to it and back, and frees it.
+	 */
+	Thread::Task<UI64> AwaitLeaves(UI64 count)
+	{
+		UI64 sum = 0;
+		for (UI64 index = 0; index < count; index++)
+			sum += co_await Leaf(index);
+
+		co_return sum;
+	}
+
+	/**
+	 * Move to a worker thread a number of times.
+	 */
+	Thread::Task<void> HopWorkers(Thread::CoroutineExecutor& executor, UI64 count)
+	{
+		for (UI64 index = 0; index < count; index++)
+			co_await executor.Schedule();
+	}
+
+	/**
+	 * Measure the time a function takes, in nanoseconds.
+	 */
+	template<class Function>
+	double MeasureNanoseconds(const Function& function)
+	{
+		const auto beginTime = std::chrono::steady_clock::now();
+		function();
+		return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - beginTime).count());
+	}
+}
+
+DMK_BENCHMARK("Thread/Coroutine/AwaitTask")
+{
+	state.SetItemsPerIteration(1);
+	state.Measure([](UI64 iterations) -> double
+		{
+			return MeasureNanoseconds([iterations] { DoNotOptimize(Thread::SyncWait(AwaitLeaves(iterations))); });
+		});
+}
+
+DMK_BENCHMARK("Thread/Coroutine/ResumeOnWorker")
+{
+	Thread::JobSystem system(1);
+	Thread::CoroutineExecutor executor(system);
+
+	state.SetItemsPerIteration(1);
+	state.Measure([&executor](UI64 iterations) -> double
+		{
+			return MeasureNanoseconds([&executor, iterations] { Thread::SyncWait(HopWorkers(executor, iterations)); });
+		});
+}
+
+DMK_BENCHMARK("Thread/Coroutine/FrameAllocation_Pool")
+{
+	std::vector<void*> frames(FrameBatchSize);
+
+	state.SetItemsPerIteration(FrameBatchSize);
+	state.Run([&]
+		{
+			for (void*& pFrame : frames)
+				pFrame = Thread::CoroutineFramePool::Allocate(FrameSize);
+
+			DoNotOptimize(frames.data());
+
+			for (void* pFrame : frames)
+				Thread::CoroutineFramePool::Deallocate(pFrame, FrameSize);
+		});
+}
+
+DMK_BENCHMARK("Thread/Coroutine/FrameAllocation_GlobalHeap")
+{
+	std::vector<void*> frames(FrameBatchSize);
+
+	state.SetItemsPerIteration(FrameBatchSize);
+	state.Run([&]
+		{
+			for (void*& pFrame : frames)
+				pFrame = ::operator new(FrameSize);
+
+			DoNotOptimize(frames.data());
+
+			for (void* pFrame : frames)
+				::operator delete(pFrame);
+		});
+}
@@ -0,0 +1,95 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Harness/Benchmark.h"
+
+#include "Thread/FramePacer.h"
+
+#include <thread>
+
+using namespace DMK;
+using namespace DMK::Benchmarks;
+
+namespace
+{
+	constexpr Thread::Utilities::Duration SleepDuration = Thread::Utilities::Milliseconds(1);	// Requested sleep of the sleep benchmarks.
+	constexpr double PacerFrequency = 1000.0;	// Rate of the pacing benchmarks, in hertz.
+
+	/**
+	 * Measure a sleep function and report how much later than requested it returned.
+	 */
+	template<class Function>
+	void MeasureSleep(BenchmarkState& state, const Function& function)
+	{
+		Benchmark::LatencyHistogram overshoots;
+
+		state.SetItemsPerIteration(1);
+		state.Measure([&](UI64 iterations) -> double
+			{
+				const auto beginTime = Thread::Utilities::Clock::now();
+				for (UI64 iteration = 0; iteration < iterations; iteration++)
+				{
+					const auto deadline = Thread::Utilities::Clock::now() + SleepDuration;
+					function();
+					overshoots.Record(static_cast<UI64>(std::chrono::duration_cast<Thread::Utilities::Nanoseconds>(Thread::Utilities::Clock::now() - deadline).count()));
+				}
+
+				return static_cast<double>(std::chrono::duration_cast<Thread::Utilities::Nanoseconds>(Thread::Utilities::Clock::now() - beginTime).count());
+			});
+
+		state.SetCounter("overshoot_mean_us", overshoots.GetMean() / 1000.0);
+		state.SetCounter("overshoot_p99_us", static_cast<double>(overshoots.GetPercentile(99.0)) / 1000.0);
+		state.SetCounter("overshoot_max_us", static_cast<double>(overshoots.GetMax()) / 1000.0);
+	}
+
+	/**
+	 * Pace a loop and report the jitter of the frames.
+	 */
+	void MeasurePacer(BenchmarkState& state, Thread::Utilities::Duration spinThreshold)
+	{
+		Thread::FramePacer pacer(Thread::Utilities::GetPeriod(PacerFrequency), spinThreshold);
+		Thread::FramePacerStatistics statistics;
+
+		state.SetItemsPerIteration(1);
+		state.Measure([&](UI64 iterations) -> double
+			{
+				const auto beginTime = Thread::Utilities::Clock::now();
+
+				UI64 frame = 0;
+				pacer.Run([&frame, iterations] { return frame++ < iterations; });
+				statistics = pacer.GetStatistics();
+
+				return static_cast<double>(std::chrono::duration_cast<Thread::Utilities::Nanoseconds>(Thread::Utilities::Clock::now() - beginTime).count());
+			});
+
+		state.SetCounter("jitter_mean_us", Thread::Utilities::ToMicroseconds(statistics.mMeanJitter));
+		state.SetCounter("jitter_stddev_us", Thread::Utilities::ToMicroseconds(statistics.mJitterStandardDeviation));
+		state.SetCounter("jitter_p99_us", Thread::Utilities::ToMicroseconds(statistics.mPercentile99Jitter));
+		state.SetCounter("missed_frames", static_cast<double>(statistics.mMissedFrameCount));
+	}
+}
+
+DMK_BENCHMARK("Thread/Sleep/StdSleepFor_1ms")
+{
+	MeasureSleep(state, [] { std::this_thread::sleep_for(SleepDuration); });
+}
+
+DMK_BENCHMARK("Thread/Sleep/Sleep_1ms_NoSpin")
+{
+	MeasureSleep(state, [] { Thread::Utilities::Sleep(SleepDuration, Thread::Utilities::Duration::zero()); });
+}
+
+DMK_BENCHMARK("Thread/Sleep/Sleep_1ms")
+{
+	MeasureSleep(state, [] { Thread::Utilities::Sleep(SleepDuration); });
+}
+
+DMK_BENCHMARK("Thread/FramePacer/Pace_1kHz_NoSpin")
+{
+	MeasurePacer(state, Thread::Utilities::Duration::zero());
+}
+
+DMK_BENCHMARK("Thread/FramePacer/Pace_1kHz")
+{
+	MeasurePacer(state, Thread::Utilities::DefaultSpinThreshold);
+}
@@ -0,0 +1,150 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Harness/Benchmark.h"
+
+#include "Thread/Jobs/ParallelFor.h"
+#include "Thread/Jobs/JobGraph.h"
+
+#include <cmath>
+#include <memory>
+#include <thread>
+
+using namespace DMK;
+using namespace DMK::Benchmarks;
+
+namespace
+{
+	constexpr UI32 ThreadCounts[] = { 1, 2, 4, 8, 16, 32, 64 };	// Thread counts of the scaling sweep.
+	constexpr UI64 ElementCount = 1 << 20;	// Elements processed by the parallel for benchmarks.
+	constexpr UI64 EmptyJobCount = 4096;	// Jobs scheduled by the scheduling benchmark.
+	constexpr UI64 GraphLayerCount = 8;	// Layers of the job graph benchmark.
+	constexpr UI64 GraphLayerWidth = 32;	// Nodes per layer of the job graph benchmark.
+
+	/**
+	 * Some arithmetic, so that a job is not limited by memory bandwidth.
+	 */
+	float Compute(float value)
+	{
+		for (UI32 index = 0; index < 16; index++)
+			value = std::sqrt(value * value + 1.0f) * 0.5f;
+
+		return value;
+	}
+
+	/**
+	 * Create a job system with a total thread count, or skip the benchmark if the machine has fewer hardware
+	 * threads. Oversubscribed measurements do not say anything about scaling.
+	 */
+	std::unique_ptr<Thread::JobSystem> CreateJobSystem(BenchmarkState& state, UI32 threadCount, bool bShouldPinWorkers = false)
+	{
+		if (threadCount > std::thread::hardware_concurrency())
+		{
+			state.Skip("Not enough hardware threads");
+			return nullptr;
+		}
+
+		state.SetCounter("threads", static_cast<double>(threadCount));
+
+		Thread::JobSystemCreateInfo createInfo;
+		createInfo.mWorkerCount = threadCount - 1;
+		createInfo.bShouldPinWorkers = bShouldPinWorkers;
+
+		if (bShouldPinWorkers)
+		{
+			const Thread::CPUTopology& topology = Thread::CPUTopology::Get();
+			state.SetCounter("cores", static_cast<double>(topology.GetCoreCount()));
+			state.SetCounter("l3_domains", static_cast<double>(topology.GetL3DomainCount()));
+		}
+
+		return std::make_unique<Thread::JobSystem>(createInfo);
+	}
+
+	void ParallelForCompute(BenchmarkState& state, UI32 threadCount, bool bShouldPinWorkers)
+	{
+		auto pSystem = CreateJobSystem(state, threadCount, bShouldPinWorkers);
+		if (!pSystem)
+			return;
+
+		std::vector<float> values(ElementCount, 1.0f);
+
+		state.SetItemsPerIteration(ElementCount);
+		state.Run([&]
+			{
+				Thread::ParallelFor(*pSystem, 0, ElementCount, 0, [&values](UI64 index) { values[index] = Compute(values[index]); });
+			});
+	}
+
+	void ScheduleEmptyJobs(BenchmarkState& state, UI32 threadCount)
+	{
+		auto pSystem = CreateJobSystem(state, threadCount);
+		if (!pSystem)
+			return;
+
+		state.SetItemsPerIteration(EmptyJobCount);
+		state.Run([&]
+			{
+				Thread::JobCounter counter;
+				for (UI64 index = 0; index < EmptyJobCount; index++)
+					pSystem->Schedule([] {}, &counter);
+
+				pSystem->Wait(counter);
+			});
+	}
+
+	void ExecuteJobGraph(BenchmarkState& state, UI32 threadCount)
+	{
+		auto pSystem = CreateJobSystem(state, threadCount);
+		if (!pSystem)
+			return;
+
+		// Every node depends on two nodes of the previous layer.
+		std::vector<float> values(GraphLayerCount * GraphLayerWidth * 1024, 1.0f);
+		Thread::JobGraph graph;
+
+		for (UI64 layer = 0; layer < GraphLayerCount; layer++)
+		{
+			for (UI64 column = 0; column < GraphLayerWidth; column++)
+			{
+				float* pValues = values.data() + (layer * GraphLayerWidth + column) * 1024;
+				const UI64 node = graph.AddNode([pValues]
+					{
+						for (UI64 index = 0; index < 1024; index++)
+							pValues[index] = Compute(pValues[index]);
+					});
+
+				if (layer)
+				{
+					const UI64 previousLayer = (layer - 1) * GraphLayerWidth;
+					graph.AddDependency(previousLayer + column, node);
+					graph.AddDependency(previousLayer + (column + 1) % GraphLayerWidth, node);
+				}
+			}
+		}
+
+		state.SetItemsPerIteration(graph.GetNodeCount());
+		state.Run([&]
+			{
+				graph.Execute(*pSystem);
+			});
+	}
+
+	/**
+	 * Register the scaling sweep.
+	 */
+	struct JobSystemRegistrar {
+		JobSystemRegistrar()
+		{
+			for (const UI32 threadCount : ThreadCounts)
+			{
+				// Zero padded, so that the sweep is listed in order.
+				const String suffix = (threadCount < 10 ? "_T0" : "_T") + std::to_string(threadCount);
+
+				RegisterBenchmark("Thread/JobSystem/ParallelFor_Compute_1M" + suffix, [threadCount](BenchmarkState& state) { ParallelForCompute(state, threadCount, false); });
+				RegisterBenchmark("Thread/JobSystem/ParallelFor_Compute_1M_Pinned" + suffix, [threadCount](BenchmarkState& state) { ParallelForCompute(state, threadCount, true); });
+				RegisterBenchmark("Thread/JobSystem/Schedule_EmptyJobs_4096" + suffix, [threadCount](BenchmarkState& state) { ScheduleEmptyJobs(state, threadCount); });
+				RegisterBenchmark("Thread/JobSystem/JobGraph_8x32" + suffix, [threadCount](BenchmarkState& state) { ExecuteJobGraph(state, threadCount); });
+			}
+		}
+	} Registrar;
+}
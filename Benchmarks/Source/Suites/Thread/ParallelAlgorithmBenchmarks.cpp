@@ -0,0 +1,246 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Harness/Benchmark.h"
+
+#include "Thread/Jobs/ParallelCompact.h"
+#include "Thread/Jobs/ParallelScan.h"
+#include "Thread/Jobs/ParallelSort.h"
+
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <random>
+#include <vector>
+#include <version>
+
+#if defined(__cpp_lib_parallel_algorithm)
+#include <execution>
+
+#endif
+
+using namespace DMK;
+using namespace DMK::Benchmarks;
+
+namespace
+{
+	constexpr UI64 ElementCount = 10000000;	// Elements processed per iteration.
+	constexpr UI32 KeptFraction = 4;	// One in this many elements is kept by the compaction benchmarks.
+
+	/**
+	 * Create the random input shared by the benchmarks.
+	 */
+	const std::vector<UI32>& GetInput()
+	{
+		static const std::vector<UI32> input = []
+		{
+			std::vector<UI32> values(ElementCount);
+			std::mt19937 engine(42);
+			for (UI32& value : values)
+				value = engine();
+
+			return values;
+		}();
+
+		return input;
+	}
+
+	/**
+	 * Measure a sort. Every iteration sorts a fresh copy of the input, and only the sort is timed.
+	 */
+	template<class Function>
+	void MeasureSort(BenchmarkState& state, const Function& function)
+	{
+		const std::vector<UI32>& input = GetInput();
+		std::vector<UI32> values(input.size());
+
+		state.SetItemsPerIteration(ElementCount);
+		state.Measure([&](UI64 iterations) -> double
+			{
+				double nanoseconds = 0.0;
+				for (UI64 iteration = 0; iteration < iterations; iteration++)
+				{
+					std::copy(input.begin(), input.end(), values.begin());
+
+					const auto beginTime = std::chrono::steady_clock::now();
+					function(values);
+					nanoseconds += static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - beginTime).count());
+				}
+
+				DoNotOptimize(values.data());
+				return nanoseconds;
+			});
+	}
+
+	/**
+	 * Skip the std::execution benchmarks where the standard library does not have them.
+	 */
+	bool HasExecutionPolicies([[maybe_unused]] BenchmarkState& state)
+	{
+#if defined(__cpp_lib_parallel_algorithm)
+		return true;
+
+#else
+		state.Skip("std::execution is not available");
+		return false;
+
+#endif
+	}
+}
+
+DMK_BENCHMARK("Thread/ParallelAlgorithms/Sort_Radix_10M")
+{
+	Thread::JobSystem system;
+	MeasureSort(state, [&system](std::vector<UI32>& values) { Thread::ParallelRadixSort(system, values.data(), values.size()); });
+}
+
+DMK_BENCHMARK("Thread/ParallelAlgorithms/Sort_Merge_10M")
+{
+	Thread::JobSystem system;
+	MeasureSort(state, [&system](std::vector<UI32>& values) { Thread::ParallelMergeSort(system, values.data(), values.size(), std::less<UI32>()); });
+}
+
+DMK_BENCHMARK("Thread/ParallelAlgorithms/Sort_StdSort_10M")
+{
+	MeasureSort(state, [](std::vector<UI32>& values) { std::sort(values.begin(), values.end()); });
+}
+
+DMK_BENCHMARK("Thread/ParallelAlgorithms/Sort_StdExecutionPar_10M")
+{
+	if (!HasExecutionPolicies(state))
+		return;
+
+#if defined(__cpp_lib_parallel_algorithm)
+	MeasureSort(state, [](std::vector<UI32>& values) { std::sort(std::execution::par, values.begin(), values.end()); });
+
+#endif
+}
+
+DMK_BENCHMARK("Thread/ParallelAlgorithms/Reduce_10M")
+{
+	Thread::JobSystem system;
+	const std::vector<UI32>& input = GetInput();
+
+	state.SetItemsPerIteration(ElementCount);
+	state.Run([&]
+		{
+			DoNotOptimize(Thread::ParallelReduce(system, input.data(), input.size(), UI32(0), std::plus<UI32>()));
+		});
+}
+
+DMK_BENCHMARK("Thread/ParallelAlgorithms/Reduce_StdAccumulate_10M")
+{
+	const std::vector<UI32>& input = GetInput();
+
+	state.SetItemsPerIteration(ElementCount);
+	state.Run([&]
+		{
+			DoNotOptimize(std::accumulate(input.begin(), input.end(), UI32(0)));
+		});
+}
+
+DMK_BENCHMARK("Thread/ParallelAlgorithms/Reduce_StdExecutionPar_10M")
+{
+	if (!HasExecutionPolicies(state))
+		return;
+
+#if defined(__cpp_lib_parallel_algorithm)
+	const std::vector<UI32>& input = GetInput();
+
+	state.SetItemsPerIteration(ElementCount);
+	state.Run([&]
+		{
+			DoNotOptimize(std::reduce(std::execution::par, input.begin(), input.end(), UI32(0)));
+		});
+
+#endif
+}
+
+DMK_BENCHMARK("Thread/ParallelAlgorithms/InclusiveScan_10M")
+{
+	Thread::JobSystem system;
+	const std::vector<UI32>& input = GetInput();
+	std::vector<UI32> output(input.size());
+
+	state.SetItemsPerIteration(ElementCount);
+	state.Run([&]
+		{
+			Thread::ParallelInclusiveScan(system, input.data(), output.data(), input.size());
+			DoNotOptimize(output.data());
+		});
+}
+
+DMK_BENCHMARK("Thread/ParallelAlgorithms/InclusiveScan_StdInclusiveScan_10M")
+{
+	const std::vector<UI32>& input = GetInput();
+	std::vector<UI32> output(input.size());
+
+	state.SetItemsPerIteration(ElementCount);
+	state.Run([&]
+		{
+			std::inclusive_scan(input.begin(), input.end(), output.begin());
+			DoNotOptimize(output.data());
+		});
+}
+
+DMK_BENCHMARK("Thread/ParallelAlgorithms/InclusiveScan_StdExecutionPar_10M")
+{
+	if (!HasExecutionPolicies(state))
+		return;
+
+#if defined(__cpp_lib_parallel_algorithm)
+	const std::vector<UI32>& input = GetInput();
+	std::vector<UI32> output(input.size());
+
+	state.SetItemsPerIteration(ElementCount);
+	state.Run([&]
+		{
+			std::inclusive_scan(std::execution::par, input.begin(), input.end(), output.begin());
+			DoNotOptimize(output.data());
+		});
+
+#endif
+}
+
+DMK_BENCHMARK("Thread/ParallelAlgorithms/Compact_10M")
+{
+	Thread::JobSystem system;
+	const std::vector<UI32>& input = GetInput();
+	std::vector<UI32> output(input.size());
+
+	state.SetItemsPerIteration(ElementCount);
+	state.Run([&]
+		{
+			DoNotOptimize(Thread::ParallelCompact(system, input.data(), input.size(), output.data(), [](UI32 value) { return value % KeptFraction == 0; }));
+		});
+}
+
+DMK_BENCHMARK("Thread/ParallelAlgorithms/Compact_StdCopyIf_10M")
+{
+	const std::vector<UI32>& input = GetInput();
+	std::vector<UI32> output(input.size());
+
+	state.SetItemsPerIteration(ElementCount);
+	state.Run([&]
+		{
+			DoNotOptimize(std::copy_if(input.begin(), input.end(), output.begin(), [](UI32 value) { return value % KeptFraction == 0; }));
+		});
+}
+
+DMK_BENCHMARK("Thread/ParallelAlgorithms/Compact_StdExecutionPar_10M")
+{
+	if (!HasExecutionPolicies(state))
+		return;
+
+#if defined(__cpp_lib_parallel_algorithm)
+	const std::vector<UI32>& input = GetInput();
+	std::vector<UI32> output(input.size());
+
+	state.SetItemsPerIteration(ElementCount);
+	state.Run([&]
+		{
+			DoNotOptimize(std::copy_if(std::execution::par, input.begin(), input.end(), output.begin(), [](UI32 value) { return value % KeptFraction == 0; }));
+		});
+
+#endif
+}
@@ -35,6 +35,7 @@ project "Audio"
 
 	links { 
 		"Core",
+		"Thread",
 		"AudioCore",
 		"XAudio2Backend",
 	}
@@ -3,6 +3,7 @@
 
 #include "Audio/Engine.h"
 #include "Core/ErrorHandler/Logger.h"
+#include "Thread/ThreadCreation.h"
 
 #include "XAudio2Backend/XAudio2BackendFunction.h"
 
@@ -19,7 +20,14 @@ namespace DMK
 			switch (mBackendType)
 			{
 			case DMK::Audio::AudioBackendType::X_AUDIO_2:
-				mBackendThread.swap(std::thread(XAudio2Backend::XAudio2BackendFunction, &mCommandQueue));
+			{
+				// The backend feeds the device, so it runs at real time priority where the process is allowed to.
+				Thread::ThreadCreateInfo createInfo;
+				createInfo.mName = "Audio Backend";
+				createInfo.mPriority = Thread::ThreadPriority::REAL_TIME;
+
+				mBackendThread = Thread::CreateThread(std::move(createInfo), XAudio2Backend::XAudio2BackendFunction, &mCommandQueue);
+			}
 				break;
 			default:
 				DMK_LOG_ERROR(TEXT("Invalid Audio Backend Type!"));
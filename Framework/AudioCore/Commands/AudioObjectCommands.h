@@ -13,9 +13,12 @@ namespace DMK
 		{
 			/**
 			 * Load Audio From File command.
-			 * This command loads audio data from a file and returns its handle to a defined pointer.
+			 * This command loads audio data from a file and returns its handle to a defined pointer, and to its
+			 * future when pushed asynchronously.
 			 */
 			struct LoadAudioFromFile {
+				using Result = AudioObjectHandle;	// The handle of the loaded audio object.
+
 				/**
 				 * Construct the command using the asset path and the handle pointer.
 				 *
@@ -34,13 +37,15 @@ namespace DMK
 			 * This command retrieves the cache of a given audio object handle.
 			 */
 			struct GetAudioObjectCache {
+				using Result = AudioObjectCache;	// The cache of the audio object.
+
 				/**
 				 * Construct the command using the audio object handle and the audio cache pointer.
 				 *
 				 * @param mHandle: The audio object handle.
-				 * @param pCache: The audio cache pointer.
+				 * @param pCache: The audio cache pointer. Default is nullptr.
 				 */
-				GetAudioObjectCache(const AudioObjectHandle& mHandle, AudioObjectCache* pCache)
+				GetAudioObjectCache(const AudioObjectHandle& mHandle, AudioObjectCache* pCache = nullptr)
 					: mHandle(mHandle), pCache(pCache) {}
 
 				AudioObjectHandle mHandle = {};	// Audio object handle.
@@ -0,0 +1,34 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "CoreCommands.h"
+#include "AudioObjectCommands.h"
+#include "PlaybackCommands.h"
+#include "CommandSerializers.h"
+
+#include "Thread/Commands/CommandRegistry.h"
+
+namespace DMK
+{
+	namespace AudioCore
+	{
+		namespace Commands
+		{
+			/**
+			 * Audio command registry.
+			 * Every audio backend handles these commands. Their serializers, used to record and replay the audio
+			 * command traffic, are in CommandSerializers.h.
+			 */
+			using AudioCommandRegistry = Thread::CommandRegistry<
+				InitializeBackend,
+				TerminateBackend,
+				LoadAudioFromFile,
+				GetAudioObjectCache,
+				DirectPlayback,
+				BufferedPlayback
+			>;
+		}
+	}
+}
@@ -0,0 +1,118 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "AudioObjectCommands.h"
+#include "PlaybackCommands.h"
+
+#include "Thread/Commands/CommandSerializer.h"
+
+namespace DMK
+{
+	namespace Thread
+	{
+		/**
+		 * Audio object handles are recorded with their name. The handle values are replayed as recorded, and are
+		 * written as variable length integers as they are usually small.
+		 */
+		template<>
+		struct CommandSerializer<AudioCore::AudioObjectHandle> {
+			static void Serialize(CommandWriter& writer, const AudioCore::AudioObjectHandle& handle)
+			{
+				writer.WriteString(handle.pName);
+				writer.WriteVarInt(handle.mHandle);
+				writer.WriteVarInt(handle.mLength);
+				writer.WriteVarInt(handle.mSampleRate);
+				writer.WriteVarInt(handle.mBytesPerSecond);
+				writer.Write(handle.mFormat);
+			}
+
+			static AudioCore::AudioObjectHandle Deserialize(CommandReader& reader)
+			{
+				AudioCore::AudioObjectHandle handle;
+				handle.pName = reader.ReadString<char>();
+				handle.mHandle = reader.ReadVarInt();
+				handle.mLength = reader.ReadVarInt();
+				handle.mSampleRate = reader.ReadVarInt();
+				handle.mBytesPerSecond = reader.ReadVarInt();
+				handle.mFormat = reader.Read<AudioCore::AudioFileFormat>();
+
+				return handle;
+			}
+		};
+
+		/**
+		 * The handle pointer is replayed as nullptr.
+		 */
+		template<>
+		struct CommandSerializer<AudioCore::Commands::LoadAudioFromFile> {
+			static void Serialize(CommandWriter& writer, const AudioCore::Commands::LoadAudioFromFile& command)
+			{
+				writer.WriteString(command.pAsset);
+			}
+
+			static AudioCore::Commands::LoadAudioFromFile Deserialize(CommandReader& reader)
+			{
+				return AudioCore::Commands::LoadAudioFromFile(reader.ReadString<wchar>());
+			}
+		};
+
+		/**
+		 * The cache pointer is replayed as nullptr.
+		 */
+		template<>
+		struct CommandSerializer<AudioCore::Commands::GetAudioObjectCache> {
+			static void Serialize(CommandWriter& writer, const AudioCore::Commands::GetAudioObjectCache& command)
+			{
+				CommandSerializer<AudioCore::AudioObjectHandle>::Serialize(writer, command.mHandle);
+			}
+
+			static AudioCore::Commands::GetAudioObjectCache Deserialize(CommandReader& reader)
+			{
+				return AudioCore::Commands::GetAudioObjectCache(CommandSerializer<AudioCore::AudioObjectHandle>::Deserialize(reader));
+			}
+		};
+
+		template<>
+		struct CommandSerializer<AudioCore::Commands::DirectPlayback> {
+			static void Serialize(CommandWriter& writer, const AudioCore::Commands::DirectPlayback& command)
+			{
+				writer.WriteString(command.pAsset);
+				writer.WriteVarInt(command.loopCount);
+				writer.Write(command.volumeFactor);
+			}
+
+			static AudioCore::Commands::DirectPlayback Deserialize(CommandReader& reader)
+			{
+				AudioCore::Commands::DirectPlayback command(reader.ReadString<wchar>());
+				command.loopCount = reader.ReadVarInt();
+				command.volumeFactor = reader.Read<float>();
+
+				return command;
+			}
+		};
+
+		/**
+		 * The cache belongs to the recorded backend, so the command is replayed with the handle only.
+		 */
+		template<>
+		struct CommandSerializer<AudioCore::Commands::BufferedPlayback> {
+			static void Serialize(CommandWriter& writer, const AudioCore::Commands::BufferedPlayback& command)
+			{
+				CommandSerializer<AudioCore::AudioObjectHandle>::Serialize(writer, command.mHandle);
+				writer.WriteVarInt(command.loopCount);
+				writer.Write(command.volumeFactor);
+			}
+
+			static AudioCore::Commands::BufferedPlayback Deserialize(CommandReader& reader)
+			{
+				const AudioCore::AudioObjectHandle handle = CommandSerializer<AudioCore::AudioObjectHandle>::Deserialize(reader);
+				const UI64 loopCount = reader.ReadVarInt();
+				const float volumeFactor = reader.Read<float>();
+
+				return AudioCore::Commands::BufferedPlayback(handle, nullptr, loopCount, volumeFactor);
+			}
+		};
+	}
+}
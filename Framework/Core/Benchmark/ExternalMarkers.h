@@ -0,0 +1,204 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Core/Types/DataTypes.h"
+#include "Core/Macros/Global.h"
+
+/**
+ * External markers annotate captures of external profilers with engine semantics.
+ *
+ * Define DMK_ENABLE_ITT to emit Intel ITT tasks, frames and thread names (VTune), and DMK_ENABLE_USDT to emit
+ * Linux user space statically defined tracing probes (perf, bpftrace). Both are off by default, and the markers
+ * compile to nothing unless one of them is defined. Use premake's --with-itt and --with-usdt options.
+ *
+ * The USDT probes are in the "dynamik" provider:
+ * - zone_begin(name), zone_end()
+ * - frame(index)
+ * - thread_name(name)
+ * - command_push(id), command_begin(id, name), command_end(id)
+ *
+ * For example: perf probe -x <binary> sdt_dynamik:command_begin && perf record -e sdt_dynamik:* <binary>
+ */
+#if defined(DMK_ENABLE_ITT) || defined(DMK_ENABLE_USDT)
+#define DMK_EXTERNAL_MARKERS_ENABLED
+
+#endif
+
+#ifdef DMK_ENABLE_ITT
+#include <ittnotify.h>
+
+#endif
+
+#ifdef DMK_ENABLE_USDT
+#ifndef __linux__
+#error "USDT probes are only available on Linux."
+
+#endif
+#include <sys/sdt.h>
+
+#endif
+
+namespace DMK
+{
+	namespace Benchmark
+	{
+		/**
+		 * External Marker structure.
+		 * Names a zone for the external profilers. Create these once per call site, as creating the ITT string
+		 * handle is expensive. Use the DMK_MARKER_ZONE macro instead of creating these manually.
+		 */
+		struct ExternalMarker {
+			/**
+			 * Construct the marker.
+			 *
+			 * @param pName: The marker name. It must be a string literal.
+			 */
+			ExternalMarker(const char* pName);
+
+			const char* pName = nullptr;	// Marker name.
+			void* pHandle = nullptr;	// The ITT string handle. nullptr if ITT is disabled.
+		};
+
+		namespace ExternalMarkers
+		{
+			namespace _Helpers
+			{
+#ifdef DMK_ENABLE_ITT
+				/**
+				 * Get the ITT domain of the engine.
+				 *
+				 * @return The domain pointer.
+				 */
+				__itt_domain* GetDomain();
+
+#endif
+			}
+
+			/**
+			 * Begin a task on the calling thread.
+			 *
+			 * @param marker: The task marker.
+			 */
+			DMK_FORCEINLINE void BeginTask([[maybe_unused]] const ExternalMarker& marker)
+			{
+#ifdef DMK_ENABLE_ITT
+				__itt_task_begin(_Helpers::GetDomain(), __itt_null, __itt_null, static_cast<__itt_string_handle*>(marker.pHandle));
+
+#endif
+#ifdef DMK_ENABLE_USDT
+				DTRACE_PROBE1(dynamik, zone_begin, marker.pName);
+
+#endif
+			}
+
+			/**
+			 * End the last task which began on the calling thread.
+			 */
+			DMK_FORCEINLINE void EndTask()
+			{
+#ifdef DMK_ENABLE_ITT
+				__itt_task_end(_Helpers::GetDomain());
+
+#endif
+#ifdef DMK_ENABLE_USDT
+				DTRACE_PROBE(dynamik, zone_end);
+
+#endif
+			}
+
+			/**
+			 * Mark a command being pushed to a command queue.
+			 *
+			 * @param commandID: The command type ID.
+			 */
+			DMK_FORCEINLINE void MarkCommandPush([[maybe_unused]] UI64 commandID)
+			{
+#ifdef DMK_ENABLE_USDT
+				DTRACE_PROBE1(dynamik, command_push, commandID);
+
+#endif
+			}
+
+			/**
+			 * Begin executing a command on the calling thread.
+			 *
+			 * @param commandID: The command type ID.
+			 * @param pName: The command type name.
+			 */
+			void BeginCommand(UI64 commandID, const char* pName);
+
+			/**
+			 * End executing a command on the calling thread.
+			 *
+			 * @param commandID: The command type ID.
+			 */
+			void EndCommand(UI64 commandID);
+
+			/**
+			 * Mark the end of a frame and the beginning of the next one.
+			 */
+			void MarkFrame();
+
+			/**
+			 * Set the name of the calling thread.
+			 *
+			 * @param pName: The thread name.
+			 */
+			void SetThreadName(const char* pName);
+		}
+
+		/**
+		 * External Marker Scope object.
+		 * Marks a task from its construction to its destruction.
+		 */
+		class ExternalMarkerScope {
+		public:
+			DMK_FORCEINLINE ExternalMarkerScope(const ExternalMarker& marker) { ExternalMarkers::BeginTask(marker); }
+			DMK_FORCEINLINE ~ExternalMarkerScope() { ExternalMarkers::EndTask(); }
+
+			ExternalMarkerScope(const ExternalMarkerScope&) = delete;
+			ExternalMarkerScope& operator=(const ExternalMarkerScope&) = delete;
+		};
+
+		/**
+		 * External Command Scope object.
+		 * Marks the execution of a command from its construction to its destruction. The command may be deleted
+		 * before the scope ends.
+		 */
+		class ExternalCommandScope {
+		public:
+			ExternalCommandScope(UI64 commandID, const char* pName) : mCommandID(commandID) { ExternalMarkers::BeginCommand(commandID, pName); }
+			~ExternalCommandScope() { ExternalMarkers::EndCommand(mCommandID); }
+
+			ExternalCommandScope(const ExternalCommandScope&) = delete;
+			ExternalCommandScope& operator=(const ExternalCommandScope&) = delete;
+
+		private:
+			UI64 mCommandID = 0;	// The command type ID.
+		};
+	}
+}
+
+#ifdef DMK_EXTERNAL_MARKERS_ENABLED
+#define DMK_MARKER_CONCAT2(a, b)		a##b
+#define DMK_MARKER_CONCAT(a, b)			DMK_MARKER_CONCAT2(a, b)
+
+#define DMK_MARKER_ZONE(name)																				\
+	static const ::DMK::Benchmark::ExternalMarker DMK_MARKER_CONCAT(_externalMarker, __LINE__)(name);		\
+	::DMK::Benchmark::ExternalMarkerScope DMK_MARKER_CONCAT(_externalMarkerScope, __LINE__)(DMK_MARKER_CONCAT(_externalMarker, __LINE__))
+
+#define DMK_MARKER_COMMAND(id, name)	::DMK::Benchmark::ExternalCommandScope DMK_MARKER_CONCAT(_externalCommandScope, __LINE__)(id, name)
+#define DMK_MARKER_COMMAND_PUSH(id)		::DMK::Benchmark::ExternalMarkers::MarkCommandPush(id)
+#define DMK_MARKER_FRAME()				::DMK::Benchmark::ExternalMarkers::MarkFrame()
+#define DMK_MARKER_THREAD(name)			::DMK::Benchmark::ExternalMarkers::SetThreadName(name)
+
+#else
+#define DMK_MARKER_ZONE(name)
+#define DMK_MARKER_COMMAND(id, name)
+#define DMK_MARKER_COMMAND_PUSH(id)		((void)0)
+#define DMK_MARKER_FRAME()				((void)0)
+#define DMK_MARKER_THREAD(name)			((void)0)
+
+#endif // DMK_EXTERNAL_MARKERS_ENABLED
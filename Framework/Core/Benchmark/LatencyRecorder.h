@@ -0,0 +1,291 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Core/Types/DataTypes.h"
+#include "Core/Macros/Global.h"
+
+#include <atomic>
+#include <chrono>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+
+#endif
+
+namespace DMK
+{
+	namespace Benchmark
+	{
+		/**
+		 * Latency Histogram object.
+		 * This is a high dynamic range histogram of nanosecond values. Every power of two range is split into
+		 * SubBucketCount linear buckets, so values are stored with a relative error below 1 / SubBucketCount
+		 * while the whole range up to MaxValue takes a few thousand buckets.
+		 *
+		 * This object is not thread safe. Use LatencyRecorder to record from multiple threads.
+		 */
+		class LatencyHistogram {
+		public:
+			static constexpr UI64 SubBucketBits = 7;	// Number of precision bits.
+			static constexpr UI64 SubBucketCount = 1ULL << SubBucketBits;	// Number of buckets per power of two.
+			static constexpr UI64 MaxValueBits = 40;	// Values up to 2^40 ns (about 18 minutes) are tracked.
+			static constexpr UI64 MaxValue = (1ULL << MaxValueBits) - 1;	// Larger values are clamped to this.
+			static constexpr UI64 BucketCount = (MaxValueBits - SubBucketBits + 1) * SubBucketCount;	// Total number of buckets.
+
+			LatencyHistogram() { Reset(); }
+			~LatencyHistogram() {}
+
+			/**
+			 * Get the bucket index of a value.
+			 *
+			 * @param value: The value.
+			 * @return The bucket index.
+			 */
+			static DMK_FORCEINLINE UI64 GetBucketIndex(UI64 value)
+			{
+				if (value > MaxValue)
+					value = MaxValue;
+
+				if (value < SubBucketCount)
+					return value;
+
+				// The top SubBucketBits + 1 bits select the bucket.
+#ifdef _MSC_VER
+				unsigned long mostSignificantBit = 0;
+				_BitScanReverse64(&mostSignificantBit, value);
+
+#else
+				const UI64 mostSignificantBit = 63 - __builtin_clzll(value);
+
+#endif
+
+				const UI64 shift = mostSignificantBit - SubBucketBits;
+
+				return SubBucketCount + shift * SubBucketCount + ((value >> shift) - SubBucketCount);
+			}
+
+			/**
+			 * Get the lowest value of a bucket.
+			 *
+			 * @param index: The bucket index.
+			 * @return The value.
+			 */
+			static DMK_FORCEINLINE UI64 GetBucketLowerBound(UI64 index)
+			{
+				if (index < SubBucketCount)
+					return index;
+
+				const UI64 shift = (index - SubBucketCount) / SubBucketCount;
+				return (SubBucketCount + (index % SubBucketCount)) << shift;
+			}
+
+			/**
+			 * Get the highest value of a bucket.
+			 *
+			 * @param index: The bucket index.
+			 * @return The value.
+			 */
+			static DMK_FORCEINLINE UI64 GetBucketUpperBound(UI64 index)
+			{
+				if (index < SubBucketCount)
+					return index;
+
+				const UI64 shift = (index - SubBucketCount) / SubBucketCount;
+				return GetBucketLowerBound(index) + (1ULL << shift) - 1;
+			}
+
+			/**
+			 * Record a value.
+			 *
+			 * @param value: The value in nanoseconds.
+			 * @param count: The number of times the value occurred. Default is 1.
+			 */
+			void Record(UI64 value, UI64 count = 1);
+
+			/**
+			 * Add the counts of another histogram to this.
+			 *
+			 * @param other: The other histogram.
+			 */
+			void Merge(const LatencyHistogram& other);
+
+			/**
+			 * Clear all the recorded values.
+			 */
+			void Reset();
+
+			/**
+			 * Get the value at a percentile.
+			 * The returned value is the upper bound of the bucket which contains the percentile.
+			 *
+			 * @param percentile: The percentile in the range [0, 100].
+			 * @return The value in nanoseconds. 0 if nothing was recorded.
+			 */
+			UI64 GetPercentile(double percentile) const;
+
+			/**
+			 * Get the number of recorded values.
+			 */
+			UI64 GetCount() const { return mCount; }
+
+			/**
+			 * Get the lowest recorded value.
+			 */
+			UI64 GetMin() const { return mCount ? mMin : 0; }
+
+			/**
+			 * Get the highest recorded value.
+			 */
+			UI64 GetMax() const { return mMax; }
+
+			/**
+			 * Get the mean of the recorded values.
+			 */
+			double GetMean() const { return mCount ? static_cast<double>(mSum) / static_cast<double>(mCount) : 0.0; }
+
+		private:
+			friend class LatencyRecorder;
+
+			UI64 mBuckets[BucketCount] = {};	// Value counts.
+			UI64 mCount = 0;	// Number of values.
+			UI64 mSum = 0;	// Sum of the values.
+			UI64 mMin = ~0ULL;	// Lowest value.
+			UI64 mMax = 0;	// Highest value.
+		};
+
+		/**
+		 * Latency Recorder object.
+		 * This records nanosecond values from any number of threads without locking. The values are moved to a
+		 * LatencyHistogram by calling Collect().
+		 */
+		class LatencyRecorder {
+		public:
+			LatencyRecorder(const char* pName = "") : pName(pName) {}
+			~LatencyRecorder() {}
+
+			LatencyRecorder(const LatencyRecorder&) = delete;
+			LatencyRecorder& operator=(const LatencyRecorder&) = delete;
+
+			/**
+			 * Record a value.
+			 *
+			 * @param value: The value in nanoseconds.
+			 */
+			DMK_FORCEINLINE void Record(UI64 value)
+			{
+				mBuckets[LatencyHistogram::GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+				mSum.fetch_add(value, std::memory_order_relaxed);
+
+				UI64 max = mMax.load(std::memory_order_relaxed);
+				while (value > max && !mMax.compare_exchange_weak(max, value, std::memory_order_relaxed));
+			}
+
+			/**
+			 * Move the recorded values to a histogram.
+			 * Values recorded while collecting go to either this collection or the next one, never both.
+			 *
+			 * @param histogram: The histogram to add the values to.
+			 */
+			void Collect(LatencyHistogram& histogram);
+
+			/**
+			 * Get the name of the recorder.
+			 */
+			const char* GetName() const { return pName; }
+
+		private:
+			std::atomic<UI64> mBuckets[LatencyHistogram::BucketCount] = {};	// Value counts.
+			std::atomic<UI64> mSum = { 0 };	// Sum of the values.
+			std::atomic<UI64> mMax = { 0 };	// Highest value.
+			const char* pName = nullptr;	// Recorder name.
+		};
+
+		/**
+		 * Latency Scope object.
+		 * This records the time between its construction and destruction to a recorder.
+		 */
+		class LatencyScope {
+		public:
+			/**
+			 * Start measuring.
+			 *
+			 * @param recorder: The recorder to record to.
+			 */
+			DMK_FORCEINLINE LatencyScope(LatencyRecorder& recorder) : pRecorder(&recorder), mBeginTime(std::chrono::steady_clock::now()) {}
+
+			/**
+			 * Stop measuring and record the time.
+			 */
+			DMK_FORCEINLINE ~LatencyScope()
+			{
+				pRecorder->Record(static_cast<UI64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - mBeginTime).count()));
+			}
+
+			LatencyScope(const LatencyScope&) = delete;
+			LatencyScope& operator=(const LatencyScope&) = delete;
+
+		private:
+			LatencyRecorder* pRecorder = nullptr;	// The recorder.
+			std::chrono::steady_clock::time_point mBeginTime;	// Begin time.
+		};
+
+		/**
+		 * Metric Window enum.
+		 */
+		enum class MetricWindow : UI8 {
+			SECOND,	// The last completed second.
+			MINUTE,	// The last completed minute.
+			TOTAL,	// Everything since the metric was created.
+		};
+
+		/**
+		 * Metric Dump Format enum.
+		 */
+		enum class MetricDumpFormat : UI8 {
+			CSV,	// One row per metric and window.
+			JSON,	// One JSON object per line.
+		};
+
+		/**
+		 * The metrics are named latency recorders with per second and per minute rollups.
+		 * A reporter thread rolls the windows up every second and can append them to a file.
+		 */
+		namespace Metrics
+		{
+			/**
+			 * Get a latency recorder by name. It is created on first use and lives until the program exits.
+			 *
+			 * @param pName: The metric name. It must be a string literal or outlive the program.
+			 * @return The recorder reference.
+			 */
+			LatencyRecorder& GetLatencyRecorder(const char* pName);
+
+			/**
+			 * Get a snapshot of a metric.
+			 * The windows are updated by the reporter thread, so SECOND and MINUTE are empty until reporting starts.
+			 *
+			 * @param pName: The metric name.
+			 * @param window: The window.
+			 * @param histogram: The histogram to copy the window to.
+			 * @return False if the metric does not exist.
+			 */
+			bool GetSnapshot(const char* pName, MetricWindow window, LatencyHistogram& histogram);
+
+			/**
+			 * Start the reporter thread.
+			 *
+			 * @param pFilePath: The file to append the windows to. nullptr only updates the snapshots.
+			 * @param format: The file format. Default is CSV.
+			 * @return False if the file could not be opened.
+			 */
+			bool StartReporting(const char* pFilePath = nullptr, MetricDumpFormat format = MetricDumpFormat::CSV);
+
+			/**
+			 * Stop the reporter thread. The current partial windows are written first.
+			 */
+			void StopReporting();
+		}
+	}
+}
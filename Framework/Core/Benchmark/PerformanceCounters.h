@@ -0,0 +1,234 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Core/Benchmark/Profiler.h"
+
+#include <vector>
+
+namespace DMK
+{
+	namespace Benchmark
+	{
+		/**
+		 * Hardware Counter enum.
+		 */
+		enum class HardwareCounter : UI8 {
+			CYCLES,	// CPU cycles.
+			INSTRUCTIONS,	// Retired instructions.
+			L1D_MISSES,	// Level 1 data cache read misses.
+			LLC_MISSES,	// Last level cache misses.
+			BRANCH_MISSES,	// Mispredicted branches.
+
+			COUNTER_COUNT
+		};
+
+		constexpr UI64 HardwareCounterCount = static_cast<UI64>(HardwareCounter::COUNTER_COUNT);
+
+		/**
+		 * Counter Values structure.
+		 * Values of counters which are not available are 0.
+		 */
+		struct CounterValues {
+			/**
+			 * Get the value of a counter.
+			 */
+			UI64 Get(HardwareCounter counter) const { return mValues[static_cast<UI8>(counter)]; }
+
+			/**
+			 * Get the instructions per cycle.
+			 */
+			double GetIPC() const { return Ratio(Get(HardwareCounter::INSTRUCTIONS), Get(HardwareCounter::CYCLES)); }
+
+			/**
+			 * Get the number of L1 data cache misses per 1000 instructions.
+			 */
+			double GetL1DMissesPerKiloInstruction() const { return Ratio(Get(HardwareCounter::L1D_MISSES) * 1000, Get(HardwareCounter::INSTRUCTIONS)); }
+
+			/**
+			 * Get the number of last level cache misses per 1000 instructions.
+			 */
+			double GetLLCMissesPerKiloInstruction() const { return Ratio(Get(HardwareCounter::LLC_MISSES) * 1000, Get(HardwareCounter::INSTRUCTIONS)); }
+
+			/**
+			 * Get the number of branch misses per 1000 instructions.
+			 */
+			double GetBranchMissesPerKiloInstruction() const { return Ratio(Get(HardwareCounter::BRANCH_MISSES) * 1000, Get(HardwareCounter::INSTRUCTIONS)); }
+
+			CounterValues operator-(const CounterValues& other) const
+			{
+				CounterValues result;
+				for (UI64 index = 0; index < HardwareCounterCount; index++)
+					result.mValues[index] = mValues[index] - other.mValues[index];
+
+				return result;
+			}
+
+			CounterValues& operator+=(const CounterValues& other)
+			{
+				for (UI64 index = 0; index < HardwareCounterCount; index++)
+					mValues[index] += other.mValues[index];
+
+				return *this;
+			}
+
+			UI64 mValues[HardwareCounterCount] = {};	// Counter values.
+
+		private:
+			static double Ratio(UI64 numerator, UI64 denominator) { return denominator ? static_cast<double>(numerator) / static_cast<double>(denominator) : 0.0; }
+		};
+
+		/**
+		 * Performance Counters object.
+		 * This opens the hardware counters of the calling thread using Linux perf events. Counters which can not be
+		 * opened (no PMU access in containers and virtual machines, restrictive perf_event_paranoid settings, other
+		 * platforms) are reported as unavailable and read as 0, so callers never need to special case them.
+		 *
+		 * The counters only count the thread which created the object, in user mode.
+		 */
+		class PerformanceCounters {
+		public:
+			/**
+			 * Open the counters for the calling thread.
+			 */
+			PerformanceCounters();
+
+			/**
+			 * Close the counters.
+			 */
+			~PerformanceCounters();
+
+			PerformanceCounters(const PerformanceCounters&) = delete;
+			PerformanceCounters& operator=(const PerformanceCounters&) = delete;
+
+			/**
+			 * Check if any counter is available.
+			 *
+			 * @return Boolean value.
+			 */
+			bool IsAvailable() const { return mLeader >= 0; }
+
+			/**
+			 * Check if a counter is available.
+			 *
+			 * @param counter: The counter.
+			 * @return Boolean value.
+			 */
+			bool IsAvailable(HardwareCounter counter) const { return mFileDescriptors[static_cast<UI8>(counter)] >= 0; }
+
+			/**
+			 * Read the current values of the counters.
+			 * The values are scaled if the kernel had to multiplex the counters.
+			 *
+			 * @param values: The variable to store the values in.
+			 * @return False if the counters could not be read.
+			 */
+			bool Read(CounterValues& values) const;
+
+			/**
+			 * Enable or disable counter collection by counter zones and timers. Default is disabled.
+			 *
+			 * @param bEnable: Whether to enable the collection.
+			 */
+			static void SetEnabled(bool bEnable);
+
+			/**
+			 * Check if counter collection is enabled.
+			 *
+			 * @return Boolean value.
+			 */
+			static bool IsEnabled();
+
+			/**
+			 * Get the counters of the calling thread. They are opened on first use.
+			 *
+			 * @return The counters reference.
+			 */
+			static PerformanceCounters& ThreadLocal();
+
+			/**
+			 * Get the name of a counter.
+			 *
+			 * @param counter: The counter.
+			 * @return The name string.
+			 */
+			static const char* GetName(HardwareCounter counter);
+
+		private:
+			I32 mFileDescriptors[HardwareCounterCount] = { -1, -1, -1, -1, -1 };	// Counter file descriptors.
+			UI64 mIDs[HardwareCounterCount] = {};	// Kernel IDs of the counters.
+			I32 mLeader = -1;	// The group leader file descriptor.
+		};
+
+		/**
+		 * Zone Counter Report structure.
+		 * The accumulated counters of a zone.
+		 */
+		struct ZoneCounterReport {
+			const ZoneDescriptor* pDescriptor = nullptr;	// The zone.
+			CounterValues mValues;	// Accumulated counter values.
+			UI64 mCallCount = 0;	// Number of times the zone was executed.
+		};
+
+		/**
+		 * Counter Zone object.
+		 * This accumulates the counter deltas between its construction and destruction under its zone descriptor,
+		 * when collection is enabled using PerformanceCounters::SetEnabled(). Reading the counters costs a system
+		 * call, so use this for coarse zones only.
+		 */
+		class CounterZone {
+		public:
+			/**
+			 * Enter the zone.
+			 *
+			 * @param descriptor: The static zone descriptor.
+			 */
+			CounterZone(const ZoneDescriptor& descriptor);
+
+			/**
+			 * Leave the zone.
+			 */
+			~CounterZone();
+
+			CounterZone(const CounterZone&) = delete;
+			CounterZone& operator=(const CounterZone&) = delete;
+
+			/**
+			 * Get the accumulated counters of all the zones.
+			 *
+			 * @return The zone reports.
+			 */
+			static std::vector<ZoneCounterReport> GetReports();
+
+			/**
+			 * Write the accumulated counters, IPC and miss rates of all the zones as CSV.
+			 *
+			 * @param pFilePath: The output file path.
+			 * @return True if the file was written.
+			 */
+			static bool ExportReport(const char* pFilePath);
+
+			/**
+			 * Clear the accumulated counters.
+			 */
+			static void ResetReports();
+
+		private:
+			const ZoneDescriptor* pDescriptor = nullptr;	// The zone descriptor. nullptr if the counters are unavailable.
+			CounterValues mBeginValues;	// Counter values when the zone was entered.
+		};
+	}
+}
+
+// The counter zone is nested inside the profiler zone, so the counters do not include the profiler overhead.
+#ifdef DMK_PROFILER_ENABLED
+#define DMK_PROFILE_ZONE_COUNTERS(name)																	\
+	static constexpr ::DMK::Benchmark::ZoneDescriptor DMK_PROFILER_CONCAT(_zoneDescriptor, __LINE__) = { name, __FUNCTION__, __FILE__, __LINE__ };	\
+	::DMK::Benchmark::ProfilerZone DMK_PROFILER_CONCAT(_profilerZone, __LINE__)(DMK_PROFILER_CONCAT(_zoneDescriptor, __LINE__));					\
+	::DMK::Benchmark::CounterZone DMK_PROFILER_CONCAT(_counterZone, __LINE__)(DMK_PROFILER_CONCAT(_zoneDescriptor, __LINE__))
+
+#else
+#define DMK_PROFILE_ZONE_COUNTERS(name)
+
+#endif // DMK_PROFILER_ENABLED
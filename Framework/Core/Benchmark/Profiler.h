@@ -0,0 +1,205 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Core/Types/DataTypes.h"
+#include "Core/Macros/Global.h"
+#include "Core/Benchmark/ExternalMarkers.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+
+#else
+#include <chrono>
+
+#endif
+
+/**
+ * The profiler is enabled in every configuration except Distribution. Define DMK_DISABLE_PROFILER to compile all
+ * the zones out in the other configurations too.
+ */
+#if !defined(DMK_DISTRIBUTION) && !defined(DMK_DISABLE_PROFILER)
+#define DMK_PROFILER_ENABLED
+
+#endif
+
+namespace DMK
+{
+	namespace Benchmark
+	{
+		/**
+		 * Zone Descriptor structure.
+		 * This is the static description of a profiler zone. Use the DMK_PROFILE_ZONE macros instead of creating
+		 * these manually.
+		 */
+		struct ZoneDescriptor {
+			const char* pName = nullptr;	// Zone name.
+			const char* pFunction = nullptr;	// The function the zone is in.
+			const char* pFile = nullptr;	// Source file.
+			UI32 mLine = 0;	// Source line.
+		};
+
+		/**
+		 * The profiler records nested zones and frame markers of all the threads and exports them as a Chrome
+		 * trace (chrome://tracing or ui.perfetto.dev).
+		 *
+		 * Zones are time stamped using the CPU's time stamp counter, which is calibrated to nanoseconds when a
+		 * session begins. Each thread records its zones to its own lock free buffer, and the buffers are collected
+		 * on every frame marker and when exporting.
+		 */
+		namespace Profiler
+		{
+			/**
+			 * Read the time stamp counter.
+			 * Platforms without one use the steady clock in nanoseconds.
+			 *
+			 * @return The number of ticks.
+			 */
+			DMK_FORCEINLINE UI64 GetTicks()
+			{
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+				return __rdtsc();
+
+#else
+				return static_cast<UI64>(std::chrono::steady_clock::now().time_since_epoch().count());
+
+#endif
+			}
+
+			/**
+			 * Begin a profiling session. Any recorded data is discarded.
+			 * This calibrates the time stamp counter, which takes a few milliseconds.
+			 */
+			void BeginSession();
+
+			/**
+			 * End the profiling session. The recorded data is kept until the next session begins.
+			 */
+			void EndSession();
+
+			/**
+			 * Check if a profiling session is active.
+			 *
+			 * @return Boolean value.
+			 */
+			bool IsActive();
+
+			/**
+			 * Mark the end of a frame.
+			 * This also collects the zones recorded by all the threads.
+			 */
+			void MarkFrame();
+
+			/**
+			 * Set the name of the calling thread, which is shown in the trace.
+			 *
+			 * @param pName: The thread name. It must be a string literal or outlive the session.
+			 */
+			void SetThreadName(const char* pName);
+
+			/**
+			 * Get the number of ticks per nanosecond which was measured when the session began.
+			 *
+			 * @return The tick rate.
+			 */
+			double GetTicksPerNanosecond();
+
+			/**
+			 * Get the number of zones dropped because a thread's buffer was full.
+			 *
+			 * @return The number of zones.
+			 */
+			UI64 GetDroppedZoneCount();
+
+			/**
+			 * Export the recorded zones and frame markers as Chrome Trace Event JSON.
+			 *
+			 * @param pFilePath: The output file path.
+			 * @return True if the file was written.
+			 */
+			bool ExportChromeTrace(const char* pFilePath);
+
+			/**
+			 * Measure the cost of a zone by recording empty zones.
+			 * A session must be active. The measured zones are discarded.
+			 *
+			 * @param iterations: The number of zones to record. Default is 100000.
+			 * @return The average cost of a zone in nanoseconds.
+			 */
+			double MeasureZoneOverhead(UI64 iterations = 100000);
+
+			/**
+			 * Enter a zone. Called by the Zone object.
+			 *
+			 * @return True if the zone should be recorded.
+			 */
+			bool EnterZone();
+
+			/**
+			 * Leave a zone and record it. Called by the Zone object.
+			 *
+			 * @param descriptor: The zone descriptor.
+			 * @param beginTicks: The ticks when the zone was entered.
+			 * @param endTicks: The ticks when the zone was left.
+			 */
+			void LeaveZone(const ZoneDescriptor& descriptor, UI64 beginTicks, UI64 endTicks);
+		}
+
+		/**
+		 * Profiler Zone object.
+		 * This records the time between its construction and destruction.
+		 */
+		class ProfilerZone {
+		public:
+			/**
+			 * Enter the zone.
+			 *
+			 * @param descriptor: The static zone descriptor.
+			 */
+			DMK_FORCEINLINE ProfilerZone(const ZoneDescriptor& descriptor)
+				: pDescriptor(Profiler::EnterZone() ? &descriptor : nullptr), mBeginTicks(Profiler::GetTicks()) {}
+
+			/**
+			 * Leave the zone.
+			 */
+			DMK_FORCEINLINE ~ProfilerZone()
+			{
+				if (pDescriptor)
+					Profiler::LeaveZone(*pDescriptor, mBeginTicks, Profiler::GetTicks());
+			}
+
+			ProfilerZone(const ProfilerZone&) = delete;
+			ProfilerZone& operator=(const ProfilerZone&) = delete;
+
+		private:
+			const ZoneDescriptor* pDescriptor = nullptr;	// The zone descriptor. nullptr if not recording.
+			UI64 mBeginTicks = 0;	// The ticks when the zone was entered.
+		};
+	}
+}
+
+#ifdef DMK_PROFILER_ENABLED
+#define DMK_PROFILER_CONCAT2(a, b)		a##b
+#define DMK_PROFILER_CONCAT(a, b)		DMK_PROFILER_CONCAT2(a, b)
+
+#define DMK_PROFILE_ZONE(name)																				\
+	DMK_MARKER_ZONE(name);																					\
+	static constexpr ::DMK::Benchmark::ZoneDescriptor DMK_PROFILER_CONCAT(_zoneDescriptor, __LINE__) = { name, __FUNCTION__, __FILE__, __LINE__ };	\
+	::DMK::Benchmark::ProfilerZone DMK_PROFILER_CONCAT(_profilerZone, __LINE__)(DMK_PROFILER_CONCAT(_zoneDescriptor, __LINE__))
+
+#define DMK_PROFILE_FUNCTION()			DMK_PROFILE_ZONE(__FUNCTION__)
+#define DMK_PROFILE_FRAME()				(DMK_MARKER_FRAME(), ::DMK::Benchmark::Profiler::MarkFrame())
+#define DMK_PROFILE_THREAD(name)		(DMK_MARKER_THREAD(name), ::DMK::Benchmark::Profiler::SetThreadName(name))
+
+#else
+// The external markers are enabled separately, so they are kept when the profiler is compiled out.
+#define DMK_PROFILE_ZONE(name)			DMK_MARKER_ZONE(name)
+#define DMK_PROFILE_FUNCTION()			DMK_MARKER_ZONE(__FUNCTION__)
+#define DMK_PROFILE_FRAME()				DMK_MARKER_FRAME()
+#define DMK_PROFILE_THREAD(name)		DMK_MARKER_THREAD(name)
+
+#endif // DMK_PROFILER_ENABLED
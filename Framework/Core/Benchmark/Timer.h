@@ -3,7 +3,7 @@
 
 #pragma once
 
-#include "Core/Types/DataTypes.h"
+#include "Core/Benchmark/PerformanceCounters.h"
 
 namespace DMK
 {
@@ -12,6 +12,8 @@ namespace DMK
 		/**
 		 * Timer object for the Dynamik Benchmark.
 		 * This object calculates and prints the time taken to execute some code within a specific scope.
+		 * If hardware counter collection is enabled (PerformanceCounters::SetEnabled()) and the counters are
+		 * available, the IPC and miss rates of the scope are printed too.
 		 */
 		class Timer {
 		public:
@@ -32,6 +34,14 @@ namespace DMK
 			~Timer();
 
 		private:
+			/**
+			 * Read the begin counter values if counter collection is enabled.
+			 */
+			void BeginCounters();
+
+			CounterValues mBeginCounters;	// Counter values when the timer began.
+			bool bHasCounters = false;	// Whether the counters are being measured.
+
 			I64 mStartTime = 0;	// The start time point.
 			const wchar* pTimerName = nullptr;	// The timer name.
 		};
@@ -0,0 +1,377 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Core/Types/DataTypes.h"
+#include "Core/Macros/Global.h"
+
+#include <atomic>
+#include <cstring>
+#include <cwchar>
+#include <type_traits>
+
+namespace DMK
+{
+	/**
+	 * The binary logger writes structured log records to a file without formatting them.
+	 *
+	 * Each call site owns a static format descriptor (the format string, the source location and the argument
+	 * types) which is registered and written to the file once. Log calls only copy the descriptor ID, a time
+	 * stamp and the raw argument values (integers are variable length encoded) to a lock free buffer owned by the
+	 * calling thread. A background thread writes the buffers to the file, and the LogDecoder tool turns the file
+	 * into text offline.
+	 *
+	 * Format strings use {} as the argument placeholder.
+	 */
+	namespace BinaryLogger
+	{
+		constexpr UI64 MaxArguments = 16;	// Maximum number of arguments of a single record.
+		constexpr UI64 MaxStringLength = 256;	// Maximum number of bytes stored for a string argument.
+
+		constexpr char FileMagic[8] = { 'D', 'M', 'K', 'B', 'L', 'O', 'G', 0 };	// The first bytes of a binary log file.
+		constexpr UI32 FileVersion = 1;	// The binary log file version.
+
+		/**
+		 * Severity enum.
+		 * The values match the severities of the text logger.
+		 */
+		enum class Severity : UI8 {
+			SEVERITY_INFO,
+			SEVERITY_WARN,
+			SEVERITY_ERROR,
+			SEVERITY_FATAL,
+			SEVERITY_DEBUG,
+		};
+
+		/**
+		 * Argument Type enum.
+		 */
+		enum class ArgumentType : UI8 {
+			UNDEFINED,
+			UNSIGNED,	// Variable length unsigned integer.
+			SIGNED,	// Zig zag encoded variable length integer.
+			FLOAT,	// 64 bit IEEE double.
+			BOOLEAN,	// Single byte.
+			POINTER,	// Variable length unsigned integer.
+			STRING,	// Variable length size followed by UTF-8 bytes.
+		};
+
+		/**
+		 * Block Type enum.
+		 * A binary log file is the file header followed by a sequence of blocks.
+		 */
+		enum class BlockType : UI8 {
+			FORMAT = 1,	// ID, severity, line, argument count, argument types, file, format string.
+			DATA = 2,	// Thread index, byte count, records (format ID, time stamp delta, arguments).
+			DROPPED = 3,	// Number of records dropped since the previous block.
+		};
+
+		/**
+		 * Log Format structure.
+		 * This is the static descriptor of a log call site. Use the DMK_BINARY_LOG macros instead of creating these
+		 * manually.
+		 */
+		struct LogFormat {
+			constexpr LogFormat(Severity severity, const char* pFormat, const char* pFile, UI32 line)
+				: mSeverity(severity), pFormat(pFormat), pFile(pFile), mLine(line) {}
+
+			std::atomic<UI32> mID = { 0 };	// Format ID. 0 until registered.
+			ArgumentType mArgumentTypes[MaxArguments] = {};	// Argument types. Set when registering.
+			UI8 mArgumentCount = 0;	// Number of arguments. Set when registering.
+			Severity mSeverity = Severity::SEVERITY_INFO;	// Record severity.
+			const char* pFormat = nullptr;	// Format string.
+			const char* pFile = nullptr;	// Source file.
+			UI32 mLine = 0;	// Source line.
+		};
+
+		/**
+		 * Write a variable length (LEB128) unsigned integer.
+		 *
+		 * @param pBuffer: The buffer to write to. It must have at least 10 bytes of space.
+		 * @param value: The value to be written.
+		 * @return The pointer after the written bytes.
+		 */
+		DMK_FORCEINLINE UI8* WriteVarInt(UI8* pBuffer, UI64 value)
+		{
+			while (value >= 0x80)
+			{
+				*pBuffer++ = static_cast<UI8>(value) | 0x80;
+				value >>= 7;
+			}
+
+			*pBuffer++ = static_cast<UI8>(value);
+			return pBuffer;
+		}
+
+		/**
+		 * Read a variable length (LEB128) unsigned integer.
+		 *
+		 * @param pBuffer: The buffer to read from.
+		 * @param pEnd: The end of the buffer.
+		 * @param value: The variable to store the value in.
+		 * @return The pointer after the read bytes. nullptr if the buffer ended before the value.
+		 */
+		inline const UI8* ReadVarInt(const UI8* pBuffer, const UI8* pEnd, UI64& value)
+		{
+			value = 0;
+			for (UI32 shift = 0; pBuffer < pEnd && shift < 64; shift += 7)
+			{
+				const UI8 byte = *pBuffer++;
+				value |= static_cast<UI64>(byte & 0x7f) << shift;
+
+				if (!(byte & 0x80))
+					return pBuffer;
+			}
+
+			return nullptr;
+		}
+
+		/**
+		 * Zig zag encode a signed integer so that small negative values stay small.
+		 */
+		DMK_FORCEINLINE constexpr UI64 ZigZagEncode(I64 value) { return (static_cast<UI64>(value) << 1) ^ static_cast<UI64>(value >> 63); }
+
+		/**
+		 * Decode a zig zag encoded integer.
+		 */
+		DMK_FORCEINLINE constexpr I64 ZigZagDecode(UI64 value) { return static_cast<I64>(value >> 1) ^ -static_cast<I64>(value & 1); }
+
+		/**
+		 * Get the argument type of a C++ type.
+		 *
+		 * @tparam Type: The C++ type.
+		 * @return The argument type.
+		 */
+		template<class Type>
+		constexpr ArgumentType GetArgumentType()
+		{
+			typedef typename std::decay<Type>::type DecayedType;
+
+			if constexpr (std::is_same<DecayedType, char*>::value || std::is_same<DecayedType, const char*>::value || std::is_same<DecayedType, String>::value)
+				return ArgumentType::STRING;
+			else if constexpr (std::is_same<DecayedType, wchar*>::value || std::is_same<DecayedType, const wchar*>::value || std::is_same<DecayedType, WString>::value)
+				return ArgumentType::STRING;
+			else if constexpr (std::is_same<DecayedType, bool>::value)
+				return ArgumentType::BOOLEAN;
+			else if constexpr (std::is_floating_point<DecayedType>::value)
+				return ArgumentType::FLOAT;
+			else if constexpr (std::is_enum<DecayedType>::value)
+				return std::is_signed<typename std::underlying_type<DecayedType>::type>::value ? ArgumentType::SIGNED : ArgumentType::UNSIGNED;
+			else if constexpr (std::is_integral<DecayedType>::value)
+				return std::is_signed<DecayedType>::value ? ArgumentType::SIGNED : ArgumentType::UNSIGNED;
+			else if constexpr (std::is_pointer<DecayedType>::value)
+				return ArgumentType::POINTER;
+			else
+				return ArgumentType::UNDEFINED;
+		}
+
+		/**
+		 * Get the maximum number of bytes an encoded argument can take.
+		 *
+		 * @tparam Type: The C++ type.
+		 * @return The number of bytes.
+		 */
+		template<class Type>
+		constexpr UI64 GetMaxArgumentSize()
+		{
+			constexpr ArgumentType argumentType = GetArgumentType<Type>();
+
+			if constexpr (argumentType == ArgumentType::STRING)
+				return MaxStringLength + 2;
+			else if constexpr (argumentType == ArgumentType::BOOLEAN)
+				return 1;
+			else if constexpr (argumentType == ArgumentType::FLOAT)
+				return sizeof(double);
+			else
+				return 10;
+		}
+
+		/**
+		 * Open a binary log file. Any previously opened file is closed.
+		 *
+		 * @param pFilePath: The path of the file.
+		 * @return True if the file was opened.
+		 */
+		bool Open(const char* pFilePath);
+
+		/**
+		 * Write all the pending records and close the file.
+		 */
+		void Close();
+
+		/**
+		 * Check if a binary log file is open.
+		 * Log calls return immediately when no file is open.
+		 *
+		 * @return Boolean value.
+		 */
+		bool IsOpen();
+
+		/**
+		 * Wait till all the records pushed before this call are written to the file.
+		 *
+		 * @param timeoutMilliseconds: The maximum time to wait. Default is 100.
+		 * @return True if the records were written within the time limit.
+		 */
+		bool Flush(UI64 timeoutMilliseconds = 100);
+
+		/**
+		 * Get the number of records dropped because a thread's buffer was full.
+		 *
+		 * @return The number of dropped records.
+		 */
+		UI64 GetDroppedRecordCount();
+
+		/**
+		 * Register a format descriptor.
+		 * This is only called on the first log call of a call site.
+		 *
+		 * @param format: The format descriptor.
+		 * @param pArgumentTypes: The argument types.
+		 * @param argumentCount: The number of arguments.
+		 * @return The format ID.
+		 */
+		UI32 RegisterFormat(LogFormat& format, const ArgumentType* pArgumentTypes, UI64 argumentCount);
+
+		/**
+		 * Push an encoded record to the calling thread's buffer.
+		 * The record is dropped if the buffer is full.
+		 *
+		 * @param formatID: The format ID.
+		 * @param pArguments: The encoded arguments.
+		 * @param size: The size of the encoded arguments.
+		 */
+		void Submit(UI32 formatID, const UI8* pArguments, UI64 size);
+
+		/**
+		 * Encode a wide string as UTF-8.
+		 *
+		 * @param pBuffer: The buffer to write to. It must have MaxStringLength + 2 bytes of space.
+		 * @param pString: The string to be encoded.
+		 * @param length: The number of characters.
+		 * @return The pointer after the written bytes.
+		 */
+		UI8* WriteWideString(UI8* pBuffer, const wchar* pString, UI64 length);
+
+		/**
+		 * Write a string argument.
+		 *
+		 * @param pBuffer: The buffer to write to. It must have MaxStringLength + 2 bytes of space.
+		 * @param pString: The string to be written.
+		 * @param length: The number of bytes.
+		 * @return The pointer after the written bytes.
+		 */
+		DMK_FORCEINLINE UI8* WriteString(UI8* pBuffer, const char* pString, UI64 length)
+		{
+			if (length > MaxStringLength)
+				length = MaxStringLength;
+
+			pBuffer = WriteVarInt(pBuffer, length);
+			std::memcpy(pBuffer, pString, length);
+			return pBuffer + length;
+		}
+
+		/**
+		 * Encode an argument.
+		 *
+		 * @param pBuffer: The buffer to write to.
+		 * @param argument: The argument to be encoded.
+		 * @return The pointer after the written bytes.
+		 */
+		template<class Type>
+		DMK_FORCEINLINE UI8* WriteArgument(UI8* pBuffer, const Type& argument)
+		{
+			typedef typename std::decay<Type>::type DecayedType;
+			constexpr bool bIsArray = std::is_array<typename std::remove_reference<Type>::type>::value;
+			constexpr ArgumentType argumentType = GetArgumentType<Type>();
+			static_assert(argumentType != ArgumentType::UNDEFINED, "Unsupported binary log argument type!");
+
+			if constexpr (std::is_same<DecayedType, String>::value)
+				return WriteString(pBuffer, argument.data(), argument.size());
+			else if constexpr (std::is_same<DecayedType, WString>::value)
+				return WriteWideString(pBuffer, argument.data(), argument.size());
+			else if constexpr (std::is_same<DecayedType, char*>::value || std::is_same<DecayedType, const char*>::value)
+			{
+				// Arrays, such as string literals, cannot be null.
+				if constexpr (bIsArray)
+					return WriteString(pBuffer, argument, strlen(argument));
+				else
+					return argument ? WriteString(pBuffer, argument, strlen(argument)) : WriteVarInt(pBuffer, 0);
+			}
+			else if constexpr (std::is_same<DecayedType, wchar*>::value || std::is_same<DecayedType, const wchar*>::value)
+			{
+				if constexpr (bIsArray)
+					return WriteWideString(pBuffer, argument, wcslen(argument));
+				else
+					return argument ? WriteWideString(pBuffer, argument, wcslen(argument)) : WriteVarInt(pBuffer, 0);
+			}
+			else if constexpr (argumentType == ArgumentType::BOOLEAN)
+			{
+				*pBuffer = argument ? 1 : 0;
+				return pBuffer + 1;
+			}
+			else if constexpr (argumentType == ArgumentType::FLOAT)
+			{
+				const double value = static_cast<double>(argument);
+				std::memcpy(pBuffer, &value, sizeof(double));
+				return pBuffer + sizeof(double);
+			}
+			else if constexpr (argumentType == ArgumentType::POINTER)
+				return WriteVarInt(pBuffer, reinterpret_cast<UI64>(argument));
+			else if constexpr (argumentType == ArgumentType::SIGNED)
+				return WriteVarInt(pBuffer, ZigZagEncode(static_cast<I64>(argument)));
+			else
+				return WriteVarInt(pBuffer, static_cast<UI64>(argument));
+		}
+
+		/**
+		 * Log a record.
+		 * Use the DMK_BINARY_LOG macros instead of calling this directly.
+		 *
+		 * @param format: The static format descriptor of the call site.
+		 * @param arguments: The arguments.
+		 */
+		template<class... Arguments>
+		void Log(LogFormat& format, const Arguments&... arguments)
+		{
+			static_assert(sizeof...(Arguments) <= MaxArguments, "Too many binary log arguments!");
+
+			if (!IsOpen())
+				return;
+
+			UI32 formatID = format.mID.load(std::memory_order_acquire);
+			if (!formatID)
+			{
+				constexpr ArgumentType argumentTypes[] = { GetArgumentType<Arguments>()..., ArgumentType::UNDEFINED };
+				formatID = RegisterFormat(format, argumentTypes, sizeof...(Arguments));
+			}
+
+			UI8 record[(GetMaxArgumentSize<Arguments>() + ... + 1)];
+			UI8* pCurrent = record;
+			((pCurrent = WriteArgument(pCurrent, arguments)), ...);
+
+			Submit(formatID, record, pCurrent - record);
+		}
+	}
+}
+
+#ifndef DMK_DISABLE_BINARY_LOG
+
+#define DMK_BINARY_LOG(severity, format, ...)																		\
+	do {																											\
+		static ::DMK::BinaryLogger::LogFormat _binaryLogFormat(severity, format, __FILE__, __LINE__);				\
+		::DMK::BinaryLogger::Log(_binaryLogFormat, ##__VA_ARGS__);													\
+	} while (false)
+
+#else
+
+#define DMK_BINARY_LOG(severity, format, ...)
+
+#endif // !DMK_DISABLE_BINARY_LOG
+
+#define DMK_BINARY_LOG_INFO(format, ...)	DMK_BINARY_LOG(::DMK::BinaryLogger::Severity::SEVERITY_INFO, format, ##__VA_ARGS__)
+#define DMK_BINARY_LOG_WARN(format, ...)	DMK_BINARY_LOG(::DMK::BinaryLogger::Severity::SEVERITY_WARN, format, ##__VA_ARGS__)
+#define DMK_BINARY_LOG_ERROR(format, ...)	DMK_BINARY_LOG(::DMK::BinaryLogger::Severity::SEVERITY_ERROR, format, ##__VA_ARGS__)
+#define DMK_BINARY_LOG_FATAL(format, ...)	DMK_BINARY_LOG(::DMK::BinaryLogger::Severity::SEVERITY_FATAL, format, ##__VA_ARGS__)
+#define DMK_BINARY_LOG_DEBUG(format, ...)	DMK_BINARY_LOG(::DMK::BinaryLogger::Severity::SEVERITY_DEBUG, format, ##__VA_ARGS__)
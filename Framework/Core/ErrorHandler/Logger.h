@@ -9,9 +9,46 @@ namespace DMK
 {
 	/**
 	 *  The logger is a namespace which contains functions which allows the user to log messages to the console.
+	 *
+	 * Logging is asynchronous. The log functions copy the message to a lock free ring buffer owned by the calling
+	 * thread and return, and a background thread formats and writes the messages in batches. Fatal messages
+	 * flush all pending messages before returning.
 	 */
 	namespace Logger
 	{
+		/**
+		 * Overflow Policy enum.
+		 * This defines what happens when a thread's log buffer is full.
+		 */
+		enum class OverflowPolicy : UI8 {
+			DROP,	// Discard the message and count it. The writer reports the number of dropped messages.
+			BLOCK,	// Wait until the writer thread makes space.
+		};
+
+		/**
+		 * Set the overflow policy of the logger.
+		 * Default is BLOCK.
+		 *
+		 * @param policy: The overflow policy.
+		 */
+		void SetOverflowPolicy(OverflowPolicy policy);
+
+		/**
+		 * Write all the pending messages of all the threads to the console.
+		 * This waits at most the given time for the writer thread and then returns.
+		 *
+		 * @param timeoutMilliseconds: The maximum time to wait. Default is 100.
+		 * @return True if all the messages were written within the time limit.
+		 */
+		bool Flush(UI64 timeoutMilliseconds = 100);
+
+		/**
+		 * Get the number of messages dropped because of the DROP overflow policy.
+		 *
+		 * @return The number of dropped messages.
+		 */
+		UI64 GetDroppedMessageCount();
+
 		/**
 		 * Log basic information to the console.
 		 * Color: Green.
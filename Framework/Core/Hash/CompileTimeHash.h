@@ -0,0 +1,99 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Core/Types/DataTypes.h"
+#include <type_traits>
+
+/**
+ * The decorated signature of the current function.
+ * This contains the template arguments of the function, which is what TypeId<>() uses to identify a type.
+ */
+#if defined(_MSC_VER) && !defined(__clang__)
+#define DMK_FUNCTION_SIGNATURE			__FUNCSIG__
+
+#else
+#define DMK_FUNCTION_SIGNATURE			__PRETTY_FUNCTION__
+
+#endif
+
+namespace DMK
+{
+	namespace Hasher
+	{
+		constexpr UI64 FNV1aOffsetBasis = 14695981039346656037ULL;	// 64 bit FNV-1a offset basis.
+		constexpr UI64 FNV1aPrime = 1099511628211ULL;	// 64 bit FNV-1a prime.
+
+		/**
+		 * Generate a 64 bit FNV-1a hash of a string.
+		 * This can be evaluated at compile time, which makes it usable for switch case labels and template
+		 * arguments. It is not as fast as GetHash() for large runtime buffers.
+		 *
+		 * @param pString: The string to be hashed.
+		 * @param length: The number of characters to hash.
+		 * @param hash: The initial hash value. Use the result of a previous call to continue a hash. Default is
+		 * the FNV-1a offset basis.
+		 * @return The hash as UI64.
+		 */
+		constexpr UI64 GetHashFNV1a(const char* pString, UI64 length, UI64 hash = FNV1aOffsetBasis)
+		{
+			for (UI64 index = 0; index < length; index++)
+				hash = (hash ^ static_cast<UI8>(pString[index])) * FNV1aPrime;
+
+			return hash;
+		}
+
+		/**
+		 * Generate a 64 bit FNV-1a hash of a null terminated string.
+		 *
+		 * @param pString: The null terminated string to be hashed.
+		 * @return The hash as UI64.
+		 */
+		constexpr UI64 GetHashFNV1a(const char* pString)
+		{
+			UI64 hash = FNV1aOffsetBasis;
+			for (; *pString; pString++)
+				hash = (hash ^ static_cast<UI8>(*pString)) * FNV1aPrime;
+
+			return hash;
+		}
+	}
+
+	namespace _Helpers
+	{
+		/**
+		 * Type ID storage.
+		 * Storing the ID in a static constexpr member forces it to be computed at compile time.
+		 *
+		 * @tparam Type: The type to be identified.
+		 */
+		template<class Type>
+		struct TypeIdStore {
+			/**
+			 * Hash the function signature, which contains the type name.
+			 */
+			static constexpr UI64 Compute() { return Hasher::GetHashFNV1a(DMK_FUNCTION_SIGNATURE); }
+
+			static constexpr UI64 Value = Compute();	// The type ID.
+		};
+
+		template<class Type>
+		constexpr UI64 TypeIdStore<Type>::Value;
+	}
+
+	/**
+	 * Get a 64 bit ID of a type at compile time.
+	 * The ID is derived from the fully qualified type name, so it is the same on every run and in every module
+	 * built with the same compiler. It can be used as a switch case label or as a hash map key, and does not
+	 * need RTTI.
+	 *
+	 * @tparam Type: The type to be identified. Cv qualifiers are ignored.
+	 * @return The ID as UI64.
+	 */
+	template<class Type>
+	constexpr UI64 TypeId()
+	{
+		return _Helpers::TypeIdStore<typename std::remove_cv<Type>::type>::Value;
+	}
+}
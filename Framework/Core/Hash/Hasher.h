@@ -5,19 +5,165 @@
 
 #include "Core/Types/DataTypes.h"
 
+struct XXH3_state_s;
+
 namespace DMK
 {
 	namespace Hasher
 	{
+		/**
+		 * 128 bit hash.
+		 * This is used for content addressing where 64 bits are not enough to avoid collisions.
+		 */
+		struct Hash128 {
+			UI64 mLow = 0;	// Lower 64 bits.
+			UI64 mHigh = 0;	// Higher 64 bits.
+
+			/**
+			 * Is equal operator.
+			 *
+			 * @param other: The other hash.
+			 * @return Boolean value.
+			 */
+			bool operator==(const Hash128& other) const { return mLow == other.mLow && mHigh == other.mHigh; }
+
+			/**
+			 * Is not equal operator.
+			 *
+			 * @param other: The other hash.
+			 * @return Boolean value.
+			 */
+			bool operator!=(const Hash128& other) const { return !(*this == other); }
+		};
+
 		/**
 		 * Generate hash using the data and the size of it.
-		 * This method uses the xxhash library to generate the hash.
+		 * This method uses the xxhash library (XXH3) to generate the hash.
 		 *
 		 * @param pData: The data pointer.
 		 * @param size: The size of the data block.
-		 * @param seed: The seed to generate the hash from. Default is 0.
+		 * @param seed: The seed to generate the hash from. Different seeds produce independent hashes. Default is 0.
 		 * @return The hash as UI64.
 		 */
 		UI64 GetHash(const void* pData, UI64 size, UI64 seed = 0);
+
+		/**
+		 * Generate a 128 bit hash using the data and the size of it.
+		 *
+		 * @param pData: The data pointer.
+		 * @param size: The size of the data block.
+		 * @param seed: The seed to generate the hash from. Default is 0.
+		 * @return The hash as Hash128.
+		 */
+		Hash128 GetHash128(const void* pData, UI64 size, UI64 seed = 0);
+
+		/**
+		 * Generate a 128 bit hash of a large data block using multiple threads.
+		 * The data is split into chunks which are hashed independently and the chunk hashes are then hashed
+		 * together. Because of this the result is NOT equal to GetHash128() of the same data, but it is stable for
+		 * a given chunk size regardless of the thread count.
+		 *
+		 * @param pData: The data pointer.
+		 * @param size: The size of the data block.
+		 * @param seed: The seed to generate the hash from. Default is 0.
+		 * @param threadCount: The number of threads to use. 0 uses the hardware concurrency. Default is 0.
+		 * @param chunkSize: The size of a single chunk in bytes. Default is 4 MiB.
+		 * @return The hash as Hash128.
+		 */
+		Hash128 GetHashParallel(const void* pData, UI64 size, UI64 seed = 0, UI32 threadCount = 0, UI64 chunkSize = 4 * 1024 * 1024);
+
+		/**
+		 * Generate a 128 bit hash of a file using multiple threads, without loading the whole file to memory.
+		 * The result is equal to GetHashParallel() of the file contents when the same seed and chunk size is used.
+		 *
+		 * @param pPath: The path of the file.
+		 * @param seed: The seed to generate the hash from. Default is 0.
+		 * @param threadCount: The number of threads to use. 0 uses the hardware concurrency. Default is 0.
+		 * @param chunkSize: The size of a single chunk in bytes. Default is 4 MiB.
+		 * @return The hash as Hash128. Zero if the file could not be opened or read completely.
+		 */
+		Hash128 GetFileHash(const char* pPath, UI64 seed = 0, UI32 threadCount = 0, UI64 chunkSize = 4 * 1024 * 1024);
+
+		/**
+		 * Incremental hasher.
+		 * This object can be used to hash data which is not available as a single contiguous block (for example
+		 * when streaming an asset). Feeding the same bytes produces the same hash as GetHash()/ GetHash128(),
+		 * irrespective of how the data was split.
+		 */
+		class StreamHasher {
+		public:
+			/**
+			 * Construct the hasher using a seed.
+			 *
+			 * @param seed: The seed to generate the hash from. Default is 0.
+			 */
+			StreamHasher(UI64 seed = 0);
+
+			/**
+			 * Copy constructor. The internal state is copied.
+			 *
+			 * @param other: The other hasher.
+			 */
+			StreamHasher(const StreamHasher& other);
+
+			/**
+			 * Move constructor.
+			 *
+			 * @param other: The other hasher.
+			 */
+			StreamHasher(StreamHasher&& other) noexcept;
+
+			~StreamHasher();
+
+			/**
+			 * Copy assign operator.
+			 *
+			 * @param other: The other hasher.
+			 * @return This object.
+			 */
+			StreamHasher& operator=(const StreamHasher& other);
+
+			/**
+			 * Move assign operator.
+			 *
+			 * @param other: The other hasher.
+			 * @return This object.
+			 */
+			StreamHasher& operator=(StreamHasher&& other) noexcept;
+
+			/**
+			 * Reset the hasher to start a new hash.
+			 *
+			 * @param seed: The seed to generate the hash from. Default is 0.
+			 */
+			void Reset(UI64 seed = 0);
+
+			/**
+			 * Feed data to the hasher.
+			 *
+			 * @param pData: The data pointer.
+			 * @param size: The size of the data block.
+			 */
+			void Update(const void* pData, UI64 size);
+
+			/**
+			 * Get the 64 bit hash of the data fed so far.
+			 * More data can be fed after this call.
+			 *
+			 * @return The hash as UI64.
+			 */
+			UI64 Digest() const;
+
+			/**
+			 * Get the 128 bit hash of the data fed so far.
+			 * More data can be fed after this call.
+			 *
+			 * @return The hash as Hash128.
+			 */
+			Hash128 Digest128() const;
+
+		private:
+			XXH3_state_s* pState = nullptr;	// The xxhash state.
+		};
 	}
-}
\ No newline at end of file
+}
@@ -3,9 +3,37 @@
 
 #pragma once
 
+#include <type_traits>
+
 #define DMK_INLINE						inline
+#ifdef _MSC_VER
 #define DMK_FORCEINLINE					__forceinline
 
+#else
+#define DMK_FORCEINLINE					inline __attribute__((always_inline))
+
+#endif // _MSC_VER
+
 #define BIT_SHIFT(count)				(1 << count)
 
 #define TYPE_NAME(type)					typeid(type).name()
+#define TYPE_ID(type)					::DMK::TypeId<type>()	// Requires Core/Hash/CompileTimeHash.h
+
+/**
+ * Size of a cache line.
+ * Data written by different threads is separated by this much to avoid false sharing.
+ */
+#define DMK_CACHE_LINE_SIZE				64
+
+/**
+ * Check if the current evaluation is happening at compile time.
+ * This is used by constexpr functions to pick a plain scalar path when evaluated by the compiler and the SIMD path
+ * when executed at runtime.
+ */
+#ifdef __cpp_lib_is_constant_evaluated
+#define DMK_IS_CONSTANT_EVALUATED()		std::is_constant_evaluated()
+
+#else
+#define DMK_IS_CONSTANT_EVALUATED()		__builtin_is_constant_evaluated()
+
+#endif // __cpp_lib_is_constant_evaluated
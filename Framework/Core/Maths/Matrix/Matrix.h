@@ -30,14 +30,14 @@ namespace DMK
 		 *
 		 * @return The matrix.
 		 */
-		inline Type& operator()() { return *static_cast<Type*>(this); }
+		constexpr Type& operator()() { return *static_cast<Type*>(this); }
 
 		/**
 		 * Dereference operator to return the primitive type data.
 		 *
 		 * @return The const matrix.
 		 */
-		inline const Type& operator()() const { return *static_cast<const Type*>(this); }
+		constexpr const Type& operator()() const { return *static_cast<const Type*>(this); }
 
 		/**
 		 * Increment operator.
@@ -45,7 +45,7 @@ namespace DMK
 		 * @param rhs: The other matrix.
 		 * @return The incremented matrix.
 		 */
-		inline Type& operator+=(const Type& rhs)
+		constexpr Type& operator+=(const Type& rhs)
 		{
 			(*this)() = (*this)() + rhs;
 			return (*this)();
@@ -57,7 +57,7 @@ namespace DMK
 		 * @param rhs: The other primitive matrix data.
 		 * @return The incremented matrix.
 		 */
-		inline Type& operator+=(const value_type& rhs)
+		constexpr Type& operator+=(const value_type& rhs)
 		{
 			(*this)() = (*this)() + Type(rhs);
 			return (*this)();
@@ -69,7 +69,7 @@ namespace DMK
 		 * @param :
 		 * @return The incremented matrix.
 		 */
-		inline Type operator++(int)
+		constexpr Type operator++(int)
 		{
 			Type tmp = (*this)();
 			(*this) += value_type(1);
@@ -82,7 +82,7 @@ namespace DMK
 		 * @param :
 		 * @return The incremented matrix.
 		 */
-		inline Type& operator++()
+		constexpr Type& operator++()
 		{
 			(*this)() += value_type(1);
 			return (*this)();
@@ -94,7 +94,7 @@ namespace DMK
 		 * @param rhs: The other matrix to be decremented by.
 		 * @return The decremented matrix.
 		 */
-		inline Type& operator-=(const Type& rhs)
+		constexpr Type& operator-=(const Type& rhs)
 		{
 			(*this)() = (*this)() + rhs;
 			return (*this)();
@@ -106,7 +106,7 @@ namespace DMK
 		 * @param rhs: The other matrix to be decremented by.
 		 * @return The decremented matrix.
 		 */
-		inline Type& operator-=(const value_type& rhs)
+		constexpr Type& operator-=(const value_type& rhs)
 		{
 			(*this)() = (*this)() + Type(rhs);
 			return (*this)();
@@ -118,7 +118,7 @@ namespace DMK
 		 * @param :
 		 * @return The decremented matrix.
 		 */
-		inline Type operator--(int)
+		constexpr Type operator--(int)
 		{
 			Type tmp = (*this)();
 			(*this) -= value_type(1);
@@ -131,7 +131,7 @@ namespace DMK
 		 * @param :
 		 * @return The decremented matrix.
 		 */
-		inline Type& operator--()
+		constexpr Type& operator--()
 		{
 			(*this)() -= value_type(1);
 			return (*this)();
@@ -143,7 +143,7 @@ namespace DMK
 		 * @param rhs: The other matrix to be decremented by.
 		 * @return The decremented matrix.
 		 */
-		inline Type& operator*=(const Type& rhs)
+		constexpr Type& operator*=(const Type& rhs)
 		{
 			(*this)() = (*this)() * rhs;
 			return (*this)();
@@ -155,7 +155,7 @@ namespace DMK
 		 * @param rhs: The other matrix to be decremented by.
 		 * @return The decremented matrix.
 		 */
-		inline Type& operator*=(const value_type& rhs)
+		constexpr Type& operator*=(const value_type& rhs)
 		{
 			(*this)() = (*this)() * Type(rhs);
 			return (*this)();
@@ -167,7 +167,7 @@ namespace DMK
 		 * @param rhs: The other matrix to be decremented by.
 		 * @return The decremented matrix.
 		 */
-		inline Type& operator/=(const Type& rhs)
+		constexpr Type& operator/=(const Type& rhs)
 		{
 			(*this)() = (*this)() / rhs;
 			return (*this)();
@@ -179,21 +179,21 @@ namespace DMK
 		 * @param rhs: The other matrix to be decremented by.
 		 * @return The decremented matrix.
 		 */
-		inline Type& operator/=(const value_type& rhs)
+		constexpr Type& operator/=(const value_type& rhs)
 		{
 			(*this)() = (*this)() / Type(rhs);
 			return (*this)();
 		}
 
-		inline Matrix() {}
-		inline ~Matrix() {}
+		constexpr Matrix() {}
+		~Matrix() = default;
 
 		/**
 		 * Construct the matrix using another matrix.
 		 *
 		 * @param : The other matrix.
 		 */
-		inline Matrix(const Matrix&) {}
+		constexpr Matrix(const Matrix&) {}
 
 		/**
 		 * Return this matrix.
@@ -201,7 +201,7 @@ namespace DMK
 		 * @param :
 		 * @return This matrix.
 		 */
-		inline Matrix& operator=(const  Matrix&) { return *this; }
+		constexpr Matrix& operator=(const  Matrix&) { return *this; }
 
 		static Type Identity;
 	};
@@ -215,7 +215,7 @@ namespace DMK
 	 * @return The added matrix.
 	 */
 	template <class Type>
-	inline Matrix<Type> operator+(const Matrix<Type>& lhs,
+	constexpr Matrix<Type> operator+(const Matrix<Type>& lhs,
 		const typename MatrixTraits<Type>::type& rhs)
 	{
 		return lhs() + Type(rhs);
@@ -230,7 +230,7 @@ namespace DMK
 	 * @return The added matrix.
 	 */
 	template <class Type>
-	inline Matrix<Type> operator+(const typename MatrixTraits<Type>::type& lhs,
+	constexpr Matrix<Type> operator+(const typename MatrixTraits<Type>::type& lhs,
 		const Matrix<Type>& rhs)
 	{
 		return Type(lhs) + rhs();
@@ -245,7 +245,7 @@ namespace DMK
 	 * @return The subracted matrix.
 	 */
 	template <class Type>
-	inline Matrix<Type> operator-(const Matrix<Type>& lhs,
+	constexpr Matrix<Type> operator-(const Matrix<Type>& lhs,
 		const typename MatrixTraits<Type>::type& rhs)
 	{
 		return lhs() - Type(rhs);
@@ -260,7 +260,7 @@ namespace DMK
 	 * @return The subracted matrix.
 	 */
 	template <class Type>
-	inline Matrix<Type> operator-(const typename MatrixTraits<Type>::type& lhs,
+	constexpr Matrix<Type> operator-(const typename MatrixTraits<Type>::type& lhs,
 		const Matrix<Type>& rhs)
 	{
 		return Type(lhs) - rhs();
@@ -275,7 +275,7 @@ namespace DMK
 	 * @return The multiplied matrix.
 	 */
 	template <class Type>
-	inline Matrix<Type> operator*(const Matrix<Type>& lhs,
+	constexpr Matrix<Type> operator*(const Matrix<Type>& lhs,
 		const typename MatrixTraits<Type>::type& rhs)
 	{
 		return lhs() * Type(rhs);
@@ -290,7 +290,7 @@ namespace DMK
 	 * @return The multiplied matrix.
 	 */
 	template <class Type>
-	inline Matrix<Type> operator*(const typename MatrixTraits<Type>::type& lhs,
+	constexpr Matrix<Type> operator*(const typename MatrixTraits<Type>::type& lhs,
 		const Matrix<Type>& rhs)
 	{
 		return Type(lhs) * rhs();
@@ -305,7 +305,7 @@ namespace DMK
 	 * @return The divided matrix.
 	 */
 	template <class Type>
-	inline Matrix<Type> operator/(const Matrix<Type>& lhs,
+	constexpr Matrix<Type> operator/(const Matrix<Type>& lhs,
 		const typename MatrixTraits<Type>::type& rhs)
 	{
 		return lhs() / Type(rhs);
@@ -320,7 +320,7 @@ namespace DMK
 	 * @return The divided matrix.
 	 */
 	template <class Type>
-	inline Matrix<Type> operator/(const typename MatrixTraits<Type>::type& lhs,
+	constexpr Matrix<Type> operator/(const typename MatrixTraits<Type>::type& lhs,
 		const Matrix<Type>& rhs)
 	{
 		return Type(lhs) / rhs();
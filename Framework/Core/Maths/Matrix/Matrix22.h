@@ -25,14 +25,19 @@ namespace DMK
 	class Matrix22 : public Matrix<Matrix22>
 	{
 	public:
-		Matrix22();
+		constexpr Matrix22() : x(0.0f), y(0.0f) {}
 
 		/**
 		 * Construct the matrix using one value.
 		 *
 		 * @param value: The value to be constructed with.
 		 */
-		Matrix22(float value);
+		constexpr Matrix22(float value)
+			:
+			x(value, 0.0f),
+			y(0.0f, value)
+		{
+		}
 
 		/**
 		 * Set values to the matrix using two 2D vectors.
@@ -40,7 +45,10 @@ namespace DMK
 		 * @param vec1: Vector one.
 		 * @param vec2: Vector two.
 		 */
-		Matrix22(Vector2 vec1, Vector2 vec2);
+		constexpr Matrix22(Vector2 vec1, Vector2 vec2)
+			: x(vec1), y(vec2)
+		{
+		}
 
 		/**
 		 * Construct the matrix by setting individual values.
@@ -50,16 +58,19 @@ namespace DMK
 		 * @param c: Value to be set to z.
 		 * @param d: Value to be set to w.
 		 */
-		Matrix22(
+		constexpr Matrix22(
 			float a, float b,
-			float c, float d);
+			float c, float d)
+			: x(a, b), y(c, d)
+		{
+		}
 
 		/**
 		 * Construct the matrix using another matrix of the same type.
 		 *
 		 * @param other: The other matrix.
 		 */
-		Matrix22(const Matrix22& other);
+		constexpr Matrix22(const Matrix22& other) : x(other.x), y(other.y) {}
 
 		/**
 		 * Construct the matrix using an initializer list.
@@ -68,15 +79,19 @@ namespace DMK
 		 */
 		Matrix22(std::initializer_list<float> list);
 
-		~Matrix22() {}
-
 		/**
 		 * Assign data from another matrix of the same type.
 		 *
 		 * @param other: The other matrix.
 		 * @return The value updated matrix.
 		 */
-		Matrix22 operator=(const Matrix22& other);
+		constexpr Matrix22 operator=(const Matrix22& other)
+		{
+			this->x = other.x;
+			this->y = other.y;
+
+			return *this;
+		}
 
 		/**
 		 * Get a row of the matrix using the index.
@@ -84,7 +99,10 @@ namespace DMK
 		 * @param index: The index of the row.
 		 * @return The requested row.
 		 */
-		const Vector2 operator[](UI32 index) const;
+		constexpr const Vector2 operator[](UI32 index) const
+		{
+			return index == 0 ? x : y;
+		}
 
 		/**
 		 * Get a row of the matrix using the index.
@@ -92,7 +110,10 @@ namespace DMK
 		 * @param index: The index of the row.
 		 * @return The requested row.
 		 */
-		Vector2& operator[](UI32 index);
+		constexpr Vector2& operator[](UI32 index)
+		{
+			return index == 0 ? x : y;
+		}
 
 		/**
 		 * Multiply the matrix by a value.
@@ -100,7 +121,13 @@ namespace DMK
 		 * @param value: The value to be multiplied with.
 		 * @return The multiplied matrix.
 		 */
-		Matrix22& operator*(const float& value);
+		constexpr Matrix22& operator*(const float& value)
+		{
+			this->x *= value;
+			this->y *= value;
+
+			return *this;
+		}
 
 		/**
 		 * Multiplication operator.
@@ -109,7 +136,13 @@ namespace DMK
 		 * @param other: The vector 2D.
 		 * @return The multiplied vector 2D.
 		 */
-		Vector2 operator*(const Vector2& other);
+		constexpr Vector2 operator*(const Vector2& other) const
+		{
+			return Vector2(
+				(this->x[0] * other[0]) + (this->x[1] * other[1]),
+				(this->y[0] * other[0]) + (this->y[1] * other[1])
+			);
+		}
 
 		/**
 		 * Multiplication operator.
@@ -117,13 +150,41 @@ namespace DMK
 		 * @param other: The other matrix to be multiplied with.
 		 * @return The multiplied matrix.
 		 */
-		Matrix22& operator*(const Matrix22& other);
+		constexpr Matrix22& operator*(const Matrix22& other)
+		{
+			*this = static_cast<const Matrix22&>(*this) * other;
+			return *this;
+		}
 
-	public:
-		union
+		/**
+		 * Multiplication operator.
+		 * This does not modify the current matrix.
+		 *
+		 * @param other: The other matrix to be multiplied with.
+		 * @return The multiplied matrix.
+		 */
+		constexpr Matrix22 operator*(const Matrix22& other) const
 		{
-			struct { Vector2 x, y; };
-			struct { Vector2 r, g; };
-		};
+			const Matrix22& lhs = *this;
+			return Matrix22(
+				(lhs[0] * other[0][0]) + (lhs[1] * other[0][1]),
+				(lhs[0] * other[1][0]) + (lhs[1] * other[1][1])
+			);
+		}
+
+	public:
+		Vector2 x, y;
 	};
-}
+
+	/**
+	 * Multiply all the values of a matrix by a value.
+	 *
+	 * @param lhs: The matrix.
+	 * @param rhs: The value to be multiplied with.
+	 * @return The multiplied matrix.
+	 */
+	constexpr Matrix22 operator*(const Matrix22& lhs, const float& rhs)
+	{
+		return Matrix22(lhs.x * rhs, lhs.y * rhs);
+	}
+}
\ No newline at end of file
@@ -25,14 +25,20 @@ namespace DMK
 	class Matrix33 : public Matrix<Matrix33>
 	{
 	public:
-		Matrix33();
+		constexpr Matrix33() : x(0.0f), y(0.0f), z(0.0f) {}
 
 		/**
 		 * Construct the matrix using one value.
 		 *
 		 * @param value: The value to be constructed with.
 		 */
-		Matrix33(float value);
+		constexpr Matrix33(float value)
+			:
+			x(value, 0.0f, 0.0f),
+			y(0.0f, value, 0.0f),
+			z(0.0f, 0.0f, value)
+		{
+		}
 
 		/**
 		 * Construct the matrix using 3 Vector 3D structures.
@@ -41,7 +47,10 @@ namespace DMK
 		 * @param vec2: Vector two.
 		 * @param vec3: Vector three.
 		 */
-		Matrix33(Vector3 vec1, Vector3 vec2, Vector3 vec3);
+		constexpr Matrix33(Vector3 vec1, Vector3 vec2, Vector3 vec3)
+			: x(vec1), y(vec2), z(vec3)
+		{
+		}
 
 		/**
 		 * Construct the matrix using individual values.
@@ -56,17 +65,20 @@ namespace DMK
 		 * @param h: Value to be set to z.y.
 		 * @param i: Value to be set to z.z.
 		 */
-		Matrix33(
+		constexpr Matrix33(
 			float a, float b, float c,
 			float d, float e, float f,
-			float g, float h, float i);
+			float g, float h, float i)
+			: x(a, b, c), y(d, e, f), z(g, h, i)
+		{
+		}
 
 		/**
 		 * Construct the matrix using another matrix of the same type.
 		 *
 		 * @param other: The other matrix.
 		 */
-		Matrix33(const Matrix33& other);
+		constexpr Matrix33(const Matrix33& other) : x(other.x), y(other.y), z(other.z) {}
 
 		/**
 		 * Construct the matrix using an initializer list.
@@ -75,15 +87,20 @@ namespace DMK
 		 */
 		Matrix33(std::initializer_list<float> list);
 
-		~Matrix33() {}
-
 		/**
 		 * Assign data from another matrix of the same type.
 		 *
 		 * @param other: The other matrix.
 		 * @return The value updated matrix.
 		 */
-		Matrix33 operator=(const Matrix33& other);
+		constexpr Matrix33 operator=(const Matrix33& other)
+		{
+			this->x = other.x;
+			this->y = other.y;
+			this->z = other.z;
+
+			return *this;
+		}
 
 		/**
 		 * Retrieve a row by using the index.
@@ -91,7 +108,10 @@ namespace DMK
 		 * @param index: The index of the row.
 		 * @return The Vector 3D row.
 		 */
-		const Vector3 operator[](UI32 index) const;
+		constexpr const Vector3 operator[](UI32 index) const
+		{
+			return index == 0 ? x : index == 1 ? y : z;
+		}
 
 		/**
 		 * Retrieve a row by using the index.
@@ -99,7 +119,10 @@ namespace DMK
 		 * @param index: The index of the row.
 		 * @return The Vector 3D row.
 		 */
-		Vector3& operator[](UI32 index);
+		constexpr Vector3& operator[](UI32 index)
+		{
+			return index == 0 ? x : index == 1 ? y : z;
+		}
 
 		/**
 		 * Multiply the matrix by a value.
@@ -107,7 +130,14 @@ namespace DMK
 		 * @param value: The value to be multiplied with.
 		 * @return The multiplied matrix.
 		 */
-		Matrix33& operator*(const float& value);
+		constexpr Matrix33& operator*(const float& value)
+		{
+			this->x *= value;
+			this->y *= value;
+			this->z *= value;
+
+			return *this;
+		}
 
 		/**
 		 * Multiplication operator.
@@ -116,7 +146,14 @@ namespace DMK
 		 * @param other: The vector 3D.
 		 * @return The multiplied vector 3D.
 		 */
-		Vector3 operator*(const Vector3& other);
+		constexpr Vector3 operator*(const Vector3& other) const
+		{
+			return Vector3(
+				(this->x[0] * other[0]) + (this->x[1] * other[1]) + (this->x[2] * other[2]),
+				(this->y[0] * other[0]) + (this->y[1] * other[1]) + (this->y[2] * other[2]),
+				(this->z[0] * other[0]) + (this->z[1] * other[1]) + (this->z[2] * other[2])
+			);
+		}
 
 		/**
 		 * Multiplication operator.
@@ -124,13 +161,42 @@ namespace DMK
 		 * @param other: The other matrix to be multiplied with.
 		 * @return The multiplied matrix.
 		 */
-		Matrix33& operator*(const Matrix33& other);
+		constexpr Matrix33& operator*(const Matrix33& other)
+		{
+			*this = static_cast<const Matrix33&>(*this) * other;
+			return *this;
+		}
 
-	public:
-		union
+		/**
+		 * Multiplication operator.
+		 * This does not modify the current matrix.
+		 *
+		 * @param other: The other matrix to be multiplied with.
+		 * @return The multiplied matrix.
+		 */
+		constexpr Matrix33 operator*(const Matrix33& other) const
 		{
-			struct { Vector3 x, y, z; };
-			struct { Vector3 r, g, b; };
-		};
+			const Matrix33& lhs = *this;
+			return Matrix33(
+				(lhs[0] * other[0][0]) + (lhs[1] * other[0][1]) + (lhs[2] * other[0][2]),
+				(lhs[0] * other[1][0]) + (lhs[1] * other[1][1]) + (lhs[2] * other[1][2]),
+				(lhs[0] * other[2][0]) + (lhs[1] * other[2][1]) + (lhs[2] * other[2][2])
+			);
+		}
+
+	public:
+		Vector3 x, y, z;
 	};
-}
+
+	/**
+	 * Multiply all the values of a matrix by a value.
+	 *
+	 * @param lhs: The matrix.
+	 * @param rhs: The value to be multiplied with.
+	 * @return The multiplied matrix.
+	 */
+	constexpr Matrix33 operator*(const Matrix33& lhs, const float& rhs)
+	{
+		return Matrix33(lhs.x * rhs, lhs.y * rhs, lhs.z * rhs);
+	}
+}
\ No newline at end of file
@@ -25,14 +25,21 @@ namespace DMK
 	class Matrix44 : public Matrix<Matrix44>
 	{
 	public:
-		Matrix44();
+		constexpr Matrix44() : r(0.0f), g(0.0f), b(0.0f), a(0.0f) {}
 
 		/**
 		 * Construct the matrix using a value.
 		 *
 		 * @param value: The value to cnstruct the matrix with.
 		 */
-		Matrix44(float value);
+		constexpr Matrix44(float value)
+			:
+			r(value, 0.0f, 0.0f, 0.0f),
+			g(0.0f, value, 0.0f, 0.0f),
+			b(0.0f, 0.0f, value, 0.0f),
+			a(0.0f, 0.0f, 0.0f, value)
+		{
+		}
 
 		/**
 		 * Construct the matrix using 4 4D vectors.
@@ -42,7 +49,10 @@ namespace DMK
 		 * @param vec3: Vector three.
 		 * @param vec4: Vector four.
 		 */
-		Matrix44(Vector4 vec1, Vector4 vec2, Vector4 vec3, Vector4 vec4);
+		constexpr Matrix44(Vector4 vec1, Vector4 vec2, Vector4 vec3, Vector4 vec4)
+			: r(vec1), g(vec2), b(vec3), a(vec4)
+		{
+		}
 
 		/**
 		 * Construct the matrix using individual values.
@@ -64,18 +74,21 @@ namespace DMK
 		 * @param o: Value to be set to a.b.
 		 * @param p: Value to be set to a.a.
 		 */
-		Matrix44(
+		constexpr Matrix44(
 			float a, float b, float c, float d,
 			float e, float f, float g, float h,
 			float i, float j, float k, float l,
-			float m, float n, float o, float p);
+			float m, float n, float o, float p)
+			: r(a, b, c, d), g(e, f, g, h), b(i, j, k, l), a(m, n, o, p)
+		{
+		}
 
 		/**
 		 * Construct the matrix using another matrix of the same type.
 		 *
 		 * @param other: The other matrix.
 		 */
-		Matrix44(const Matrix44& other);
+		constexpr Matrix44(const Matrix44& other) : r(other.r), g(other.g), b(other.b), a(other.a) {}
 
 		/**
 		 * Construct the matrix using an initializer list.
@@ -84,15 +97,21 @@ namespace DMK
 		 */
 		Matrix44(std::initializer_list<float> list);
 
-		~Matrix44() {}
-
 		/**
 		 * Assign data from another matrix of the same type.
 		 *
 		 * @param other: The other matrix.
 		 * @return The value updated matrix.
 		 */
-		Matrix44 operator=(const Matrix44& other);
+		constexpr Matrix44 operator=(const Matrix44& other)
+		{
+			this->r = other.r;
+			this->g = other.g;
+			this->b = other.b;
+			this->a = other.a;
+
+			return *this;
+		}
 
 		/**
 		 * Retrieve a row using the index.
@@ -100,7 +119,10 @@ namespace DMK
 		 * @param index: The index of the row.
 		 * @return Vector 4D row.
 		 */
-		const Vector4 operator[](UI32 index) const;
+		constexpr const Vector4 operator[](UI32 index) const
+		{
+			return index == 0 ? r : index == 1 ? g : index == 2 ? b : a;
+		}
 
 		/**
 		 * Retrieve a row using the index.
@@ -108,7 +130,10 @@ namespace DMK
 		 * @param index: The index of the row.
 		 * @return Vector 4D row.
 		 */
-		Vector4& operator[](UI32 index);
+		constexpr Vector4& operator[](UI32 index)
+		{
+			return index == 0 ? r : index == 1 ? g : index == 2 ? b : a;
+		}
 
 		/**
 		 * Multiply the matrix by a value.
@@ -116,7 +141,15 @@ namespace DMK
 		 * @param value: The value to be multiplied with.
 		 * @return The multiplied matrix.
 		 */
-		Matrix44& operator*(const float& value);
+		constexpr Matrix44& operator*(const float& value)
+		{
+			this->r *= value;
+			this->g *= value;
+			this->b *= value;
+			this->a *= value;
+
+			return *this;
+		}
 
 		/**
 		 * Multiplication operator.
@@ -125,23 +158,59 @@ namespace DMK
 		 * @param other: The vector 4D.
 		 * @return The multiplied vector 4D.
 		 */
-		Vector4 operator*(const Vector4& other);
+		constexpr Vector4 operator*(const Vector4& other) const
+		{
+			return Vector4(
+				(this->r[0] * other[0]) + (this->r[1] * other[1]) + (this->r[2] * other[2]) + (this->r[3] * other[3]),
+				(this->g[0] * other[0]) + (this->g[1] * other[1]) + (this->g[2] * other[2]) + (this->g[3] * other[3]),
+				(this->b[0] * other[0]) + (this->b[1] * other[1]) + (this->b[2] * other[2]) + (this->b[3] * other[3]),
+				(this->a[0] * other[0]) + (this->a[1] * other[1]) + (this->a[2] * other[2]) + (this->a[3] * other[3])
+			);
+		}
+
+		/**
+		 * Multiplication operator.
+		 *
+		 * @param other: The other matrix to be multiplied with.
+		 * @return The multiplied matrix.
+		 */
+		constexpr Matrix44& operator*(const Matrix44& other)
+		{
+			*this = static_cast<const Matrix44&>(*this) * other;
+			return *this;
+		}
 
 		/**
 		 * Multiplication operator.
+		 * This does not modify the current matrix.
 		 *
 		 * @param other: The other matrix to be multiplied with.
 		 * @return The multiplied matrix.
 		 */
-		Matrix44& operator*(const Matrix44& other);
+		constexpr Matrix44 operator*(const Matrix44& other) const
+		{
+			const Matrix44& lhs = *this;
+			return Matrix44(
+				(lhs[0] * other[0][0]) + (lhs[1] * other[0][1]) + (lhs[2] * other[0][2]) + (lhs[3] * other[0][3]),
+				(lhs[0] * other[1][0]) + (lhs[1] * other[1][1]) + (lhs[2] * other[1][2]) + (lhs[3] * other[1][3]),
+				(lhs[0] * other[2][0]) + (lhs[1] * other[2][1]) + (lhs[2] * other[2][2]) + (lhs[3] * other[2][3]),
+				(lhs[0] * other[3][0]) + (lhs[1] * other[3][1]) + (lhs[2] * other[3][2]) + (lhs[3] * other[3][3])
+			);
+		}
 
 	public:
-		union
-		{
-			struct { Vector4 r, g, b, a; };
-			struct { Vector4 x, y, z, w; };
-		};
+		Vector4 r, g, b, a;
 	};
 
-	Matrix44 operator*(const Matrix44& lhs, const float& rhs);
+	/**
+	 * Multiply all the values of a matrix by a value.
+	 *
+	 * @param lhs: The matrix.
+	 * @param rhs: The value to be multiplied with.
+	 * @return The multiplied matrix.
+	 */
+	constexpr Matrix44 operator*(const Matrix44& lhs, const float& rhs)
+	{
+		return Matrix44(lhs.r * rhs, lhs.g * rhs, lhs.b * rhs, lhs.a * rhs);
+	}
 }
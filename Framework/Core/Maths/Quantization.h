@@ -0,0 +1,173 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Core/Types/DataTypes.h"
+#include "Core/Maths/Vector/Vector3.h"
+
+namespace DMK
+{
+	/**
+	 * This namespace contains functions to convert floating point data to and from the compact data types
+	 * (HALF, SNORM16, UNORM8 and octahedral normals).
+	 * The batch functions use F16C/ AVX2 when the engine is compiled with AVX2 support and fall back to scalar
+	 * code otherwise. Both paths produce the same results.
+	 */
+	namespace Quantization
+	{
+		/**
+		 * Convert a 32 bit float to a 16 bit half float (round to nearest even).
+		 *
+		 * @param value: The value to be converted.
+		 * @return The half float bits.
+		 */
+		UI16 FloatToHalf(float value);
+
+		/**
+		 * Convert a 16 bit half float to a 32 bit float.
+		 *
+		 * @param value: The half float bits.
+		 * @return The float value.
+		 */
+		float HalfToFloat(UI16 value);
+
+		/**
+		 * Convert a float to a signed normalized 16 bit integer.
+		 * The value is clamped to [-1, 1].
+		 *
+		 * @param value: The value to be converted.
+		 * @return The SNORM16 value.
+		 */
+		I16 FloatToSNorm16(float value);
+
+		/**
+		 * Convert a signed normalized 16 bit integer to a float.
+		 *
+		 * @param value: The SNORM16 value.
+		 * @return The float value in the range [-1, 1].
+		 */
+		float SNorm16ToFloat(I16 value);
+
+		/**
+		 * Convert a float to an unsigned normalized 8 bit integer.
+		 * The value is clamped to [0, 1].
+		 *
+		 * @param value: The value to be converted.
+		 * @return The UNORM8 value.
+		 */
+		UI8 FloatToUNorm8(float value);
+
+		/**
+		 * Convert an unsigned normalized 8 bit integer to a float.
+		 *
+		 * @param value: The UNORM8 value.
+		 * @return The float value in the range [0, 1].
+		 */
+		float UNorm8ToFloat(UI8 value);
+
+		/**
+		 * Encode a unit vector using octahedral mapping to two SNORM16 values (OCT_NORMAL16).
+		 *
+		 * @param normal: The normal vector. It does not need to be normalized.
+		 * @return The encoded value. X is stored in the lower 16 bits.
+		 */
+		UI32 EncodeOctahedral16(const Vector3& normal);
+
+		/**
+		 * Decode an octahedral encoded (OCT_NORMAL16) unit vector.
+		 *
+		 * @param value: The encoded value.
+		 * @return The normalized vector.
+		 */
+		Vector3 DecodeOctahedral16(UI32 value);
+
+		/**
+		 * Encode a unit vector using octahedral mapping to two SNORM8 values (OCT_NORMAL8).
+		 *
+		 * @param normal: The normal vector. It does not need to be normalized.
+		 * @return The encoded value. X is stored in the lower 8 bits.
+		 */
+		UI16 EncodeOctahedral8(const Vector3& normal);
+
+		/**
+		 * Decode an octahedral encoded (OCT_NORMAL8) unit vector.
+		 *
+		 * @param value: The encoded value.
+		 * @return The normalized vector.
+		 */
+		Vector3 DecodeOctahedral8(UI16 value);
+
+		/**
+		 * Convert a batch of floats to half floats.
+		 *
+		 * @param pDestination: The destination buffer. Must contain at least count elements.
+		 * @param pSource: The source floats.
+		 * @param count: The number of values to convert.
+		 */
+		void FloatToHalf(UI16* pDestination, const float* pSource, UI64 count);
+
+		/**
+		 * Convert a batch of half floats to floats.
+		 *
+		 * @param pDestination: The destination buffer. Must contain at least count elements.
+		 * @param pSource: The source half floats.
+		 * @param count: The number of values to convert.
+		 */
+		void HalfToFloat(float* pDestination, const UI16* pSource, UI64 count);
+
+		/**
+		 * Convert a batch of floats to SNORM16 values.
+		 *
+		 * @param pDestination: The destination buffer. Must contain at least count elements.
+		 * @param pSource: The source floats.
+		 * @param count: The number of values to convert.
+		 */
+		void FloatToSNorm16(I16* pDestination, const float* pSource, UI64 count);
+
+		/**
+		 * Convert a batch of SNORM16 values to floats.
+		 *
+		 * @param pDestination: The destination buffer. Must contain at least count elements.
+		 * @param pSource: The source SNORM16 values.
+		 * @param count: The number of values to convert.
+		 */
+		void SNorm16ToFloat(float* pDestination, const I16* pSource, UI64 count);
+
+		/**
+		 * Convert a batch of floats to UNORM8 values.
+		 *
+		 * @param pDestination: The destination buffer. Must contain at least count elements.
+		 * @param pSource: The source floats.
+		 * @param count: The number of values to convert.
+		 */
+		void FloatToUNorm8(UI8* pDestination, const float* pSource, UI64 count);
+
+		/**
+		 * Convert a batch of UNORM8 values to floats.
+		 *
+		 * @param pDestination: The destination buffer. Must contain at least count elements.
+		 * @param pSource: The source UNORM8 values.
+		 * @param count: The number of values to convert.
+		 */
+		void UNorm8ToFloat(float* pDestination, const UI8* pSource, UI64 count);
+
+		/**
+		 * Encode a batch of tightly packed normals (3 floats each) to OCT_NORMAL16 values.
+		 *
+		 * @param pDestination: The destination buffer. Must contain at least count elements.
+		 * @param pNormals: The source normals (x, y, z, x, y, z, ...).
+		 * @param count: The number of normals to encode.
+		 */
+		void EncodeOctahedral16(UI32* pDestination, const float* pNormals, UI64 count);
+
+		/**
+		 * Decode a batch of OCT_NORMAL16 values to tightly packed normals (3 floats each).
+		 *
+		 * @param pNormals: The destination normals. Must contain at least count * 3 floats.
+		 * @param pSource: The encoded values.
+		 * @param count: The number of normals to decode.
+		 */
+		void DecodeOctahedral16(float* pNormals, const UI32* pSource, UI64 count);
+	}
+}
@@ -29,14 +29,14 @@ namespace DMK
 		 *
 		 * @return The vector.
 		 */
-		inline Type& operator()() { return *static_cast<Type*>(this); }
+		constexpr Type& operator()() { return *static_cast<Type*>(this); }
 
 		/**
 		 * Dereference operator to return the primitive type data.
 		 *
 		 * @return The const vector.
 		 */
-		inline const Type& operator()() const { return *static_cast<const Type*>(this); }
+		constexpr const Type& operator()() const { return *static_cast<const Type*>(this); }
 
 		/**
 		 * Increment operator.
@@ -44,7 +44,7 @@ namespace DMK
 		 * @param rhs: The other vector.
 		 * @return The incremented vector.
 		 */
-		inline Type& operator+=(const Type& rhs)
+		constexpr Type& operator+=(const Type& rhs)
 		{
 			(*this)() = (*this)() + rhs;
 			return (*this)();
@@ -56,7 +56,7 @@ namespace DMK
 		 * @param rhs: The other primitive vector data.
 		 * @return The incremented vector.
 		 */
-		inline Type& operator+=(const value_type& rhs)
+		constexpr Type& operator+=(const value_type& rhs)
 		{
 			(*this)() = (*this)() + Type(rhs);
 			return (*this)();
@@ -68,7 +68,7 @@ namespace DMK
 		 * @param :
 		 * @return The incremented vector.
 		 */
-		inline Type operator++(int)
+		constexpr Type operator++(int)
 		{
 			Type tmp = (*this)();
 			(*this) += value_type(1);
@@ -81,7 +81,7 @@ namespace DMK
 		 * @param :
 		 * @return The incremented vector.
 		 */
-		inline Type& operator++()
+		constexpr Type& operator++()
 		{
 			(*this)() += value_type(1);
 			return (*this)();
@@ -93,7 +93,7 @@ namespace DMK
 		 * @param rhs: The other vector to be decremented by.
 		 * @return The decremented vector.
 		 */
-		inline Type& operator-=(const Type& rhs)
+		constexpr Type& operator-=(const Type& rhs)
 		{
 			(*this)() = (*this)() - rhs;
 			return (*this)();
@@ -105,7 +105,7 @@ namespace DMK
 		 * @param rhs: The other vector to be decremented by.
 		 * @return The decremented vector.
 		 */
-		inline Type& operator-=(const value_type& rhs)
+		constexpr Type& operator-=(const value_type& rhs)
 		{
 			(*this)() = (*this)() - Type(rhs);
 			return (*this)();
@@ -117,7 +117,7 @@ namespace DMK
 		 * @param :
 		 * @return The decremented vector.
 		 */
-		inline Type operator--(int)
+		constexpr Type operator--(int)
 		{
 			Type tmp = (*this)();
 			(*this) -= value_type(1);
@@ -130,7 +130,7 @@ namespace DMK
 		 * @param :
 		 * @return The decremented vector.
 		 */
-		inline Type& operator--()
+		constexpr Type& operator--()
 		{
 			(*this)() -= value_type(1);
 			return (*this)();
@@ -142,7 +142,7 @@ namespace DMK
 		 * @param rhs: The other vector to be decremented by.
 		 * @return The decremented vector.
 		 */
-		inline Type& operator*=(const Type& rhs)
+		constexpr Type& operator*=(const Type& rhs)
 		{
 			(*this)() = (*this)() * rhs;
 			return (*this)();
@@ -154,7 +154,7 @@ namespace DMK
 		 * @param rhs: The other vector to be decremented by.
 		 * @return The decremented vector.
 		 */
-		inline Type& operator*=(const value_type& rhs)
+		constexpr Type& operator*=(const value_type& rhs)
 		{
 			(*this)() = (*this)() * Type(rhs);
 			return (*this)();
@@ -166,7 +166,7 @@ namespace DMK
 		 * @param rhs: The other vector to be decremented by.
 		 * @return The decremented vector.
 		 */
-		inline Type& operator/=(const Type& rhs)
+		constexpr Type& operator/=(const Type& rhs)
 		{
 			(*this)() = (*this)() / rhs;
 			return (*this)();
@@ -178,21 +178,21 @@ namespace DMK
 		 * @param rhs: The other vector to be decremented by.
 		 * @return The decremented vector.
 		 */
-		inline Type& operator/=(const value_type& rhs)
+		constexpr Type& operator/=(const value_type& rhs)
 		{
 			(*this)() = (*this)() / Type(rhs);
 			return (*this)();
 		}
 
-		inline Vector() {}
-		inline ~Vector() {}
+		constexpr Vector() {}
+		~Vector() = default;
 
 		/**
 		 * Construct the vector using another vector.
 		 *
 		 * @param : The other vector.
 		 */
-		inline Vector(const Vector&) {}
+		constexpr Vector(const Vector&) {}
 
 		/**
 		 * Return this vector.
@@ -200,7 +200,7 @@ namespace DMK
 		 * @param :
 		 * @return This vector.
 		 */
-		inline Vector& operator=(const  Vector&) { return *this; }
+		constexpr Vector& operator=(const  Vector&) { return *this; }
 
 		static Type ZeroAll;
 	};
@@ -214,7 +214,7 @@ namespace DMK
 	 * @return The added vector.
 	 */
 	template <class Type>
-	inline Vector<Type> operator+(const Vector<Type>& lhs,
+	constexpr Vector<Type> operator+(const Vector<Type>& lhs,
 		const typename VectorTraits<Type>::type& rhs)
 	{
 		return lhs() + Type(rhs);
@@ -229,7 +229,7 @@ namespace DMK
 	 * @return The added vector.
 	 */
 	template <class Type>
-	inline Vector<Type> operator+(const typename VectorTraits<Type>::type& lhs,
+	constexpr Vector<Type> operator+(const typename VectorTraits<Type>::type& lhs,
 		const Vector<Type>& rhs)
 	{
 		return Type(lhs) + rhs();
@@ -244,7 +244,7 @@ namespace DMK
 	 * @return The subracted vector.
 	 */
 	template <class Type>
-	inline Vector<Type> operator-(const Vector<Type>& lhs,
+	constexpr Vector<Type> operator-(const Vector<Type>& lhs,
 		const typename VectorTraits<Type>::type& rhs)
 	{
 		return lhs() - Type(rhs);
@@ -259,7 +259,7 @@ namespace DMK
 	 * @return The subracted vector.
 	 */
 	template <class Type>
-	inline Vector<Type> operator-(const typename VectorTraits<Type>::type& lhs,
+	constexpr Vector<Type> operator-(const typename VectorTraits<Type>::type& lhs,
 		const Vector<Type>& rhs)
 	{
 		return Type(lhs) - rhs();
@@ -274,7 +274,7 @@ namespace DMK
 	 * @return The multiplied vector.
 	 */
 	template <class Type>
-	inline Vector<Type> operator*(const Vector<Type>& lhs,
+	constexpr Vector<Type> operator*(const Vector<Type>& lhs,
 		const typename VectorTraits<Type>::type& rhs)
 	{
 		return lhs() * Type(rhs);
@@ -289,7 +289,7 @@ namespace DMK
 	 * @return The multiplied vector.
 	 */
 	template <class Type>
-	inline Vector<Type> operator*(const typename VectorTraits<Type>::type& lhs,
+	constexpr Vector<Type> operator*(const typename VectorTraits<Type>::type& lhs,
 		const Vector<Type>& rhs)
 	{
 		return Type(lhs) * rhs();
@@ -304,7 +304,7 @@ namespace DMK
 	 * @return The divided vector.
 	 */
 	template <class Type>
-	inline Vector<Type> operator/(const Vector<Type>& lhs,
+	constexpr Vector<Type> operator/(const Vector<Type>& lhs,
 		const typename VectorTraits<Type>::type& rhs)
 	{
 		return lhs() / Type(rhs);
@@ -319,7 +319,7 @@ namespace DMK
 	 * @return The divided vector.
 	 */
 	template <class Type>
-	inline Vector<Type> operator/(const typename VectorTraits<Type>::type& lhs,
+	constexpr Vector<Type> operator/(const typename VectorTraits<Type>::type& lhs,
 		const Vector<Type>& rhs)
 	{
 		return Type(lhs) / rhs();
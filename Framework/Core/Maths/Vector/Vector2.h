@@ -5,6 +5,8 @@
 
 #include "Vector.h"
 #include "Core/Types/DataTypes.h"
+#include "Core/Macros/Global.h"
+#include "Core/ErrorHandler/Logger.h"
 #include <initializer_list>
 
 namespace DMK
@@ -26,14 +28,14 @@ namespace DMK
 	class Vector2 : public Vector<Vector2>
 	{
 	public:
-		Vector2() : x(0.0f), y(0.0f) {}
+		constexpr Vector2() : x(0.0f), y(0.0f) {}
 
 		/**
 		 * Constructu using one value which will be set to all (x, y)/ (a, b)/ (width, height).
 		 *
 		 * @param value: The value to be set with.
 		 */
-		Vector2(float value) : x(value), y(value) {}
+		constexpr Vector2(float value) : x(value), y(value) {}
 
 		/**
 		 * Set values to the stored data.
@@ -41,7 +43,7 @@ namespace DMK
 		 * @param value1: Value to be set to x/ a/ width.
 		 * @param value2: Value to be set to y/ b/ height.
 		 */
-		Vector2(float value1, float value2) : x(value1), y(value2) {}
+		constexpr Vector2(float value1, float value2) : x(value1), y(value2) {}
 
 		/**
 		 * Set data to the vector using an initializer list.
@@ -49,9 +51,14 @@ namespace DMK
 		 *
 		 * @param list: The initializer list.
 		 */
-		Vector2(std::initializer_list<float> list);
+		constexpr Vector2(std::initializer_list<float> list) : x(0.0f), y(0.0f)
+		{
+			if ((list.size() != 2) && !DMK_IS_CONSTANT_EVALUATED())
+				DMK_LOG_ERROR(TEXT("The size of the provided list does not match the current Vector size! Expected size is 2."));
 
-		~Vector2() {}
+			for (UI32 index = 0; (index < 2) && (index < list.size()); index++)
+				(*this)[index] = list.begin()[index];
+		}
 
 		/**
 		 * Load data from an initializer list.
@@ -67,7 +74,7 @@ namespace DMK
 		 * @param index: The index of the data to be accessed.
 		 * @return Float value at the index.
 		 */
-		const float operator[](UI32 index) const;
+		constexpr const float operator[](UI32 index) const { return index == 0 ? x : y; }
 
 		/**
 		 * Get data using the [] operator.
@@ -75,12 +82,12 @@ namespace DMK
 		 * @param index: The index of the data to be accessed.
 		 * @return Float value at the index.
 		 */
-		float& operator[](UI32 index);
+		constexpr float& operator[](UI32 index) { return index == 0 ? x : y; }
 
 		/**
 		 * Return the address of this since it can be accessed by the [] operator.
 		 */
-		operator const float* () const;
+		constexpr operator const float* () const { return &this->x; }
 
 	public:
 		union
@@ -100,7 +107,10 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return The calculated vector.
 	 */
-	Vector2 operator+(const Vector2& lhs, const Vector2& rhs);
+	constexpr Vector2 operator+(const Vector2& lhs, const Vector2& rhs)
+	{
+		return Vector2(lhs.x + rhs.x, lhs.y + rhs.y);
+	}
 
 	/**
 	 * Subtraction operator.
@@ -109,7 +119,10 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return The calculated vector.
 	 */
-	Vector2 operator-(const Vector2& lhs, const Vector2& rhs);
+	constexpr Vector2 operator-(const Vector2& lhs, const Vector2& rhs)
+	{
+		return Vector2(lhs.x - rhs.x, lhs.y - rhs.y);
+	}
 
 	/**
 	 * Multiplication operator.
@@ -118,7 +131,10 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return The calculated vector.
 	 */
-	Vector2 operator*(const Vector2& lhs, const Vector2& rhs);
+	constexpr Vector2 operator*(const Vector2& lhs, const Vector2& rhs)
+	{
+		return Vector2(lhs.x * rhs.x, lhs.y * rhs.y);
+	}
 
 	/**
 	 * Division operator.
@@ -127,7 +143,10 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return The calculated vector.
 	 */
-	Vector2 operator/(const Vector2& lhs, const Vector2& rhs);
+	constexpr Vector2 operator/(const Vector2& lhs, const Vector2& rhs)
+	{
+		return Vector2(lhs.x / rhs.x, lhs.y / rhs.y);
+	}
 
 	/**
 	 * Addition operator.
@@ -136,7 +155,10 @@ namespace DMK
 	 * @param value: RHS value.
 	 * @return The calculated vector.
 	 */
-	Vector2 operator+(const Vector2& lhs, const float& value);
+	constexpr Vector2 operator+(const Vector2& lhs, const float& value)
+	{
+		return lhs + Vector2(value);
+	}
 
 	/**
 	 * Subtraction operator.
@@ -145,7 +167,10 @@ namespace DMK
 	 * @param value: RHS value.
 	 * @return The calculated vector.
 	 */
-	Vector2 operator-(const Vector2& lhs, const float& value);
+	constexpr Vector2 operator-(const Vector2& lhs, const float& value)
+	{
+		return lhs - Vector2(value);
+	}
 
 	/**
 	 * Multiplication operator.
@@ -154,7 +179,10 @@ namespace DMK
 	 * @param value: RHS value.
 	 * @return The calculated vector.
 	 */
-	Vector2 operator*(const Vector2& lhs, const float& value);
+	constexpr Vector2 operator*(const Vector2& lhs, const float& value)
+	{
+		return lhs * Vector2(value);
+	}
 
 	/**
 	 * Division operator.
@@ -163,7 +191,10 @@ namespace DMK
 	 * @param value: RHS value.
 	 * @return The calculated vector.
 	 */
-	Vector2 operator/(const Vector2& lhs, const float& value);
+	constexpr Vector2 operator/(const Vector2& lhs, const float& value)
+	{
+		return lhs / Vector2(value);
+	}
 
 	/**
 	 * Is equal operator.
@@ -172,7 +203,10 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return Boolean value.
 	 */
-	bool operator==(const Vector2& lhs, const Vector2& rhs);
+	constexpr bool operator==(const Vector2& lhs, const Vector2& rhs)
+	{
+		return (lhs.x == rhs.x) && (lhs.y == rhs.y);
+	}
 
 	/**
 	 * Is not equal operator.
@@ -181,7 +215,10 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return Boolean value.
 	 */
-	bool operator!=(const Vector2& lhs, const Vector2& rhs);
+	constexpr bool operator!=(const Vector2& lhs, const Vector2& rhs)
+	{
+		return (lhs.x != rhs.x) || (lhs.y != rhs.y);
+	}
 
 	/**
 	 * Is less than operator.
@@ -190,7 +227,10 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return Boolean value.
 	 */
-	bool operator<(const Vector2& lhs, const Vector2& rhs);
+	constexpr bool operator<(const Vector2& lhs, const Vector2& rhs)
+	{
+		return (lhs.x < rhs.x) || (lhs.y < rhs.y);
+	}
 
 	/**
 	 * Is less than or equal operator.
@@ -199,7 +239,10 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return Boolean value.
 	 */
-	bool operator<=(const Vector2& lhs, const Vector2& rhs);
+	constexpr bool operator<=(const Vector2& lhs, const Vector2& rhs)
+	{
+		return (lhs.x <= rhs.x) || (lhs.y <= rhs.y);
+	}
 
 	/**
 	 * Is grater than operator.
@@ -208,7 +251,10 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return Boolean value.
 	 */
-	bool operator>(const Vector2& lhs, const Vector2& rhs);
+	constexpr bool operator>(const Vector2& lhs, const Vector2& rhs)
+	{
+		return (lhs.x > rhs.x) || (lhs.y > rhs.y);
+	}
 
 	/**
 	 * Is grater than or equal operator.
@@ -217,7 +263,10 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return Boolean value.
 	 */
-	bool operator>=(const Vector2& lhs, const Vector2& rhs);
+	constexpr bool operator>=(const Vector2& lhs, const Vector2& rhs)
+	{
+		return (lhs.x >= rhs.x) || (lhs.y >= rhs.y);
+	}
 
 	/**
 	 * AND operator.
@@ -5,6 +5,9 @@
 
 #include "Vector.h"
 #include "Core/Types/DataTypes.h"
+#include "Core/Macros/Global.h"
+#include "Core/Maths/IncludeSIMD.h"
+#include "Core/ErrorHandler/Logger.h"
 #include <initializer_list>
 
 namespace DMK
@@ -26,14 +29,14 @@ namespace DMK
 	 */
 	class Vector3 : public Vector<Vector3> {
 	public:
-		Vector3() : x(0.0f), y(0.0f), z(0.0f), w(0.0f) {}
+		constexpr Vector3() : x(0.0f), y(0.0f), z(0.0f), w(0.0f) {}
 
 		/**
 		 * Set one value to all the data stored.
 		 *
 		 * @param value: Value to be stored.
 		 */
-		Vector3(float value) : x(value), y(value), z(value), w(value) {}
+		constexpr Vector3(float value) : x(value), y(value), z(value), w(value) {}
 
 		/**
 		 * Values to be set to the internal variables.
@@ -42,14 +45,7 @@ namespace DMK
 		 * @param value2: Value to be set to y/ g/ height.
 		 * @param value3: Value to be set to z/ b/ depth.
 		 */
-		Vector3(float value1, float value2, float value3) : x(value1), y(value2), z(value3), w(0.0f) {}
-
-		/**
-		 * Construct the vector using another vector of the same type.
-		 *
-		 * @param other: The other vector.
-		 */
-		Vector3(const Vector3& other) : x(other.x), y(other.y), z(other.z), w(other.w) {}
+		constexpr Vector3(float value1, float value2, float value3) : x(value1), y(value2), z(value3), w(0.0f) {}
 
 		/**
 		 * Construct the vector using an initializer list.
@@ -57,7 +53,15 @@ namespace DMK
 		 *
 		 * @param list: The initializer list.
 		 */
-		Vector3(std::initializer_list<float> list);
+		constexpr Vector3(std::initializer_list<float> list) : x(0.0f), y(0.0f), z(0.0f), w(0.0f)
+		{
+			if ((list.size() != 3) && !DMK_IS_CONSTANT_EVALUATED())
+				DMK_LOG_ERROR(TEXT("The size of the provided list does not match the current Vector size!"));
+
+			for (UI32 index = 0; (index < 3) && (index < list.size()); index++)
+				(*this)[index] = list.begin()[index];
+			w = 0.0f;
+		}
 
 		/**
 		 * Construct the vector using a float pointer.
@@ -66,8 +70,6 @@ namespace DMK
 		 */
 		Vector3(const float* ptr);
 
-		~Vector3() {}
-
 		/**
 		 * Load data from an initializer list.
 		 *
@@ -82,7 +84,10 @@ namespace DMK
 		 * @param index: The index of the data to be accessed.
 		 * @return Float value at the index.
 		 */
-		const float operator[](UI32 index) const;
+		constexpr const float operator[](UI32 index) const
+		{
+			return index == 0 ? x : index == 1 ? y : index == 2 ? z : w;
+		}
 
 		/**
 		 * Get data using the [] operator.
@@ -90,12 +95,15 @@ namespace DMK
 		 * @param index: The index of the data to be accessed.
 		 * @return Float value at the index.
 		 */
-		float& operator[](UI32 index);
+		constexpr float& operator[](UI32 index)
+		{
+			return index == 0 ? x : index == 1 ? y : index == 2 ? z : w;
+		}
 
 		/**
 		 * Return the address of this since it can be accessed by the [] operator.
 		 */
-		operator const float* () const;
+		constexpr operator const float* () const { return &this->x; }
 
 		union
 		{
@@ -114,7 +122,24 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return The calculated vector.
 	 */
-	Vector3 operator+(const Vector3& lhs, const Vector3& rhs);
+	constexpr Vector3 operator+(const Vector3& lhs, const Vector3& rhs)
+	{
+		if (DMK_IS_CONSTANT_EVALUATED())
+		{
+			Vector3 vec = 0.0f;
+			vec.x = lhs.x + rhs.x;
+			vec.y = lhs.y + rhs.y;
+			vec.z = lhs.z + rhs.z;
+			vec.w = lhs.w + rhs.w;
+
+			return vec;
+		}
+
+		Vector3 vec = 0.0f;
+		_mm_storeu_ps(&vec.x, _mm_add_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
+
+		return vec;
+	}
 
 	/**
 	 * Subtraction operator.
@@ -123,7 +148,24 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return The calculated vector.
 	 */
-	Vector3 operator-(const Vector3& lhs, const Vector3& rhs);
+	constexpr Vector3 operator-(const Vector3& lhs, const Vector3& rhs)
+	{
+		if (DMK_IS_CONSTANT_EVALUATED())
+		{
+			Vector3 vec = 0.0f;
+			vec.x = lhs.x - rhs.x;
+			vec.y = lhs.y - rhs.y;
+			vec.z = lhs.z - rhs.z;
+			vec.w = lhs.w - rhs.w;
+
+			return vec;
+		}
+
+		Vector3 vec = 0.0f;
+		_mm_storeu_ps(&vec.x, _mm_sub_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
+
+		return vec;
+	}
 
 	/**
 	 * Multiplication operator.
@@ -132,7 +174,24 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return The calculated vector.
 	 */
-	Vector3 operator*(const Vector3& lhs, const Vector3& rhs);
+	constexpr Vector3 operator*(const Vector3& lhs, const Vector3& rhs)
+	{
+		if (DMK_IS_CONSTANT_EVALUATED())
+		{
+			Vector3 vec = 0.0f;
+			vec.x = lhs.x * rhs.x;
+			vec.y = lhs.y * rhs.y;
+			vec.z = lhs.z * rhs.z;
+			vec.w = lhs.w * rhs.w;
+
+			return vec;
+		}
+
+		Vector3 vec = 0.0f;
+		_mm_storeu_ps(&vec.x, _mm_mul_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
+
+		return vec;
+	}
 
 	/**
 	 * Division operator.
@@ -141,7 +200,24 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return The calculated vector.
 	 */
-	Vector3 operator/(const Vector3& lhs, const Vector3& rhs);
+	constexpr Vector3 operator/(const Vector3& lhs, const Vector3& rhs)
+	{
+		if (DMK_IS_CONSTANT_EVALUATED())
+		{
+			Vector3 vec = 0.0f;
+			vec.x = lhs.x / rhs.x;
+			vec.y = lhs.y / rhs.y;
+			vec.z = lhs.z / rhs.z;
+			vec.w = rhs.w != 0.0f ? lhs.w / rhs.w : 0.0f;
+
+			return vec;
+		}
+
+		Vector3 vec = 0.0f;
+		_mm_storeu_ps(&vec.x, _mm_div_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
+
+		return vec;
+	}
 
 	/**
 	 * Addition operator.
@@ -150,7 +226,10 @@ namespace DMK
 	 * @param value: RHS value.
 	 * @return The calculated vector.
 	 */
-	Vector3 operator+(const Vector3& lhs, const float& value);
+	constexpr Vector3 operator+(const Vector3& lhs, const float& value)
+	{
+		return lhs + Vector3(value);
+	}
 
 	/**
 	 * Subtraction operator.
@@ -159,7 +238,10 @@ namespace DMK
 	 * @param value: RHS value.
 	 * @return The calculated vector.
 	 */
-	Vector3 operator-(const Vector3& lhs, const float& value);
+	constexpr Vector3 operator-(const Vector3& lhs, const float& value)
+	{
+		return lhs - Vector3(value);
+	}
 
 	/**
 	 * Multiplication operator.
@@ -168,7 +250,10 @@ namespace DMK
 	 * @param value: RHS value.
 	 * @return The calculated vector.
 	 */
-	Vector3 operator*(const Vector3& lhs, const float& value);
+	constexpr Vector3 operator*(const Vector3& lhs, const float& value)
+	{
+		return lhs * Vector3(value);
+	}
 
 	/**
 	 * Division operator.
@@ -177,7 +262,10 @@ namespace DMK
 	 * @param value: RHS value.
 	 * @return The calculated vector.
 	 */
-	Vector3 operator/(const Vector3& lhs, const float& value);
+	constexpr Vector3 operator/(const Vector3& lhs, const float& value)
+	{
+		return lhs / Vector3(value);
+	}
 
 	/**
 	 * Is equal operator.
@@ -186,7 +274,16 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return Boolean value.
 	 */
-	bool operator==(const Vector3& lhs, const Vector3& rhs);
+	constexpr bool operator==(const Vector3& lhs, const Vector3& rhs)
+	{
+		if (DMK_IS_CONSTANT_EVALUATED())
+			return (lhs.x == rhs.x) && (lhs.y == rhs.y) && (lhs.z == rhs.z) && (lhs.w == rhs.w);
+
+		Vector3 vec = 0.0f;
+		_mm_storeu_ps(&vec.x, _mm_cmpeq_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
+
+		return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
+	}
 
 	/**
 	 * Is not equal operator.
@@ -195,7 +292,16 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return Boolean value.
 	 */
-	bool operator!=(const Vector3& lhs, const Vector3& rhs);
+	constexpr bool operator!=(const Vector3& lhs, const Vector3& rhs)
+	{
+		if (DMK_IS_CONSTANT_EVALUATED())
+			return (lhs.x != rhs.x) && (lhs.y != rhs.y) && (lhs.z != rhs.z) && (lhs.w != rhs.w);
+
+		Vector3 vec = 0.0f;
+		_mm_storeu_ps(&vec.x, _mm_cmpneq_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
+
+		return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
+	}
 
 	/**
 	 * Is less than operator.
@@ -204,7 +310,16 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return Boolean value.
 	 */
-	bool operator<(const Vector3& lhs, const Vector3& rhs);
+	constexpr bool operator<(const Vector3& lhs, const Vector3& rhs)
+	{
+		if (DMK_IS_CONSTANT_EVALUATED())
+			return (lhs.x < rhs.x) || (lhs.y < rhs.y) || (lhs.z < rhs.z) || (lhs.w < rhs.w);
+
+		Vector3 vec = 0.0f;
+		_mm_storeu_ps(&vec.x, _mm_cmplt_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
+
+		return ((vec.r) || (vec.g) || (vec.b) || (vec.a));
+	}
 
 	/**
 	 * Is less than or equal operator.
@@ -213,7 +328,16 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return Boolean value.
 	 */
-	bool operator<=(const Vector3& lhs, const Vector3& rhs);
+	constexpr bool operator<=(const Vector3& lhs, const Vector3& rhs)
+	{
+		if (DMK_IS_CONSTANT_EVALUATED())
+			return (lhs.x <= rhs.x) && (lhs.y <= rhs.y) && (lhs.z <= rhs.z) && (lhs.w <= rhs.w);
+
+		Vector3 vec = 0.0f;
+		_mm_storeu_ps(&vec.x, _mm_cmple_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
+
+		return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
+	}
 
 	/**
 	 * Is grater than operator.
@@ -222,7 +346,16 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return Boolean value.
 	 */
-	bool operator>(const Vector3& lhs, const Vector3& rhs);
+	constexpr bool operator>(const Vector3& lhs, const Vector3& rhs)
+	{
+		if (DMK_IS_CONSTANT_EVALUATED())
+			return (lhs.x > rhs.x) || (lhs.y > rhs.y) || (lhs.z > rhs.z) || (lhs.w > rhs.w);
+
+		Vector3 vec = 0.0f;
+		_mm_storeu_ps(&vec.x, _mm_cmpgt_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
+
+		return ((vec.r) || (vec.g) || (vec.b) || (vec.a));
+	}
 
 	/**
 	 * Is grater than or equal operator.
@@ -231,7 +364,16 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return Boolean value.
 	 */
-	bool operator>=(const Vector3& lhs, const Vector3& rhs);
+	constexpr bool operator>=(const Vector3& lhs, const Vector3& rhs)
+	{
+		if (DMK_IS_CONSTANT_EVALUATED())
+			return (lhs.x >= rhs.x) && (lhs.y >= rhs.y) && (lhs.z >= rhs.z) && (lhs.w >= rhs.w);
+
+		Vector3 vec = 0.0f;
+		_mm_storeu_ps(&vec.x, _mm_cmpge_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
+
+		return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
+	}
 
 	/**
 	 * AND operator.
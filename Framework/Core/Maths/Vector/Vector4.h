@@ -5,6 +5,9 @@
 
 #include "Vector.h"
 #include "Core/Types/DataTypes.h"
+#include "Core/Macros/Global.h"
+#include "Core/Maths/IncludeSIMD.h"
+#include "Core/ErrorHandler/Logger.h"
 #include <initializer_list>
 
 namespace DMK
@@ -26,14 +29,14 @@ namespace DMK
 	 */
 	class Vector4 : public Vector<Vector4> {
 	public:
-		Vector4() : r(0.0f), g(0.0f), b(0.0f), a(0.0f) {}
+		constexpr Vector4() : r(0.0f), g(0.0f), b(0.0f), a(0.0f) {}
 
 		/**
 		 * Set data to all the variables using one value.
 		 *
 		 * @param value: The value to be set.
 		 */
-		Vector4(float value) : r(value), g(value), b(value), a(value) {}
+		constexpr Vector4(float value) : r(value), g(value), b(value), a(value) {}
 
 		/**
 		 * Set values to all the variables.
@@ -43,14 +46,7 @@ namespace DMK
 		 * @param value3: Value to be set to b/ z/ depth.
 		 * @param value4: Value to be set to a/ w/ zero.
 		 */
-		Vector4(float value1, float value2, float value3, float value4) : r(value1), g(value2), b(value3), a(value4) {}
-
-		/**
-		 * Construct the vector using another vector of the same type.
-		 *
-		 * @param other: The other vector.
-		 */
-		Vector4(const Vector4& other) : r(other.r), g(other.g), b(other.b), a(other.a) {}
+		constexpr Vector4(float value1, float value2, float value3, float value4) : r(value1), g(value2), b(value3), a(value4) {}
 
 		/**
 		 * Construct the vector using an initializer list.
@@ -58,7 +54,14 @@ namespace DMK
 		 *
 		 * @param list: The initialize list.
 		 */
-		Vector4(std::initializer_list<float> list);
+		constexpr Vector4(std::initializer_list<float> list) : r(0.0f), g(0.0f), b(0.0f), a(0.0f)
+		{
+			if ((list.size() != 4) && !DMK_IS_CONSTANT_EVALUATED())
+				DMK_LOG_ERROR(TEXT("The size of the provided list does not match the current Vector size! Expected size is 4."));
+
+			for (UI32 index = 0; (index < 4) && (index < list.size()); index++)
+				(*this)[index] = list.begin()[index];
+		}
 
 		/**
 		 * Construct the vector using a float pointer.
@@ -67,8 +70,6 @@ namespace DMK
 		 */
 		Vector4(const float* ptr);
 
-		~Vector4() {}
-
 		/**
 		 * Load data from an initializer list.
 		 *
@@ -83,7 +84,10 @@ namespace DMK
 		 * @param index: The index of the data to be accessed.
 		 * @return Float value at the index.
 		 */
-		const float operator[](UI32 index) const;
+		constexpr const float operator[](UI32 index) const
+		{
+			return index == 0 ? r : index == 1 ? g : index == 2 ? b : a;
+		}
 
 		/**
 		 * Get data using the [] operator.
@@ -91,12 +95,15 @@ namespace DMK
 		 * @param index: The index of the data to be accessed.
 		 * @return Float value at the index.
 		 */
-		float& operator[](UI32 index);
+		constexpr float& operator[](UI32 index)
+		{
+			return index == 0 ? r : index == 1 ? g : index == 2 ? b : a;
+		}
 
 		/**
 		 * Return the address of this since it can be accessed by the [] operator.
 		 */
-		operator const float* () const;
+		constexpr operator const float* () const { return &this->r; }
 
 		union
 		{
@@ -115,7 +122,24 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return The calculated vector.
 	 */
-	Vector4 operator+(const Vector4& lhs, const Vector4& rhs);
+	constexpr Vector4 operator+(const Vector4& lhs, const Vector4& rhs)
+	{
+		if (DMK_IS_CONSTANT_EVALUATED())
+		{
+			Vector4 vec = 0.0f;
+			vec.r = lhs.r + rhs.r;
+			vec.g = lhs.g + rhs.g;
+			vec.b = lhs.b + rhs.b;
+			vec.a = lhs.a + rhs.a;
+
+			return vec;
+		}
+
+		Vector4 vec = 0.0f;
+		_mm_storeu_ps(&vec.x, _mm_add_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
+
+		return vec;
+	}
 
 	/**
 	 * Subtraction operator.
@@ -124,7 +148,24 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return The calculated vector.
 	 */
-	Vector4 operator-(const Vector4& lhs, const Vector4& rhs);
+	constexpr Vector4 operator-(const Vector4& lhs, const Vector4& rhs)
+	{
+		if (DMK_IS_CONSTANT_EVALUATED())
+		{
+			Vector4 vec = 0.0f;
+			vec.r = lhs.r - rhs.r;
+			vec.g = lhs.g - rhs.g;
+			vec.b = lhs.b - rhs.b;
+			vec.a = lhs.a - rhs.a;
+
+			return vec;
+		}
+
+		Vector4 vec = 0.0f;
+		_mm_storeu_ps(&vec.x, _mm_sub_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
+
+		return vec;
+	}
 
 	/**
 	 * Multiplication operator.
@@ -133,7 +174,24 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return The calculated vector.
 	 */
-	Vector4 operator*(const Vector4& lhs, const Vector4& rhs);
+	constexpr Vector4 operator*(const Vector4& lhs, const Vector4& rhs)
+	{
+		if (DMK_IS_CONSTANT_EVALUATED())
+		{
+			Vector4 vec = 0.0f;
+			vec.r = lhs.r * rhs.r;
+			vec.g = lhs.g * rhs.g;
+			vec.b = lhs.b * rhs.b;
+			vec.a = lhs.a * rhs.a;
+
+			return vec;
+		}
+
+		Vector4 vec = 0.0f;
+		_mm_storeu_ps(&vec.x, _mm_mul_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
+
+		return vec;
+	}
 
 	/**
 	 * Division operator.
@@ -142,7 +200,24 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return The calculated vector.
 	 */
-	Vector4 operator/(const Vector4& lhs, const Vector4& rhs);
+	constexpr Vector4 operator/(const Vector4& lhs, const Vector4& rhs)
+	{
+		if (DMK_IS_CONSTANT_EVALUATED())
+		{
+			Vector4 vec = 0.0f;
+			vec.r = lhs.r / rhs.r;
+			vec.g = lhs.g / rhs.g;
+			vec.b = lhs.b / rhs.b;
+			vec.a = lhs.a / rhs.a;
+
+			return vec;
+		}
+
+		Vector4 vec = 0.0f;
+		_mm_storeu_ps(&vec.x, _mm_div_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
+
+		return vec;
+	}
 
 	/**
 	 * Addition operator.
@@ -151,7 +226,10 @@ namespace DMK
 	 * @param value: RHS value.
 	 * @return The calculated vector.
 	 */
-	Vector4 operator+(const Vector4& lhs, const float& value);
+	constexpr Vector4 operator+(const Vector4& lhs, const float& value)
+	{
+		return lhs + Vector4(value);
+	}
 
 	/**
 	 * Subtraction operator.
@@ -160,7 +238,10 @@ namespace DMK
 	 * @param value: RHS value.
 	 * @return The calculated vector.
 	 */
-	Vector4 operator-(const Vector4& lhs, const float& value);
+	constexpr Vector4 operator-(const Vector4& lhs, const float& value)
+	{
+		return lhs - Vector4(value);
+	}
 
 	/**
 	 * Multiplication operator.
@@ -169,7 +250,10 @@ namespace DMK
 	 * @param value: RHS value.
 	 * @return The calculated vector.
 	 */
-	Vector4 operator*(const Vector4& lhs, const float& value);
+	constexpr Vector4 operator*(const Vector4& lhs, const float& value)
+	{
+		return lhs * Vector4(value);
+	}
 
 	/**
 	 * Division operator.
@@ -178,7 +262,10 @@ namespace DMK
 	 * @param value: RHS value.
 	 * @return The calculated vector.
 	 */
-	Vector4 operator/(const Vector4& lhs, const float& value);
+	constexpr Vector4 operator/(const Vector4& lhs, const float& value)
+	{
+		return lhs / Vector4(value);
+	}
 
 	/**
 	 * Is equal operator.
@@ -187,7 +274,16 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return Boolean value.
 	 */
-	bool operator==(const Vector4& lhs, const Vector4& rhs);
+	constexpr bool operator==(const Vector4& lhs, const Vector4& rhs)
+	{
+		if (DMK_IS_CONSTANT_EVALUATED())
+			return (lhs.r == rhs.r) && (lhs.g == rhs.g) && (lhs.b == rhs.b) && (lhs.a == rhs.a);
+
+		Vector4 vec = 0.0f;
+		_mm_storeu_ps(&vec.x, _mm_cmpeq_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
+
+		return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
+	}
 
 	/**
 	 * Is not equal operator.
@@ -196,7 +292,16 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return Boolean value.
 	 */
-	bool operator!=(const Vector4& lhs, const Vector4& rhs);
+	constexpr bool operator!=(const Vector4& lhs, const Vector4& rhs)
+	{
+		if (DMK_IS_CONSTANT_EVALUATED())
+			return (lhs.r != rhs.r) && (lhs.g != rhs.g) && (lhs.b != rhs.b) && (lhs.a != rhs.a);
+
+		Vector4 vec = 0.0f;
+		_mm_storeu_ps(&vec.x, _mm_cmpneq_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
+
+		return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
+	}
 
 	/**
 	 * Is less than operator.
@@ -205,7 +310,16 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return Boolean value.
 	 */
-	bool operator<(const Vector4& lhs, const Vector4& rhs);
+	constexpr bool operator<(const Vector4& lhs, const Vector4& rhs)
+	{
+		if (DMK_IS_CONSTANT_EVALUATED())
+			return (lhs.r < rhs.r) || (lhs.g < rhs.g) || (lhs.b < rhs.b) || (lhs.a < rhs.a);
+
+		Vector4 vec = 0.0f;
+		_mm_storeu_ps(&vec.x, _mm_cmplt_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
+
+		return ((vec.r) || (vec.g) || (vec.b) || (vec.a));
+	}
 
 	/**
 	 * Is less than or equal operator.
@@ -214,7 +328,16 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return Boolean value.
 	 */
-	bool operator<=(const Vector4& lhs, const Vector4& rhs);
+	constexpr bool operator<=(const Vector4& lhs, const Vector4& rhs)
+	{
+		if (DMK_IS_CONSTANT_EVALUATED())
+			return (lhs.r <= rhs.r) && (lhs.g <= rhs.g) && (lhs.b <= rhs.b) && (lhs.a <= rhs.a);
+
+		Vector4 vec = 0.0f;
+		_mm_storeu_ps(&vec.x, _mm_cmple_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
+
+		return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
+	}
 
 	/**
 	 * Is grater than operator.
@@ -223,7 +346,16 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return Boolean value.
 	 */
-	bool operator>(const Vector4& lhs, const Vector4& rhs);
+	constexpr bool operator>(const Vector4& lhs, const Vector4& rhs)
+	{
+		if (DMK_IS_CONSTANT_EVALUATED())
+			return (lhs.r > rhs.r) || (lhs.g > rhs.g) || (lhs.b > rhs.b) || (lhs.a > rhs.a);
+
+		Vector4 vec = 0.0f;
+		_mm_storeu_ps(&vec.x, _mm_cmpgt_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
+
+		return ((vec.r) || (vec.g) || (vec.b) || (vec.a));
+	}
 
 	/**
 	 * Is grater than or equal operator.
@@ -232,7 +364,16 @@ namespace DMK
 	 * @param rhs: RHS argument.
 	 * @return Boolean value.
 	 */
-	bool operator>=(const Vector4& lhs, const Vector4& rhs);
+	constexpr bool operator>=(const Vector4& lhs, const Vector4& rhs)
+	{
+		if (DMK_IS_CONSTANT_EVALUATED())
+			return (lhs.r >= rhs.r) && (lhs.g >= rhs.g) && (lhs.b >= rhs.b) && (lhs.a >= rhs.a);
+
+		Vector4 vec = 0.0f;
+		_mm_storeu_ps(&vec.x, _mm_cmpge_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
+
+		return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
+	}
 
 	/**
 	 * AND operator.
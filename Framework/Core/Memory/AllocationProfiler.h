@@ -0,0 +1,152 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Core/Types/DataTypes.h"
+#include "Core/Macros/Global.h"
+
+#include <atomic>
+#include <vector>
+
+namespace DMK
+{
+	/**
+	 * The allocation profiler samples the allocations made through the StaticAllocator and records the call stack
+	 * of each sample, so that the live memory can be attributed to the code which allocated it.
+	 *
+	 * Sampling is done per byte: on average one allocation is sampled every SamplingInterval bytes, with the
+	 * distance between samples drawn from an exponential distribution (a Poisson process over the allocated bytes).
+	 * Large allocations are therefore almost always sampled while small, frequent ones are sampled proportionally,
+	 * and each sample is weighted so that the reported values are unbiased estimates of the real ones.
+	 *
+	 * Allocations which are not sampled only cost a thread local subtraction, so the profiler can be left enabled
+	 * in production builds.
+	 */
+	namespace AllocationProfiler
+	{
+		constexpr UI64 DefaultSamplingInterval = 512 * 1024;	// Average number of bytes between two samples.
+		constexpr UI64 MaxStackDepth = 32;	// Maximum number of frames recorded per sample.
+
+		/**
+		 * Call Site Report structure.
+		 * The estimated allocations of a unique call stack.
+		 */
+		struct CallSiteReport {
+			void* pFrames[MaxStackDepth] = {};	// Return addresses, innermost first.
+			UI64 mFrameCount = 0;	// Number of valid frames.
+			UI64 mLiveBytes = 0;	// Estimated bytes which are not yet deallocated.
+			UI64 mLiveCount = 0;	// Estimated number of allocations which are not yet deallocated.
+			UI64 mTotalBytes = 0;	// Estimated bytes allocated since the profiler was enabled.
+			UI64 mTotalCount = 0;	// Estimated number of allocations since the profiler was enabled.
+		};
+
+		/**
+		 * Start sampling allocations.
+		 *
+		 * @param samplingInterval: Average number of bytes between two samples. Default is 512 KiB.
+		 */
+		void Enable(UI64 samplingInterval = DefaultSamplingInterval);
+
+		/**
+		 * Stop sampling new allocations. Deallocations of the sampled allocations are still tracked, so the live
+		 * values stay correct.
+		 */
+		void Disable();
+
+		/**
+		 * Get the average number of bytes between two samples.
+		 */
+		UI64 GetSamplingInterval();
+
+		/**
+		 * Get the estimated allocations of all the call sites.
+		 *
+		 * @return The call site reports.
+		 */
+		std::vector<CallSiteReport> GetCallSites();
+
+		/**
+		 * Write the call sites in the flamegraph folded stack format ("outer;...;inner bytes" per line).
+		 * The frames are symbolized when possible.
+		 *
+		 * @param pFilePath: The output file path.
+		 * @param bLiveBytes: Whether to write the live bytes instead of the total allocated bytes. Default is true.
+		 * @return True if the file was written.
+		 */
+		bool ExportFolded(const char* pFilePath, bool bLiveBytes = true);
+
+		/**
+		 * Write the call sites in the legacy heap profile format which pprof reads ("pprof <binary> <file>").
+		 * The mapped libraries are appended on Linux so that pprof can symbolize the addresses.
+		 *
+		 * @param pFilePath: The output file path.
+		 * @return True if the file was written.
+		 */
+		bool ExportHeapProfile(const char* pFilePath);
+
+		/**
+		 * Clear all the call sites and sampled allocations.
+		 */
+		void Reset();
+
+		namespace _Helpers
+		{
+			constexpr UI64 AddressFilterSize = 1 << 14;	// Number of address filter counters.
+
+			extern std::atomic<bool> bIsEnabled;	// Whether new allocations are sampled.
+			extern std::atomic<UI64> SampledCount;	// Number of live sampled allocations.
+			extern std::atomic<UI16> AddressFilter[AddressFilterSize];	// Live sampled allocations per address hash.
+			inline thread_local I64 BytesUntilSample = 0;	// Bytes the calling thread allocates before the next sample.
+
+			/**
+			 * Get the address filter index of an address.
+			 */
+			DMK_FORCEINLINE UI64 GetFilterIndex(const void* pAddress)
+			{
+				const UI64 address = reinterpret_cast<UI64>(pAddress);
+				return ((address >> 4) ^ (address >> 18)) & (AddressFilterSize - 1);
+			}
+
+			/**
+			 * Record a sampled allocation.
+			 */
+			void SampleAllocation(void* pAddress, UI64 size);
+
+			/**
+			 * Remove a sampled allocation if the address was sampled.
+			 */
+			void ReleaseAllocation(void* pAddress);
+		}
+
+		/**
+		 * Record an allocation.
+		 *
+		 * @param pAddress: The allocated address.
+		 * @param size: The size of the allocation in bytes.
+		 */
+		DMK_FORCEINLINE void RecordAllocation(void* pAddress, UI64 size)
+		{
+			if (!_Helpers::bIsEnabled.load(std::memory_order_relaxed) || !pAddress)
+				return;
+
+			if ((_Helpers::BytesUntilSample -= static_cast<I64>(size)) <= 0)
+				_Helpers::SampleAllocation(pAddress, size);
+		}
+
+		/**
+		 * Record a deallocation.
+		 * Addresses which were not sampled are rejected without locking.
+		 *
+		 * @param pAddress: The deallocated address.
+		 */
+		DMK_FORCEINLINE void RecordDeallocation(void* pAddress)
+		{
+			if (!_Helpers::SampledCount.load(std::memory_order_relaxed))
+				return;
+
+			if (_Helpers::AddressFilter[_Helpers::GetFilterIndex(pAddress)].load(std::memory_order_relaxed))
+				_Helpers::ReleaseAllocation(pAddress);
+		}
+	}
+}
@@ -4,9 +4,13 @@
 #pragma once
 
 #include "Core/Types/DataTypes.h"
+#include "Defines.h"
 
 namespace DMK
 {
+	template<class Type, UI64 DefaultAligment>
+	class StaticAllocator;
+
 	/**
 	 * The Automated Memory Manager.
 	 * This structure keeps track on all the memory allocations done by the DMK and terminates all the memory blocks
@@ -54,7 +58,7 @@ namespace DMK
 		template<class Type>
 		static Type* AllocateNew(UI64 size = sizeof(Type), UI64 offset = 0, UI64 alignment = 0)
 		{
-			Type* _pointer = StaticAllocator<Type>::RawAllocate(size, alignment, offset);
+			Type* _pointer = StaticAllocator<Type, DMK_ALIGNMENT>::RawAllocate(size, alignment, offset);
 			instance.memoryMap[(UI64)_pointer] = _pointer;
 
 			return _pointer;
@@ -9,6 +9,7 @@
 
 #include "Core/ErrorHandler/Logger.h"
 #include "AutomatedMemoryManager.h"
+#include "AllocationProfiler.h"
 #include "Core/Types/Utilities.h"
 #include "Core/Macros/Global.h"
 #include "Defines.h"
@@ -100,6 +101,8 @@ namespace DMK
 		 */
 		DMK_FORCEINLINE static void RawDeallocate(PTR location, UI64 byteSize = sizeof(Type), UI64 alignment = DefaultAligment, UI64 offset = 0)
 		{
+			AllocationProfiler::RecordDeallocation(location);
+
 			if (byteSize)
 				operator delete (location, byteSize, std::align_val_t{ alignment });
 			else
@@ -159,6 +162,8 @@ namespace DMK
 		 */
 		DMK_FORCEINLINE static void DeallocateArr(PTR location, UI64 byteSize = sizeof(Type), UI64 alignment = DefaultAligment, UI64 offset = 0)
 		{
+			AllocationProfiler::RecordDeallocation(location);
+
 			if (byteSize)
 				operator delete[](location, byteSize, std::align_val_t{ alignment });
 			else
@@ -213,6 +218,8 @@ namespace DMK
 #endif
 				}
 
+				AllocationProfiler::RecordAllocation(__newAddr, byteSize);
+
 				return Cast<PTR>(__newAddr);
 			}
 			catch (const std::exception&)
@@ -252,6 +259,8 @@ namespace DMK
 #endif
 				}
 
+				AllocationProfiler::RecordAllocation(__newAddr, byteSize);
+
 				return Cast<PTR>(__newAddr);
 			}
 			catch (const std::exception&)
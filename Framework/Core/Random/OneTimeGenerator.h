@@ -4,6 +4,7 @@
 #pragma once
 
 #include "Core/Types/DataTypes.h"
+#include <limits>
 
 namespace DMK
 {
@@ -11,6 +12,7 @@ namespace DMK
 	{
 		/**
 		 * Generate random once.
+		 * This uses the calling thread's RandomEngine. Use a RandomEngine directly when generating many values.
 		 *
 		 * @param lowerBound: The minimum bound of the random integer. Default is 0.
 		 * @param upperBound: The maximum bound of the random integer. Default is the integer max of UI64.
@@ -0,0 +1,320 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Core/Types/DataTypes.h"
+#include "Core/Macros/Global.h"
+
+#include <limits>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+
+#endif
+
+namespace DMK
+{
+	namespace Random
+	{
+		/**
+		 * Multiply two 64 bit integers and get the full 128 bit result.
+		 *
+		 * @param lhs: LHS argument.
+		 * @param rhs: RHS argument.
+		 * @param high: The variable to store the higher 64 bits.
+		 * @return The lower 64 bits.
+		 */
+		DMK_FORCEINLINE UI64 Multiply128(UI64 lhs, UI64 rhs, UI64& high)
+		{
+#if defined(_MSC_VER) && defined(_M_X64)
+			return _umul128(lhs, rhs, &high);
+
+#elif defined(__SIZEOF_INT128__)
+			const unsigned __int128 result = static_cast<unsigned __int128>(lhs) * rhs;
+			high = static_cast<UI64>(result >> 64);
+			return static_cast<UI64>(result);
+
+#else
+			const UI64 lhsLow = lhs & 0xffffffff, lhsHigh = lhs >> 32;
+			const UI64 rhsLow = rhs & 0xffffffff, rhsHigh = rhs >> 32;
+			const UI64 lowLow = lhsLow * rhsLow, lowHigh = lhsLow * rhsHigh;
+			const UI64 highLow = lhsHigh * rhsLow, highHigh = lhsHigh * rhsHigh;
+			const UI64 cross = (lowLow >> 32) + (highLow & 0xffffffff) + lowHigh;
+			high = highHigh + (highLow >> 32) + (cross >> 32);
+			return (cross << 32) | (lowLow & 0xffffffff);
+
+#endif
+		}
+
+		/**
+		 * SplitMix64 generator.
+		 * This is used to expand a single 64 bit seed to the state of the bigger generators.
+		 *
+		 * @param state: The state to advance.
+		 * @return The next value.
+		 */
+		DMK_FORCEINLINE UI64 SplitMix64(UI64& state)
+		{
+			UI64 value = (state += 0x9e3779b97f4a7c15);
+			value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9;
+			value = (value ^ (value >> 27)) * 0x94d049bb133111eb;
+			return value ^ (value >> 31);
+		}
+
+		/**
+		 * Random Engine for the Dynamik Engine.
+		 * This uses the xoshiro256** algorithm, which has a period of 2^256 - 1, passes the common statistical test
+		 * suites and only needs a few instructions per value.
+		 *
+		 * Engines are not thread safe. Use Split() or Jump() to create independent streams for multiple threads, or
+		 * use RandomEngine::ThreadLocal() which does this automatically.
+		 *
+		 * This satisfies the UniformRandomBitGenerator requirements so it can be used with the standard library
+		 * algorithms and distributions.
+		 */
+		class RandomEngine {
+		public:
+			typedef UI64 result_type;
+
+			/**
+			 * Construct the engine using a seed.
+			 *
+			 * @param seed: The seed. Default is a fixed value.
+			 */
+			RandomEngine(UI64 seed = 0x853c49e6748fea9b) { Seed(seed); }
+
+			/**
+			 * Seed the engine.
+			 * The seed is expanded using SplitMix64 so similar seeds produce unrelated streams.
+			 *
+			 * @param seed: The seed.
+			 */
+			void Seed(UI64 seed);
+
+			/**
+			 * Generate the next 64 bit value.
+			 *
+			 * @return Unsigned 64 bit integer.
+			 */
+			DMK_FORCEINLINE UI64 Next()
+			{
+				const UI64 result = RotateLeft(mState[1] * 5, 7) * 9;
+				const UI64 temporary = mState[1] << 17;
+
+				mState[2] ^= mState[0];
+				mState[3] ^= mState[1];
+				mState[1] ^= mState[2];
+				mState[0] ^= mState[3];
+
+				mState[2] ^= temporary;
+				mState[3] = RotateLeft(mState[3], 45);
+
+				return result;
+			}
+
+			/**
+			 * Generate an unbiased integer in the range [0, bound).
+			 * This uses Lemire's multiply and reject method, which needs a division only in rare cases.
+			 *
+			 * @param bound: The exclusive upper bound. 0 returns 0.
+			 * @return Unsigned 64 bit integer.
+			 */
+			DMK_FORCEINLINE UI64 NextBounded(UI64 bound)
+			{
+				UI64 high = 0;
+				UI64 low = Multiply128(Next(), bound, high);
+
+				if (low < bound)
+				{
+					const UI64 threshold = (0 - bound) % bound;
+					while (low < threshold)
+						low = Multiply128(Next(), bound, high);
+				}
+
+				return high;
+			}
+
+			/**
+			 * Generate an unbiased integer in the range [lowerBound, upperBound].
+			 *
+			 * @param lowerBound: The inclusive lower bound.
+			 * @param upperBound: The inclusive upper bound.
+			 * @return Unsigned 64 bit integer.
+			 */
+			UI64 NextInRange(UI64 lowerBound, UI64 upperBound);
+
+			/**
+			 * Generate a float in the range [0, 1).
+			 *
+			 * @return The float value.
+			 */
+			DMK_FORCEINLINE float NextFloat() { return static_cast<float>(Next() >> 40) * (1.0f / 16777216.0f); }
+
+			/**
+			 * Generate a float in the range [lowerBound, upperBound).
+			 *
+			 * @param lowerBound: The inclusive lower bound.
+			 * @param upperBound: The exclusive upper bound.
+			 * @return The float value.
+			 */
+			DMK_FORCEINLINE float NextFloat(float lowerBound, float upperBound) { return lowerBound + (upperBound - lowerBound) * NextFloat(); }
+
+			/**
+			 * Generate a double in the range [0, 1).
+			 *
+			 * @return The double value.
+			 */
+			DMK_FORCEINLINE double NextDouble() { return static_cast<double>(Next() >> 11) * (1.0 / 9007199254740992.0); }
+
+			/**
+			 * Fill an array with random 64 bit values.
+			 *
+			 * @param pArray: The array to be filled.
+			 * @param count: The number of values.
+			 */
+			void Fill(UI64* pArray, UI64 count);
+
+			/**
+			 * Fill an array with random floats in the range [0, 1).
+			 *
+			 * @param pArray: The array to be filled.
+			 * @param count: The number of values.
+			 */
+			void FillFloat(float* pArray, UI64 count);
+
+			/**
+			 * Advance the engine by 2^128 values.
+			 * This is used to generate 2^128 non-overlapping sub sequences for parallel computations.
+			 */
+			void Jump();
+
+			/**
+			 * Advance the engine by 2^192 values.
+			 * This is used to generate 2^64 starting points, from each of which Jump() will generate 2^64
+			 * non-overlapping sub sequences.
+			 */
+			void LongJump();
+
+			/**
+			 * Create an independent engine.
+			 * The returned engine continues from the current state and this engine jumps 2^128 values ahead, so the
+			 * two streams never overlap.
+			 *
+			 * @return The new engine.
+			 */
+			RandomEngine Split();
+
+			/**
+			 * Get the engine of the calling thread.
+			 * Each thread gets its own stream split from a process wide engine which is seeded from the system's
+			 * entropy source, so no locking is needed after the first call.
+			 *
+			 * @return The engine reference.
+			 */
+			static RandomEngine& ThreadLocal();
+
+		public:
+			/**
+			 * Generate the next value (UniformRandomBitGenerator).
+			 *
+			 * @return Unsigned 64 bit integer.
+			 */
+			DMK_FORCEINLINE result_type operator()() { return Next(); }
+
+			/**
+			 * Get the minimum value which can be generated.
+			 */
+			static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+
+			/**
+			 * Get the maximum value which can be generated.
+			 */
+			static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+		private:
+			/**
+			 * Rotate the bits of a value to the left.
+			 */
+			static DMK_FORCEINLINE UI64 RotateLeft(UI64 value, I32 count) { return (value << count) | (value >> (64 - count)); }
+
+			/**
+			 * Apply a jump polynomial to the state.
+			 *
+			 * @param pPolynomial: The polynomial (4 64 bit words).
+			 */
+			void ApplyJump(const UI64* pPolynomial);
+
+			friend class BatchRandomEngine;
+
+			UI64 mState[4] = {};	// Generator state.
+		};
+
+		/**
+		 * Batch Random Engine.
+		 * This runs 4 interleaved xoshiro256** streams so that arrays can be filled using AVX2 (4 values per step).
+		 * The results are the same with and without AVX2, but they differ from the values a single RandomEngine
+		 * generates.
+		 */
+		class BatchRandomEngine {
+		public:
+			/**
+			 * Construct the engine using a seed.
+			 *
+			 * @param seed: The seed. Default is a fixed value.
+			 */
+			BatchRandomEngine(UI64 seed = 0x853c49e6748fea9b);
+
+			/**
+			 * Construct the engine by splitting 4 streams from another engine.
+			 *
+			 * @param engine: The source engine. It jumps ahead 4 times.
+			 */
+			BatchRandomEngine(RandomEngine& engine);
+
+			/**
+			 * Fill an array with random 64 bit values.
+			 *
+			 * @param pArray: The array to be filled.
+			 * @param count: The number of values.
+			 */
+			void Fill(UI64* pArray, UI64 count);
+
+			/**
+			 * Fill an array with random floats in the range [0, 1).
+			 * Each 64 bit value produces two floats.
+			 *
+			 * @param pArray: The array to be filled.
+			 * @param count: The number of values.
+			 */
+			void FillFloat(float* pArray, UI64 count);
+
+			/**
+			 * Fill an array with random floats in the range [lowerBound, upperBound).
+			 *
+			 * @param pArray: The array to be filled.
+			 * @param count: The number of values.
+			 * @param lowerBound: The inclusive lower bound.
+			 * @param upperBound: The exclusive upper bound.
+			 */
+			void FillFloat(float* pArray, UI64 count, float lowerBound, float upperBound);
+
+		private:
+			/**
+			 * Initialize the lanes from an engine.
+			 *
+			 * @param engine: The source engine.
+			 */
+			void Initialize(RandomEngine& engine);
+
+			/**
+			 * Generate the next 4 values (one per lane).
+			 *
+			 * @param pValues: The array to store the values in.
+			 */
+			void Next(UI64* pValues);
+
+			alignas(32) UI64 mState[4][4] = {};	// Lane states. mState[word][lane].
+		};
+	}
+}
@@ -0,0 +1,116 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Core/Benchmark/ExternalMarkers.h"
+
+#ifdef DMK_ENABLE_ITT
+#include <unordered_map>
+
+#endif
+
+namespace DMK
+{
+	namespace Benchmark
+	{
+		ExternalMarker::ExternalMarker(const char* pName) : pName(pName)
+		{
+#ifdef DMK_ENABLE_ITT
+			pHandle = __itt_string_handle_create(pName);
+
+#endif
+		}
+
+		namespace ExternalMarkers
+		{
+			namespace _Helpers
+			{
+#ifdef DMK_ENABLE_ITT
+				__itt_domain* GetDomain()
+				{
+					static __itt_domain* pDomain = __itt_domain_create("Dynamik");
+					return pDomain;
+				}
+
+				/**
+				 * Get the ITT string handle of a command type.
+				 * The handles are cached per thread so that the lookup does not need a lock. Command names are
+				 * compiler generated type names and they are only known at run time.
+				 */
+				__itt_string_handle* GetCommandHandle(UI64 commandID, const char* pName)
+				{
+					thread_local std::unordered_map<UI64, __itt_string_handle*> mHandles;
+
+					auto& pHandle = mHandles[commandID];
+					if (!pHandle)
+						pHandle = __itt_string_handle_create(pName ? pName : "Unknown Command");
+
+					return pHandle;
+				}
+
+#endif
+
+#ifdef DMK_ENABLE_USDT
+				thread_local UI64 FrameIndex = 0;	// The calling thread's frame index.
+
+#endif
+
+#ifdef DMK_ENABLE_ITT
+				thread_local bool bIsInFrame = false;	// Whether the calling thread began an ITT frame.
+
+#endif
+			}
+
+			void BeginCommand([[maybe_unused]] UI64 commandID, [[maybe_unused]] const char* pName)
+			{
+#ifdef DMK_ENABLE_ITT
+				__itt_task_begin(_Helpers::GetDomain(), __itt_null, __itt_null, _Helpers::GetCommandHandle(commandID, pName));
+
+#endif
+#ifdef DMK_ENABLE_USDT
+				DTRACE_PROBE2(dynamik, command_begin, commandID, pName);
+
+#endif
+			}
+
+			void EndCommand([[maybe_unused]] UI64 commandID)
+			{
+#ifdef DMK_ENABLE_ITT
+				__itt_task_end(_Helpers::GetDomain());
+
+#endif
+#ifdef DMK_ENABLE_USDT
+				DTRACE_PROBE1(dynamik, command_end, commandID);
+
+#endif
+			}
+
+			void MarkFrame()
+			{
+#ifdef DMK_ENABLE_ITT
+				if (_Helpers::bIsInFrame)
+					__itt_frame_end_v3(_Helpers::GetDomain(), nullptr);
+
+				__itt_frame_begin_v3(_Helpers::GetDomain(), nullptr);
+				_Helpers::bIsInFrame = true;
+
+#endif
+#ifdef DMK_ENABLE_USDT
+				DTRACE_PROBE1(dynamik, frame, _Helpers::FrameIndex++);
+
+#endif
+			}
+
+			void SetThreadName([[maybe_unused]] const char* pName)
+			{
+#ifdef DMK_ENABLE_ITT
+				__itt_thread_set_name(pName);
+
+#endif
+#ifdef DMK_ENABLE_USDT
+				DTRACE_PROBE1(dynamik, thread_name, pName);
+
+#endif
+			}
+		}
+	}
+}
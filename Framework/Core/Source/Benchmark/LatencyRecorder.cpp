@@ -0,0 +1,333 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Core/Benchmark/LatencyRecorder.h"
+
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace DMK
+{
+	namespace Benchmark
+	{
+		void LatencyHistogram::Record(UI64 value, UI64 count)
+		{
+			mBuckets[GetBucketIndex(value)] += count;
+			mCount += count;
+			mSum += value * count;
+
+			if (value < mMin)
+				mMin = value;
+
+			if (value > mMax)
+				mMax = value;
+		}
+
+		void LatencyHistogram::Merge(const LatencyHistogram& other)
+		{
+			for (UI64 index = 0; index < BucketCount; index++)
+				mBuckets[index] += other.mBuckets[index];
+
+			mCount += other.mCount;
+			mSum += other.mSum;
+
+			if (other.mMin < mMin)
+				mMin = other.mMin;
+
+			if (other.mMax > mMax)
+				mMax = other.mMax;
+		}
+
+		void LatencyHistogram::Reset()
+		{
+			std::memset(mBuckets, 0, sizeof(mBuckets));
+			mCount = 0;
+			mSum = 0;
+			mMin = ~0ULL;
+			mMax = 0;
+		}
+
+		UI64 LatencyHistogram::GetPercentile(double percentile) const
+		{
+			if (!mCount)
+				return 0;
+
+			if (percentile < 0.0)
+				percentile = 0.0;
+			else if (percentile > 100.0)
+				percentile = 100.0;
+
+			// The rank of the requested value, counting from 1.
+			UI64 rank = static_cast<UI64>(percentile / 100.0 * static_cast<double>(mCount) + 0.5);
+			if (rank < 1)
+				rank = 1;
+
+			UI64 count = 0;
+			for (UI64 index = 0; index < BucketCount; index++)
+			{
+				count += mBuckets[index];
+				if (count >= rank)
+				{
+					// The exact extremes are known, so do not report past them.
+					const UI64 value = GetBucketUpperBound(index);
+					return value > mMax ? mMax : (value < mMin ? mMin : value);
+				}
+			}
+
+			return mMax;
+		}
+
+		void LatencyRecorder::Collect(LatencyHistogram& histogram)
+		{
+			UI64 count = 0;
+			for (UI64 index = 0; index < LatencyHistogram::BucketCount; index++)
+			{
+				const UI64 bucketCount = mBuckets[index].exchange(0, std::memory_order_relaxed);
+				if (!bucketCount)
+					continue;
+
+				histogram.mBuckets[index] += bucketCount;
+				count += bucketCount;
+
+				// Only the bucket of the minimum is known, so use its lower bound.
+				const UI64 lowerBound = LatencyHistogram::GetBucketLowerBound(index);
+				if (lowerBound < histogram.mMin)
+					histogram.mMin = lowerBound;
+			}
+
+			histogram.mCount += count;
+			histogram.mSum += mSum.exchange(0, std::memory_order_relaxed);
+
+			const UI64 max = mMax.exchange(0, std::memory_order_relaxed);
+			if (max > histogram.mMax)
+				histogram.mMax = max;
+		}
+
+		namespace Metrics
+		{
+			namespace _Helpers
+			{
+				constexpr UI64 SecondsPerMinute = 60;
+
+				/**
+				 * Metric structure.
+				 */
+				struct Metric {
+					Metric(const char* pName) : mRecorder(pName) {}
+
+					LatencyRecorder mRecorder;	// The recorder the values are recorded to.
+					LatencyHistogram mCurrentMinute;	// The minute which is being rolled up.
+					LatencyHistogram mLastSecond;	// The last completed second.
+					LatencyHistogram mLastMinute;	// The last completed minute.
+					LatencyHistogram mTotal;	// All the values.
+				};
+
+				std::vector<std::unique_ptr<Metric>> Metrics;	// All the metrics.
+				std::mutex MetricsMutex;	// Guards the metrics and their windows.
+
+				std::mutex ReporterMutex;	// Guards the reporter state.
+				std::condition_variable ReporterCondition;	// Wakes the reporter thread up to stop.
+				bool bShouldReport = false;	// Whether the reporter should keep running.
+
+				/**
+				 * Reporter Thread structure.
+				 * Stops the reporter when the program exits, before the metrics are destroyed.
+				 */
+				struct ReporterThreadHolder {
+					~ReporterThreadHolder()
+					{
+						{
+							std::lock_guard<std::mutex> _lock(ReporterMutex);
+							bShouldReport = false;
+						}
+
+						ReporterCondition.notify_all();
+
+						if (mThread.joinable())
+							mThread.join();
+					}
+
+					std::thread mThread;
+				} ReporterThread;	// The reporter thread.
+
+				/**
+				 * Find a metric by name. The metrics mutex must be locked.
+				 */
+				Metric* FindMetric(const char* pName)
+				{
+					for (auto& pMetric : Metrics)
+						if (strcmp(pMetric->mRecorder.GetName(), pName) == 0)
+							return pMetric.get();
+
+					return nullptr;
+				}
+
+				/**
+				 * Append a window of a metric to the dump file.
+				 */
+				void Dump(FILE* pFile, MetricDumpFormat format, UI64 time, const char* pName, const char* pWindow, const LatencyHistogram& histogram)
+				{
+					if (format == MetricDumpFormat::CSV)
+					{
+						fprintf(pFile, "%llu,%s,%s,%llu,%llu,%.1f,%llu,%llu,%llu,%llu,%llu,%llu\n",
+							time, pName, pWindow, histogram.GetCount(), histogram.GetMin(), histogram.GetMean(),
+							histogram.GetPercentile(50.0), histogram.GetPercentile(90.0), histogram.GetPercentile(95.0),
+							histogram.GetPercentile(99.0), histogram.GetPercentile(99.9), histogram.GetMax());
+					}
+					else
+					{
+						fprintf(pFile, "{\"time\":%llu,\"metric\":\"%s\",\"window\":\"%s\",\"count\":%llu,\"min\":%llu,\"mean\":%.1f,\"p50\":%llu,\"p90\":%llu,\"p95\":%llu,\"p99\":%llu,\"p999\":%llu,\"max\":%llu}\n",
+							time, pName, pWindow, histogram.GetCount(), histogram.GetMin(), histogram.GetMean(),
+							histogram.GetPercentile(50.0), histogram.GetPercentile(90.0), histogram.GetPercentile(95.0),
+							histogram.GetPercentile(99.0), histogram.GetPercentile(99.9), histogram.GetMax());
+					}
+				}
+
+				/**
+				 * Roll the windows of all the metrics up.
+				 *
+				 * @param pFile: The dump file. Can be nullptr.
+				 * @param format: The dump format.
+				 * @param bCompleteMinute: Whether the current minute is complete.
+				 */
+				void RollUp(FILE* pFile, MetricDumpFormat format, bool bCompleteMinute)
+				{
+					const UI64 time = static_cast<UI64>(std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+					LatencyHistogram second;
+
+					std::lock_guard<std::mutex> _lock(MetricsMutex);
+					for (auto& pMetric : Metrics)
+					{
+						second.Reset();
+						pMetric->mRecorder.Collect(second);
+
+						pMetric->mLastSecond = second;
+						pMetric->mCurrentMinute.Merge(second);
+						pMetric->mTotal.Merge(second);
+
+						if (pFile)
+							Dump(pFile, format, time, pMetric->mRecorder.GetName(), "second", second);
+
+						if (bCompleteMinute)
+						{
+							pMetric->mLastMinute = pMetric->mCurrentMinute;
+							pMetric->mCurrentMinute.Reset();
+
+							if (pFile)
+								Dump(pFile, format, time, pMetric->mRecorder.GetName(), "minute", pMetric->mLastMinute);
+						}
+					}
+
+					if (pFile)
+						fflush(pFile);
+				}
+
+				/**
+				 * Reporter thread function.
+				 */
+				void Report(FILE* pFile, MetricDumpFormat format)
+				{
+					auto nextTime = std::chrono::steady_clock::now();
+					UI64 secondCount = 0;
+
+					while (true)
+					{
+						nextTime += std::chrono::seconds(1);
+						{
+							std::unique_lock<std::mutex> _lock(ReporterMutex);
+							if (ReporterCondition.wait_until(_lock, nextTime, [] { return !bShouldReport; }))
+								break;
+						}
+
+						RollUp(pFile, format, ++secondCount % SecondsPerMinute == 0);
+					}
+
+					// Write the partial windows.
+					RollUp(pFile, format, true);
+
+					if (pFile)
+						fclose(pFile);
+				}
+			}
+
+			LatencyRecorder& GetLatencyRecorder(const char* pName)
+			{
+				std::lock_guard<std::mutex> _lock(_Helpers::MetricsMutex);
+				if (auto pMetric = _Helpers::FindMetric(pName))
+					return pMetric->mRecorder;
+
+				_Helpers::Metrics.push_back(std::make_unique<_Helpers::Metric>(pName));
+				return _Helpers::Metrics.back()->mRecorder;
+			}
+
+			bool GetSnapshot(const char* pName, MetricWindow window, LatencyHistogram& histogram)
+			{
+				std::lock_guard<std::mutex> _lock(_Helpers::MetricsMutex);
+				auto pMetric = _Helpers::FindMetric(pName);
+				if (!pMetric)
+					return false;
+
+				switch (window)
+				{
+				case DMK::Benchmark::MetricWindow::SECOND:
+					histogram = pMetric->mLastSecond;
+					break;
+
+				case DMK::Benchmark::MetricWindow::MINUTE:
+					histogram = pMetric->mLastMinute;
+					break;
+
+				case DMK::Benchmark::MetricWindow::TOTAL:
+					histogram = pMetric->mTotal;
+					break;
+
+				default:
+					return false;
+				}
+
+				return true;
+			}
+
+			bool StartReporting(const char* pFilePath, MetricDumpFormat format)
+			{
+				StopReporting();
+
+				FILE* pFile = nullptr;
+				if (pFilePath)
+				{
+					pFile = fopen(pFilePath, "a");
+					if (!pFile)
+						return false;
+
+					// Write the CSV header to new files.
+					if (format == MetricDumpFormat::CSV && ftell(pFile) == 0)
+						fprintf(pFile, "time,metric,window,count,min_ns,mean_ns,p50_ns,p90_ns,p95_ns,p99_ns,p999_ns,max_ns\n");
+				}
+
+				std::lock_guard<std::mutex> _lock(_Helpers::ReporterMutex);
+				_Helpers::bShouldReport = true;
+				_Helpers::ReporterThread.mThread = std::thread(_Helpers::Report, pFile, format);
+
+				return true;
+			}
+
+			void StopReporting()
+			{
+				{
+					std::lock_guard<std::mutex> _lock(_Helpers::ReporterMutex);
+					_Helpers::bShouldReport = false;
+				}
+
+				_Helpers::ReporterCondition.notify_all();
+
+				if (_Helpers::ReporterThread.mThread.joinable())
+					_Helpers::ReporterThread.mThread.join();
+			}
+		}
+	}
+}
@@ -0,0 +1,250 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Core/Benchmark/PerformanceCounters.h"
+
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <unordered_map>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#endif
+
+namespace DMK
+{
+	namespace Benchmark
+	{
+		namespace _Helpers
+		{
+			const char* COUNTER_NAMES[HardwareCounterCount] = {
+				"cycles",
+				"instructions",
+				"l1d_misses",
+				"llc_misses",
+				"branch_misses",
+			};
+
+			std::atomic<bool> bCountersEnabled = { false };	// Whether counter collection is enabled.
+
+			std::unordered_map<const ZoneDescriptor*, ZoneCounterReport> ZoneReports;	// Accumulated zone counters.
+			std::mutex ZoneReportMutex;	// Guards the zone reports.
+
+#ifdef __linux__
+			/**
+			 * Open a perf event for the calling thread.
+			 *
+			 * @param type: The event type.
+			 * @param config: The event config.
+			 * @param groupFileDescriptor: The group leader. -1 to create a new group.
+			 * @return The file descriptor. -1 if the event is not available.
+			 */
+			I32 OpenEvent(UI32 type, UI64 config, I32 groupFileDescriptor)
+			{
+				perf_event_attr attributes = {};
+				attributes.size = sizeof(perf_event_attr);
+				attributes.type = type;
+				attributes.config = config;
+				attributes.disabled = groupFileDescriptor < 0 ? 1 : 0;
+				attributes.exclude_kernel = 1;
+				attributes.exclude_hv = 1;
+				attributes.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+				return static_cast<I32>(syscall(__NR_perf_event_open, &attributes, 0, -1, groupFileDescriptor, 0));
+			}
+
+#endif
+		}
+
+		PerformanceCounters::PerformanceCounters()
+		{
+#ifdef __linux__
+			const std::pair<UI32, UI64> events[HardwareCounterCount] = {
+				{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+				{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+				{ PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+				{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+				{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+			};
+
+			// The first counter which opens becomes the group leader, so that all the counters are read together.
+			for (UI64 index = 0; index < HardwareCounterCount; index++)
+			{
+				const I32 fileDescriptor = _Helpers::OpenEvent(events[index].first, events[index].second, mLeader);
+				if (fileDescriptor < 0)
+					continue;
+
+				if (ioctl(fileDescriptor, PERF_EVENT_IOC_ID, &mIDs[index]) < 0)
+				{
+					close(fileDescriptor);
+					continue;
+				}
+
+				mFileDescriptors[index] = fileDescriptor;
+				if (mLeader < 0)
+					mLeader = fileDescriptor;
+			}
+
+			if (mLeader >= 0)
+			{
+				ioctl(mLeader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+				ioctl(mLeader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+			}
+
+#endif
+		}
+
+		PerformanceCounters::~PerformanceCounters()
+		{
+#ifdef __linux__
+			// Close the members before the leader.
+			for (UI64 index = HardwareCounterCount; index > 0; index--)
+				if (mFileDescriptors[index - 1] >= 0 && mFileDescriptors[index - 1] != mLeader)
+					close(mFileDescriptors[index - 1]);
+
+			if (mLeader >= 0)
+				close(mLeader);
+
+#endif
+		}
+
+		bool PerformanceCounters::Read(CounterValues& values) const
+		{
+			values = CounterValues();
+
+#ifdef __linux__
+			if (mLeader < 0)
+				return false;
+
+			// Layout: count, time enabled, time running, { value, id } * count.
+			UI64 buffer[3 + 2 * HardwareCounterCount] = {};
+			if (read(mLeader, buffer, sizeof(buffer)) <= 0)
+				return false;
+
+			const UI64 count = buffer[0];
+			const UI64 timeEnabled = buffer[1];
+			const UI64 timeRunning = buffer[2];
+
+			// The group did not get a chance to run (not enough hardware counters).
+			if (!timeRunning)
+				return false;
+
+			for (UI64 entry = 0; entry < count && entry < HardwareCounterCount; entry++)
+			{
+				const UI64 value = buffer[3 + entry * 2];
+				const UI64 id = buffer[4 + entry * 2];
+
+				for (UI64 index = 0; index < HardwareCounterCount; index++)
+				{
+					if (mFileDescriptors[index] >= 0 && mIDs[index] == id)
+					{
+						// Scale the value up if the counters were multiplexed.
+						values.mValues[index] = timeRunning < timeEnabled ? static_cast<UI64>(static_cast<double>(value) * static_cast<double>(timeEnabled) / static_cast<double>(timeRunning)) : value;
+						break;
+					}
+				}
+			}
+
+			return true;
+
+#else
+			return false;
+
+#endif
+		}
+
+		void PerformanceCounters::SetEnabled(bool bEnable)
+		{
+			_Helpers::bCountersEnabled.store(bEnable, std::memory_order_relaxed);
+		}
+
+		bool PerformanceCounters::IsEnabled()
+		{
+			return _Helpers::bCountersEnabled.load(std::memory_order_relaxed);
+		}
+
+		PerformanceCounters& PerformanceCounters::ThreadLocal()
+		{
+			thread_local PerformanceCounters mCounters;
+			return mCounters;
+		}
+
+		const char* PerformanceCounters::GetName(HardwareCounter counter)
+		{
+			return static_cast<UI64>(counter) < HardwareCounterCount ? _Helpers::COUNTER_NAMES[static_cast<UI8>(counter)] : "unknown";
+		}
+
+		CounterZone::CounterZone(const ZoneDescriptor& descriptor)
+		{
+			if (!PerformanceCounters::IsEnabled())
+				return;
+
+			if (PerformanceCounters::ThreadLocal().Read(mBeginValues))
+				pDescriptor = &descriptor;
+		}
+
+		CounterZone::~CounterZone()
+		{
+			if (!pDescriptor)
+				return;
+
+			CounterValues endValues;
+			if (!PerformanceCounters::ThreadLocal().Read(endValues))
+				return;
+
+			std::lock_guard<std::mutex> _lock(_Helpers::ZoneReportMutex);
+			auto& report = _Helpers::ZoneReports[pDescriptor];
+			report.pDescriptor = pDescriptor;
+			report.mValues += endValues - mBeginValues;
+			report.mCallCount++;
+		}
+
+		std::vector<ZoneCounterReport> CounterZone::GetReports()
+		{
+			std::vector<ZoneCounterReport> reports;
+
+			std::lock_guard<std::mutex> _lock(_Helpers::ZoneReportMutex);
+			reports.reserve(_Helpers::ZoneReports.size());
+			for (const auto& report : _Helpers::ZoneReports)
+				reports.push_back(report.second);
+
+			return reports;
+		}
+
+		bool CounterZone::ExportReport(const char* pFilePath)
+		{
+			FILE* pFile = fopen(pFilePath, "w");
+			if (!pFile)
+				return false;
+
+			fprintf(pFile, "zone,function,file,line,calls");
+			for (UI64 index = 0; index < HardwareCounterCount; index++)
+				fprintf(pFile, ",%s", _Helpers::COUNTER_NAMES[index]);
+
+			fprintf(pFile, ",ipc,l1d_mpki,llc_mpki,branch_mpki\n");
+
+			for (const auto& report : GetReports())
+			{
+				fprintf(pFile, "\"%s\",\"%s\",\"%s\",%u,%llu", report.pDescriptor->pName, report.pDescriptor->pFunction, report.pDescriptor->pFile, report.pDescriptor->mLine, report.mCallCount);
+				for (UI64 index = 0; index < HardwareCounterCount; index++)
+					fprintf(pFile, ",%llu", report.mValues.mValues[index]);
+
+				fprintf(pFile, ",%.3f,%.3f,%.3f,%.3f\n", report.mValues.GetIPC(), report.mValues.GetL1DMissesPerKiloInstruction(), report.mValues.GetLLCMissesPerKiloInstruction(), report.mValues.GetBranchMissesPerKiloInstruction());
+			}
+
+			fclose(pFile);
+			return true;
+		}
+
+		void CounterZone::ResetReports()
+		{
+			std::lock_guard<std::mutex> _lock(_Helpers::ZoneReportMutex);
+			_Helpers::ZoneReports.clear();
+		}
+	}
+}
@@ -0,0 +1,348 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Core/Benchmark/Profiler.h"
+#include "Core/Types/RingBuffer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace DMK
+{
+	namespace Benchmark
+	{
+		namespace Profiler
+		{
+			namespace _Helpers
+			{
+				constexpr UI64 ThreadBufferSize = 1 << 14;	// Number of zones buffered per thread.
+
+				/**
+				 * Zone Event structure.
+				 */
+				struct ZoneEvent {
+					const ZoneDescriptor* pDescriptor = nullptr;
+					UI64 mBeginTicks = 0;
+					UI64 mEndTicks = 0;
+					UI32 mDepth = 0;
+					UI32 mThreadIndex = 0;
+				};
+
+				/**
+				 * Frame Event structure.
+				 */
+				struct FrameEvent {
+					UI64 mTicks = 0;
+					UI64 mFrameIndex = 0;
+				};
+
+				/**
+				 * Thread Buffer structure.
+				 * The owning thread is the only producer. Collecting happens under the collector mutex, so there is
+				 * only one consumer at a time.
+				 */
+				struct ThreadBuffer {
+					RingBuffer<ZoneEvent, ThreadBufferSize> mEvents;	// Recorded zones.
+					std::atomic<const char*> pName = { nullptr };	// Thread name.
+					UI32 mIndex = 0;	// Thread index.
+					std::atomic<bool> bRetired = { false };	// Whether the owning thread has exited.
+				};
+
+				/**
+				 * Thread Buffer Handle structure.
+				 * Marks the buffer as retired when the owning thread exits.
+				 */
+				struct ThreadBufferHandle {
+					~ThreadBufferHandle()
+					{
+						if (pBuffer)
+							pBuffer->bRetired.store(true, std::memory_order_release);
+					}
+
+					std::shared_ptr<ThreadBuffer> pBuffer;
+					UI32 mDepth = 0;	// Current zone nesting depth.
+				};
+
+				/**
+				 * Thread Info structure.
+				 * Collected thread names, kept after the thread exits.
+				 */
+				struct ThreadInfo {
+					const char* pName = nullptr;
+					UI32 mIndex = 0;
+				};
+
+				std::atomic<bool> bIsActive = { false };	// Whether a session is active.
+				std::atomic<UI64> DroppedCount = { 0 };	// Number of dropped zones.
+
+				std::mutex CollectorMutex;	// Guards the state below.
+				std::vector<std::shared_ptr<ThreadBuffer>> Buffers;	// Registered thread buffers.
+				std::vector<ThreadInfo> Threads;	// Names of the threads which recorded zones.
+				std::vector<ZoneEvent> Zones;	// Collected zones.
+				std::vector<FrameEvent> Frames;	// Frame markers.
+				UI64 SessionBeginTicks = 0;	// Ticks when the session began.
+				UI32 NextThreadIndex = 0;	// Index of the next registered thread.
+				double TicksPerNanosecond = 1.0;	// Calibrated tick rate.
+
+				thread_local ThreadBufferHandle CurrentThreadBuffer;	// The calling thread's buffer.
+
+				/**
+				 * Measure the number of time stamp counter ticks per nanosecond.
+				 */
+				double Calibrate()
+				{
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+					const auto beginTime = std::chrono::steady_clock::now();
+					const UI64 beginTicks = GetTicks();
+
+					auto endTime = beginTime;
+					while (endTime - beginTime < std::chrono::milliseconds(10))
+						endTime = std::chrono::steady_clock::now();
+
+					const UI64 endTicks = GetTicks();
+					return static_cast<double>(endTicks - beginTicks) / static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - beginTime).count());
+
+#else
+					return 1.0;
+
+#endif
+				}
+
+				/**
+				 * Get the buffer of the calling thread.
+				 */
+				ThreadBuffer& GetThreadBuffer()
+				{
+					auto& handle = CurrentThreadBuffer;
+					if (!handle.pBuffer)
+					{
+						handle.pBuffer = std::make_shared<ThreadBuffer>();
+
+						std::lock_guard<std::mutex> _lock(CollectorMutex);
+						handle.pBuffer->mIndex = NextThreadIndex++;
+						Buffers.push_back(handle.pBuffer);
+						Threads.push_back({ nullptr, handle.pBuffer->mIndex });
+					}
+
+					return *handle.pBuffer;
+				}
+
+				/**
+				 * Move the zones of all the threads to the collected zones.
+				 * The collector mutex must be locked.
+				 */
+				void Collect()
+				{
+					for (auto itr = Buffers.begin(); itr != Buffers.end();)
+					{
+						const bool bRetired = (*itr)->bRetired.load(std::memory_order_acquire);
+
+						ZoneEvent event;
+						while ((*itr)->mEvents.TryPop(event))
+							Zones.push_back(event);
+
+						if (const char* pName = (*itr)->pName.load(std::memory_order_relaxed))
+							Threads[(*itr)->mIndex].pName = pName;
+
+						if (bRetired)
+							itr = Buffers.erase(itr);
+						else
+							itr++;
+					}
+				}
+
+				/**
+				 * Write a string as a JSON string.
+				 */
+				void WriteJSONString(FILE* pFile, const char* pString)
+				{
+					fputc('"', pFile);
+					for (; pString && *pString; pString++)
+					{
+						if (*pString == '"' || *pString == '\\')
+							fputc('\\', pFile);
+
+						fputc(*pString, pFile);
+					}
+					fputc('"', pFile);
+				}
+			}
+
+			void BeginSession()
+			{
+				_Helpers::bIsActive.store(false, std::memory_order_release);
+				const double ticksPerNanosecond = _Helpers::Calibrate();
+
+				std::lock_guard<std::mutex> _lock(_Helpers::CollectorMutex);
+				_Helpers::Collect();
+				_Helpers::Zones.clear();
+				_Helpers::Frames.clear();
+				_Helpers::DroppedCount.store(0, std::memory_order_relaxed);
+
+				_Helpers::TicksPerNanosecond = ticksPerNanosecond;
+				_Helpers::SessionBeginTicks = GetTicks();
+				_Helpers::bIsActive.store(true, std::memory_order_release);
+			}
+
+			void EndSession()
+			{
+				_Helpers::bIsActive.store(false, std::memory_order_release);
+
+				std::lock_guard<std::mutex> _lock(_Helpers::CollectorMutex);
+				_Helpers::Collect();
+			}
+
+			bool IsActive()
+			{
+				return _Helpers::bIsActive.load(std::memory_order_relaxed);
+			}
+
+			void MarkFrame()
+			{
+				if (!IsActive())
+					return;
+
+				const UI64 ticks = GetTicks();
+
+				std::lock_guard<std::mutex> _lock(_Helpers::CollectorMutex);
+				_Helpers::Frames.push_back({ ticks, _Helpers::Frames.size() });
+				_Helpers::Collect();
+			}
+
+			void SetThreadName(const char* pName)
+			{
+				_Helpers::GetThreadBuffer().pName.store(pName, std::memory_order_relaxed);
+			}
+
+			double GetTicksPerNanosecond()
+			{
+				std::lock_guard<std::mutex> _lock(_Helpers::CollectorMutex);
+				return _Helpers::TicksPerNanosecond;
+			}
+
+			UI64 GetDroppedZoneCount()
+			{
+				return _Helpers::DroppedCount.load(std::memory_order_relaxed);
+			}
+
+			bool ExportChromeTrace(const char* pFilePath)
+			{
+				FILE* pFile = fopen(pFilePath, "w");
+				if (!pFile)
+					return false;
+
+				std::lock_guard<std::mutex> _lock(_Helpers::CollectorMutex);
+				_Helpers::Collect();
+
+				// Chrome expects the time in microseconds.
+				const double ticksPerMicrosecond = _Helpers::TicksPerNanosecond * 1000.0;
+				const auto toMicroseconds = [&](UI64 ticks) { return static_cast<double>(ticks - _Helpers::SessionBeginTicks) / ticksPerMicrosecond; };
+
+				fprintf(pFile, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+				fprintf(pFile, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"Dynamik\"}}");
+
+				for (const auto& thread : _Helpers::Threads)
+				{
+					if (!thread.pName)
+						continue;
+
+					fprintf(pFile, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", thread.mIndex);
+					_Helpers::WriteJSONString(pFile, thread.pName);
+					fprintf(pFile, "}}");
+				}
+
+				for (const auto& frame : _Helpers::Frames)
+					fprintf(pFile, ",\n{\"name\":\"Frame %llu\",\"cat\":\"frame\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":%.3f}", frame.mFrameIndex, toMicroseconds(frame.mTicks));
+
+				for (const auto& zone : _Helpers::Zones)
+				{
+					// Zones which began before the session are clamped to its beginning.
+					const UI64 beginTicks = std::max(zone.mBeginTicks, _Helpers::SessionBeginTicks);
+					const UI64 endTicks = std::max(zone.mEndTicks, beginTicks);
+
+					fprintf(pFile, ",\n{\"name\":");
+					_Helpers::WriteJSONString(pFile, zone.pDescriptor->pName);
+					fprintf(pFile, ",\"cat\":\"zone\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"function\":", zone.mThreadIndex, toMicroseconds(beginTicks), static_cast<double>(endTicks - beginTicks) / ticksPerMicrosecond);
+					_Helpers::WriteJSONString(pFile, zone.pDescriptor->pFunction);
+					fprintf(pFile, ",\"file\":");
+					_Helpers::WriteJSONString(pFile, zone.pDescriptor->pFile);
+					fprintf(pFile, ",\"line\":%u,\"depth\":%u}}", zone.pDescriptor->mLine, zone.mDepth);
+				}
+
+				fprintf(pFile, "\n]}\n");
+				fclose(pFile);
+
+				return true;
+			}
+
+			double MeasureZoneOverhead(UI64 iterations)
+			{
+				if (!IsActive() || !iterations)
+					return 0.0;
+
+				static constexpr ZoneDescriptor mDescriptor = { "MeasureZoneOverhead", "MeasureZoneOverhead", __FILE__, __LINE__ };
+
+				// Collect regularly so that the buffer never overflows, and only time the zones.
+				const UI64 batchSize = _Helpers::ThreadBufferSize / 2;
+				UI64 totalTicks = 0;
+
+				for (UI64 recorded = 0; recorded < iterations;)
+				{
+					const UI64 count = std::min(batchSize, iterations - recorded);
+					const UI64 beginTicks = GetTicks();
+
+					for (UI64 index = 0; index < count; index++)
+						ProfilerZone zone(mDescriptor);
+
+					totalTicks += GetTicks() - beginTicks;
+					recorded += count;
+
+					std::lock_guard<std::mutex> _lock(_Helpers::CollectorMutex);
+					_Helpers::Collect();
+				}
+
+				// Remove the measured zones from the recording.
+				{
+					std::lock_guard<std::mutex> _lock(_Helpers::CollectorMutex);
+					_Helpers::Zones.erase(std::remove_if(_Helpers::Zones.begin(), _Helpers::Zones.end(), [](const _Helpers::ZoneEvent& event) { return event.pDescriptor == &mDescriptor; }), _Helpers::Zones.end());
+				}
+
+				return static_cast<double>(totalTicks) / _Helpers::TicksPerNanosecond / static_cast<double>(iterations);
+			}
+
+			bool EnterZone()
+			{
+				if (!IsActive())
+					return false;
+
+				_Helpers::CurrentThreadBuffer.mDepth++;
+				return true;
+			}
+
+			void LeaveZone(const ZoneDescriptor& descriptor, UI64 beginTicks, UI64 endTicks)
+			{
+				auto& buffer = _Helpers::GetThreadBuffer();
+				const UI32 depth = --_Helpers::CurrentThreadBuffer.mDepth;
+
+				_Helpers::ZoneEvent* pEvent = buffer.mEvents.TryReserve();
+				if (!pEvent)
+				{
+					_Helpers::DroppedCount.fetch_add(1, std::memory_order_relaxed);
+					return;
+				}
+
+				pEvent->pDescriptor = &descriptor;
+				pEvent->mBeginTicks = beginTicks;
+				pEvent->mEndTicks = endTicks;
+				pEvent->mDepth = depth;
+				pEvent->mThreadIndex = buffer.mIndex;
+				buffer.mEvents.Commit();
+			}
+		}
+	}
+}
@@ -4,6 +4,7 @@
 #include "Core/Benchmark/Timer.h"
 
 #include <chrono>
+#include <cwchar>
 
 namespace DMK
 {
@@ -13,22 +14,46 @@ namespace DMK
 			: pTimerName(nullptr),
 			mStartTime(std::chrono::time_point_cast<std::chrono::microseconds>(
 				std::chrono::high_resolution_clock::now()
-				).time_since_epoch().count()) {}
+				).time_since_epoch().count())
+		{
+			BeginCounters();
+		}
 
 		Timer::Timer(const wchar* pText)
 			: pTimerName(pText),
 			mStartTime(std::chrono::time_point_cast<std::chrono::microseconds>(
 				std::chrono::high_resolution_clock::now()
-				).time_since_epoch().count()) {}
+				).time_since_epoch().count())
+		{
+			BeginCounters();
+		}
 
 		Timer::~Timer()
 		{
 			I64 endTime = std::chrono::time_point_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now()).time_since_epoch().count();
 
+			// Read the counters before printing, so the console output is not counted.
+			CounterValues endCounters;
+			const bool bCountersRead = bHasCounters && PerformanceCounters::ThreadLocal().Read(endCounters);
+
 			if (pTimerName)
-				wprintf_s(TEXT("%s\n"), pTimerName);
+				std::wprintf(TEXT("%ls\n"), pTimerName);
 
-			wprintf_s(TEXT("Time taken: %lld (microseconds)\n"), endTime - mStartTime);
+			std::wprintf(TEXT("Time taken: %lld (microseconds)\n"), endTime - mStartTime);
+
+			if (bCountersRead)
+			{
+				const CounterValues counters = endCounters - mBeginCounters;
+				std::wprintf(TEXT("Cycles: %llu, Instructions: %llu, IPC: %.2f, L1D MPKI: %.2f, LLC MPKI: %.2f, Branch MPKI: %.2f\n"),
+					counters.Get(HardwareCounter::CYCLES), counters.Get(HardwareCounter::INSTRUCTIONS), counters.GetIPC(),
+					counters.GetL1DMissesPerKiloInstruction(), counters.GetLLCMissesPerKiloInstruction(), counters.GetBranchMissesPerKiloInstruction());
+			}
+		}
+
+		void Timer::BeginCounters()
+		{
+			if (PerformanceCounters::IsEnabled())
+				bHasCounters = PerformanceCounters::ThreadLocal().Read(mBeginCounters);
 		}
 	}
 }
\ No newline at end of file
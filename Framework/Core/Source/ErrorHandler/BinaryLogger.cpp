@@ -0,0 +1,464 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Core/ErrorHandler/BinaryLogger.h"
+#include "Core/Types/RingBuffer.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace DMK
+{
+	namespace BinaryLogger
+	{
+		namespace _Helpers
+		{
+			constexpr UI64 ThreadBufferSize = 1 << 18;	// Number of bytes buffered per thread.
+			constexpr UI64 WriterInterval = 10;	// Maximum time (in milliseconds) a record waits before being written.
+
+			/**
+			 * Thread Buffer structure.
+			 * Each logging thread owns one of these per session. The thread is the only producer and the writer thread
+			 * is the only consumer.
+			 */
+			struct ThreadBuffer {
+				RingBuffer<UI8, ThreadBufferSize> mBytes;	// Encoded records.
+				UI64 mIndex = 0;	// Thread index within the session.
+				UI64 mSessionID = 0;	// The session the buffer belongs to.
+				std::chrono::steady_clock::time_point mBaseTime;	// Time the session started.
+				UI64 mLastTimeStamp = 0;	// Producer side: time stamp of the previous record.
+				std::atomic<bool> bRetired = { false };	// Whether the owning thread has exited.
+			};
+
+			/**
+			 * Append a raw value to a byte vector in the machine's (little endian) byte order.
+			 */
+			template<class Type>
+			void Append(std::vector<UI8>& bytes, const Type& value)
+			{
+				const UI8* pBytes = reinterpret_cast<const UI8*>(&value);
+				bytes.insert(bytes.end(), pBytes, pBytes + sizeof(Type));
+			}
+
+			/**
+			 * Append a variable length integer to a byte vector.
+			 */
+			void AppendVarInt(std::vector<UI8>& bytes, UI64 value)
+			{
+				UI8 buffer[10] = {};
+				bytes.insert(bytes.end(), buffer, WriteVarInt(buffer, value));
+			}
+
+			/**
+			 * Append a length prefixed string to a byte vector.
+			 */
+			void AppendString(std::vector<UI8>& bytes, const char* pString)
+			{
+				const UI64 length = pString ? strlen(pString) : 0;
+				AppendVarInt(bytes, length);
+				bytes.insert(bytes.end(), pString, pString + length);
+			}
+
+			std::vector<LogFormat*> Formats;	// Registered formats. The index is the format ID - 1.
+			std::mutex FormatMutex;	// Guards the format registry.
+
+			std::atomic<UI64> DroppedCount = { 0 };	// Number of dropped records.
+
+			// The wake up primitives outlive the sessions so that logging threads never touch a session which is
+			// being destroyed.
+			std::mutex WakeMutex;	// Guards the writer state of the session.
+			std::condition_variable WakeCondition;	// Wakes the writer thread.
+
+			/**
+			 * Log Session object.
+			 * A session lasts from Open() to Close(). It owns the file, the writer thread and the thread buffers.
+			 */
+			class LogSession {
+			public:
+				LogSession(FILE* pFile, UI64 sessionID) : pFile(pFile), mSessionID(sessionID), mBaseTime(std::chrono::steady_clock::now())
+				{
+					std::vector<UI8> header;
+					header.insert(header.end(), FileMagic, FileMagic + sizeof(FileMagic));
+					Append(header, FileVersion);
+					Append(header, static_cast<UI64>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count()));
+
+					fwrite(header.data(), 1, header.size(), pFile);
+					mThread = std::thread(&LogSession::Run, this);
+				}
+
+				~LogSession()
+				{
+					{
+						std::lock_guard<std::mutex> _lock(WakeMutex);
+						bShouldRun = false;
+					}
+
+					WakeCondition.notify_all();
+					mThread.join();
+
+					fclose(pFile);
+				}
+
+				/**
+				 * Create and register a buffer for the calling thread.
+				 */
+				std::shared_ptr<ThreadBuffer> Register()
+				{
+					auto pBuffer = std::make_shared<ThreadBuffer>();
+					pBuffer->mSessionID = mSessionID;
+					pBuffer->mBaseTime = mBaseTime;
+
+					std::lock_guard<std::mutex> _lock(mRegistryMutex);
+					pBuffer->mIndex = mNextThreadIndex++;
+					mBuffers.push_back(pBuffer);
+
+					return pBuffer;
+				}
+
+				/**
+				 * Wait till all the records pushed before this call are written.
+				 */
+				bool Flush(UI64 timeoutMilliseconds)
+				{
+					std::unique_lock<std::mutex> _lock(WakeMutex);
+					const UI64 ticket = ++mFlushRequested;
+					WakeCondition.notify_all();
+
+					return mFlushCondition.wait_for(_lock, std::chrono::milliseconds(timeoutMilliseconds), [&] { return mFlushCompleted >= ticket; });
+				}
+
+			private:
+				/**
+				 * Writer thread function.
+				 */
+				void Run()
+				{
+					bool bRunning = true;
+					while (bRunning)
+					{
+						UI64 flushTicket = 0;
+						{
+							std::unique_lock<std::mutex> _lock(WakeMutex);
+							WakeCondition.wait_for(_lock, std::chrono::milliseconds(WriterInterval), [&] { return !bShouldRun || mFlushRequested > mFlushCompleted; });
+
+							flushTicket = mFlushRequested;
+							bRunning = bShouldRun;
+						}
+
+						Drain();
+
+						if (flushTicket)
+						{
+							std::lock_guard<std::mutex> _lock(WakeMutex);
+							mFlushCompleted = flushTicket;
+						}
+
+						mFlushCondition.notify_all();
+					}
+				}
+
+				/**
+				 * Write the records of all the threads and the formats they use to the file.
+				 */
+				void Drain()
+				{
+					{
+						std::lock_guard<std::mutex> _lock(mRegistryMutex);
+						for (auto itr = mBuffers.begin(); itr != mBuffers.end();)
+						{
+							const bool bRetired = (*itr)->bRetired.load(std::memory_order_acquire);
+							Collect(**itr);
+
+							if (bRetired)
+								itr = mBuffers.erase(itr);
+							else
+								itr++;
+						}
+					}
+
+					// Records are registered before they are pushed, so every format used by the collected records is
+					// in the registry by now.
+					{
+						std::lock_guard<std::mutex> _lock(FormatMutex);
+						for (; mWrittenFormatCount < Formats.size(); mWrittenFormatCount++)
+						{
+							const LogFormat* pFormat = Formats[mWrittenFormatCount];
+
+							mFormatBlocks.push_back(static_cast<UI8>(BlockType::FORMAT));
+							AppendVarInt(mFormatBlocks, mWrittenFormatCount + 1);
+							mFormatBlocks.push_back(static_cast<UI8>(pFormat->mSeverity));
+							AppendVarInt(mFormatBlocks, pFormat->mLine);
+							mFormatBlocks.push_back(pFormat->mArgumentCount);
+							mFormatBlocks.insert(mFormatBlocks.end(), reinterpret_cast<const UI8*>(pFormat->mArgumentTypes), reinterpret_cast<const UI8*>(pFormat->mArgumentTypes + pFormat->mArgumentCount));
+							AppendString(mFormatBlocks, pFormat->pFile);
+							AppendString(mFormatBlocks, pFormat->pFormat);
+						}
+					}
+
+					const UI64 droppedCount = DroppedCount.load(std::memory_order_relaxed);
+					if (droppedCount != mWrittenDroppedCount)
+					{
+						mDataBlocks.push_back(static_cast<UI8>(BlockType::DROPPED));
+						AppendVarInt(mDataBlocks, droppedCount - mWrittenDroppedCount);
+						mWrittenDroppedCount = droppedCount;
+					}
+
+					if (mFormatBlocks.empty() && mDataBlocks.empty())
+						return;
+
+					fwrite(mFormatBlocks.data(), 1, mFormatBlocks.size(), pFile);
+					fwrite(mDataBlocks.data(), 1, mDataBlocks.size(), pFile);
+					fflush(pFile);
+
+					mFormatBlocks.clear();
+					mDataBlocks.clear();
+				}
+
+				/**
+				 * Move the bytes of a thread buffer to a data block.
+				 *
+				 * @param buffer: The thread buffer.
+				 */
+				void Collect(ThreadBuffer& buffer)
+				{
+					UI64 count = 0;
+					const UI8* pBytes = buffer.mBytes.FrontRange(count);
+					if (!pBytes)
+						return;
+
+					mDataBlocks.push_back(static_cast<UI8>(BlockType::DATA));
+					AppendVarInt(mDataBlocks, buffer.mIndex);
+
+					// The size is patched after the bytes are copied, since the data might wrap around.
+					const UI64 sizeOffset = mDataBlocks.size();
+					mDataBlocks.insert(mDataBlocks.end(), 10, 0);
+					const UI64 dataOffset = mDataBlocks.size();
+
+					// At most two ranges, the second one being the part which wrapped around.
+					for (UI64 range = 0; range < 2 && pBytes; range++)
+					{
+						mDataBlocks.insert(mDataBlocks.end(), pBytes, pBytes + count);
+						buffer.mBytes.Pop(count);
+						pBytes = buffer.mBytes.FrontRange(count);
+					}
+
+					// The size is stored as a fixed 10 byte variable length integer so that it can be patched.
+					UI64 size = mDataBlocks.size() - dataOffset;
+					for (UI64 index = 0; index < 10; index++, size >>= 7)
+						mDataBlocks[sizeOffset + index] = static_cast<UI8>(size & 0x7f) | (index < 9 ? 0x80 : 0);
+				}
+
+				FILE* pFile = nullptr;	// The log file.
+				UI64 mSessionID = 0;	// Session ID.
+				std::chrono::steady_clock::time_point mBaseTime;	// Time the session started.
+
+				std::vector<std::shared_ptr<ThreadBuffer>> mBuffers;	// Registered thread buffers.
+				std::mutex mRegistryMutex;	// Guards the buffer registry.
+				UI64 mNextThreadIndex = 0;	// Index of the next registered thread.
+
+				std::vector<UI8> mFormatBlocks;	// Format blocks of the current batch.
+				std::vector<UI8> mDataBlocks;	// Data blocks of the current batch.
+				UI64 mWrittenFormatCount = 0;	// Number of formats written to the file.
+				UI64 mWrittenDroppedCount = DroppedCount.load();	// Dropped record count which was written last.
+
+				// Guarded by WakeMutex.
+				std::condition_variable mFlushCondition;	// Notifies the flushing threads.
+				UI64 mFlushRequested = 0;	// Last requested flush ticket.
+				UI64 mFlushCompleted = 0;	// Last completed flush ticket.
+				bool bShouldRun = true;	// Whether the writer should keep running.
+
+				std::thread mThread;	// Writer thread.
+			};
+
+			std::shared_ptr<LogSession> Session;	// The current session.
+			std::atomic<UI64> SessionID = { 0 };	// ID of the current session. 0 if closed.
+			std::mutex SessionMutex;	// Guards the session pointer.
+
+			/**
+			 * Get the current session.
+			 */
+			std::shared_ptr<LogSession> GetSession()
+			{
+				std::lock_guard<std::mutex> _lock(SessionMutex);
+				return Session;
+			}
+
+			/**
+			 * Thread Buffer Handle structure.
+			 * Marks the buffer as retired when the owning thread exits, so that the writer can release it.
+			 */
+			struct ThreadBufferHandle {
+				~ThreadBufferHandle()
+				{
+					if (pBuffer)
+						pBuffer->bRetired.store(true, std::memory_order_release);
+				}
+
+				std::shared_ptr<ThreadBuffer> pBuffer;
+			};
+
+			thread_local ThreadBufferHandle CurrentThreadBuffer;	// The calling thread's buffer.
+		}
+
+		bool Open(const char* pFilePath)
+		{
+			Close();
+
+			FILE* pFile = fopen(pFilePath, "wb");
+			if (!pFile)
+				return false;
+
+			std::lock_guard<std::mutex> _lock(_Helpers::SessionMutex);
+			static UI64 mNextSessionID = 1;
+			const UI64 sessionID = mNextSessionID++;
+
+			_Helpers::Session = std::make_shared<_Helpers::LogSession>(pFile, sessionID);
+			_Helpers::SessionID.store(sessionID, std::memory_order_release);
+
+			return true;
+		}
+
+		void Close()
+		{
+			std::shared_ptr<_Helpers::LogSession> pSession;
+			{
+				std::lock_guard<std::mutex> _lock(_Helpers::SessionMutex);
+				pSession.swap(_Helpers::Session);
+				_Helpers::SessionID.store(0, std::memory_order_release);
+			}
+
+			// Destroying the session writes the remaining records and joins the writer thread.
+		}
+
+		bool IsOpen()
+		{
+			return _Helpers::SessionID.load(std::memory_order_relaxed) != 0;
+		}
+
+		bool Flush(UI64 timeoutMilliseconds)
+		{
+			auto pSession = _Helpers::GetSession();
+			return pSession ? pSession->Flush(timeoutMilliseconds) : true;
+		}
+
+		UI64 GetDroppedRecordCount()
+		{
+			return _Helpers::DroppedCount.load(std::memory_order_relaxed);
+		}
+
+		UI32 RegisterFormat(LogFormat& format, const ArgumentType* pArgumentTypes, UI64 argumentCount)
+		{
+			std::lock_guard<std::mutex> _lock(_Helpers::FormatMutex);
+
+			// Another thread might have registered the format while this one was waiting.
+			UI32 formatID = format.mID.load(std::memory_order_relaxed);
+			if (formatID)
+				return formatID;
+
+			for (UI64 index = 0; index < argumentCount; index++)
+				format.mArgumentTypes[index] = pArgumentTypes[index];
+
+			format.mArgumentCount = static_cast<UI8>(argumentCount);
+
+			_Helpers::Formats.push_back(&format);
+			formatID = static_cast<UI32>(_Helpers::Formats.size());
+			format.mID.store(formatID, std::memory_order_release);
+
+			return formatID;
+		}
+
+		void Submit(UI32 formatID, const UI8* pArguments, UI64 size)
+		{
+			auto& handle = _Helpers::CurrentThreadBuffer;
+			const UI64 sessionID = _Helpers::SessionID.load(std::memory_order_acquire);
+
+			// Register a new buffer on the first record of every session.
+			if (!handle.pBuffer || handle.pBuffer->mSessionID != sessionID)
+			{
+				auto pSession = _Helpers::GetSession();
+				if (!pSession)
+					return;
+
+				if (handle.pBuffer)
+					handle.pBuffer->bRetired.store(true, std::memory_order_release);
+
+				handle.pBuffer = pSession->Register();
+			}
+
+			_Helpers::ThreadBuffer& buffer = *handle.pBuffer;
+			const UI64 timeStamp = static_cast<UI64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - buffer.mBaseTime).count());
+			UI8 header[20] = {};
+			UI8* pHeaderEnd = WriteVarInt(WriteVarInt(header, formatID), timeStamp - buffer.mLastTimeStamp);
+
+			const UI64 headerSize = pHeaderEnd - header;
+			if (!buffer.mBytes.CanPush(headerSize + size))
+			{
+				_Helpers::DroppedCount.fetch_add(1, std::memory_order_relaxed);
+				_Helpers::WakeCondition.notify_one();
+				return;
+			}
+
+			buffer.mBytes.TryPush(header, headerSize);
+			buffer.mBytes.TryPush(pArguments, size);
+			buffer.mLastTimeStamp = timeStamp;
+
+			// Do not let the buffer fill up while the writer is sleeping.
+			if (buffer.mBytes.Size() > _Helpers::ThreadBufferSize / 2)
+				_Helpers::WakeCondition.notify_one();
+		}
+
+		UI8* WriteWideString(UI8* pBuffer, const wchar* pString, UI64 length)
+		{
+			UI8 encoded[MaxStringLength + 4] = {};
+			UI64 size = 0;
+
+			for (UI64 index = 0; index < length && size < MaxStringLength; index++)
+			{
+				UI32 codePoint = static_cast<UI32>(pString[index]);
+
+				// Combine UTF-16 surrogate pairs (wchar is 16 bits on Windows).
+				if (codePoint >= 0xd800 && codePoint < 0xdc00 && index + 1 < length)
+				{
+					const UI32 lowSurrogate = static_cast<UI32>(pString[index + 1]);
+					if (lowSurrogate >= 0xdc00 && lowSurrogate < 0xe000)
+					{
+						codePoint = 0x10000 + ((codePoint - 0xd800) << 10) + (lowSurrogate - 0xdc00);
+						index++;
+					}
+				}
+
+				UI64 codeSize = codePoint < 0x80 ? 1 : codePoint < 0x800 ? 2 : codePoint < 0x10000 ? 3 : 4;
+				if (size + codeSize > MaxStringLength)
+					break;
+
+				if (codeSize == 1)
+					encoded[size++] = static_cast<UI8>(codePoint);
+				else if (codeSize == 2)
+				{
+					encoded[size++] = static_cast<UI8>(0xc0 | (codePoint >> 6));
+					encoded[size++] = static_cast<UI8>(0x80 | (codePoint & 0x3f));
+				}
+				else if (codeSize == 3)
+				{
+					encoded[size++] = static_cast<UI8>(0xe0 | (codePoint >> 12));
+					encoded[size++] = static_cast<UI8>(0x80 | ((codePoint >> 6) & 0x3f));
+					encoded[size++] = static_cast<UI8>(0x80 | (codePoint & 0x3f));
+				}
+				else
+				{
+					encoded[size++] = static_cast<UI8>(0xf0 | (codePoint >> 18));
+					encoded[size++] = static_cast<UI8>(0x80 | ((codePoint >> 12) & 0x3f));
+					encoded[size++] = static_cast<UI8>(0x80 | ((codePoint >> 6) & 0x3f));
+					encoded[size++] = static_cast<UI8>(0x80 | (codePoint & 0x3f));
+				}
+			}
+
+			return WriteString(pBuffer, reinterpret_cast<const char*>(encoded), size);
+		}
+	}
+}
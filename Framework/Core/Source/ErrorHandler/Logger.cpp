@@ -2,10 +2,19 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Core/ErrorHandler/Logger.h"
+#include "Core/Types/RingBuffer.h"
 
-#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cwchar>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
 #include <vector>
-#include <time.h>
 
 namespace DMK
 {
@@ -15,30 +24,18 @@ namespace DMK
 		const wchar green[8] = { 0x1b, '[', '1', ';', '9', '2', 'm', 0 };		// info
 		const wchar yellow[8] = { 0x1b, '[', '1', ';', '9', '3', 'm', 0 };	// warning
 		const wchar errRed[8] = { 0x1b, '[', '1', ';', '3', '1', 'm', 0 };	// error
-		const wchar fatalRed[8] = { 0x1b, '[', '4', ';', '3', '1', 'm', 0 };	// fatal
+		const wchar fatalRed[15] = { 0x1b, '[', '1', ';', '3', '1', 'm', 0x1b, '[', '4', ';', '3', '1', 'm', 0 };	// fatal (error, then underlined)
 		const wchar normal[8] = { 0x1b, '[', '0', ';', '3', '9', 'm', 0 };	// default
 
-		void changeToColor(int severity) {
-			switch (severity) {
-			case 0:
-				std::wcout << green;
-				break;
-			case 1:
-				std::wcout << yellow;
-				break;
-			case 2:
-				std::wcout << errRed;
-				break;
-			case 3:
-				std::wcout << errRed << fatalRed; break;
-			case 4:
-				std::wcout << blue; break;
-			default:
-				break;
-			}
-		}
+		const wchar* SEVERITY_COLORS[5] = {
+			green,
+			yellow,
+			errRed,
+			fatalRed,
+			blue,
+		};
 
-		std::vector<const wchar*> LOG_INFO = {
+		const wchar* LOG_INFO[5] = {
 			TEXT("INFO-> "),
 			TEXT("WARN-> "),
 			TEXT("ERROR-> "),
@@ -46,6 +43,367 @@ namespace DMK
 			TEXT("DEBUG-> "),
 		};
 
+		namespace _Helpers
+		{
+			constexpr UI64 SlotTextLength = 112;	// Number of characters a single slot can hold.
+			constexpr UI64 SlotCount = 1024;	// Number of slots per thread.
+			constexpr UI64 WriterInterval = 10;	// Maximum time (in milliseconds) a message waits before being written.
+
+			/**
+			 * Log Slot structure.
+			 * Messages longer than a slot are split to multiple consecutive slots.
+			 */
+			struct LogSlot {
+				UI64 mTimeStamp = 0;	// Time since epoch in microseconds.
+				UI16 mLength = 0;	// Number of characters in this slot.
+				UI8 mSeverity = 0;	// Message severity.
+				bool bContinued = false;	// Whether the next slot continues this message.
+				wchar mText[SlotTextLength] = {};	// The message text.
+			};
+
+			/**
+			 * Log Record structure.
+			 * A complete message, assembled by the writer thread.
+			 */
+			struct LogRecord {
+				UI64 mTimeStamp = 0;
+				UI8 mSeverity = 0;
+				WString mText;
+			};
+
+			/**
+			 * Thread Buffer structure.
+			 * Each logging thread owns one of these. The thread is the only producer and the writer thread is the
+			 * only consumer.
+			 */
+			struct ThreadBuffer {
+				RingBuffer<LogSlot, SlotCount> mSlots;	// Pending slots.
+				LogRecord mPartialRecord;	// Writer side: the message which is being assembled.
+				std::atomic<bool> bRetired = { false };	// Whether the owning thread has exited.
+			};
+
+			/**
+			 * Get the current time since epoch in microseconds.
+			 */
+			UI64 GetTimeStamp()
+			{
+				return static_cast<UI64>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+			}
+
+			/**
+			 * Format a time stamp as hh:mm:ss.
+			 *
+			 * @param timeStamp: The time stamp in microseconds.
+			 * @param pBuffer: The buffer to write to.
+			 * @param size: The size of the buffer.
+			 */
+			void FormatTime(UI64 timeStamp, wchar* pBuffer, UI64 size)
+			{
+				const time_t seconds = static_cast<time_t>(timeStamp / 1000000);
+				tm localTime = {};
+
+#ifdef _MSC_VER
+				localtime_s(&localTime, &seconds);
+
+#else
+				localtime_r(&seconds, &localTime);
+
+#endif
+
+				wcsftime(pBuffer, size, TEXT("%H:%M:%S"), &localTime);
+			}
+
+			/**
+			 * Log Writer object.
+			 * This owns the writer thread and the registry of thread buffers.
+			 */
+			class LogWriter {
+			public:
+				LogWriter() : mThread(&LogWriter::Run, this) {}
+
+				~LogWriter()
+				{
+					{
+						std::lock_guard<std::mutex> _lock(mWakeMutex);
+						bShouldRun = false;
+					}
+
+					mWakeCondition.notify_all();
+					mThread.join();
+				}
+
+				/**
+				 * Create and register a buffer for the calling thread.
+				 */
+				std::shared_ptr<ThreadBuffer> Register()
+				{
+					auto pBuffer = std::make_shared<ThreadBuffer>();
+
+					std::lock_guard<std::mutex> _lock(mRegistryMutex);
+					mBuffers.push_back(pBuffer);
+
+					return pBuffer;
+				}
+
+				/**
+				 * Wake the writer thread up before its interval elapses.
+				 */
+				void Wake()
+				{
+					mWakeCondition.notify_one();
+				}
+
+				/**
+				 * Wait till all the messages pushed before this call are written.
+				 *
+				 * @param timeoutMilliseconds: The maximum time to wait.
+				 * @return True if the messages were written in time.
+				 */
+				bool Flush(UI64 timeoutMilliseconds)
+				{
+					std::unique_lock<std::mutex> _lock(mWakeMutex);
+					const UI64 ticket = ++mFlushRequested;
+					mWakeCondition.notify_one();
+
+					return mFlushCondition.wait_for(_lock, std::chrono::milliseconds(timeoutMilliseconds), [&] { return mFlushCompleted >= ticket; });
+				}
+
+				std::atomic<OverflowPolicy> mPolicy = { OverflowPolicy::BLOCK };	// Overflow policy.
+				std::atomic<UI64> mDroppedCount = { 0 };	// Number of dropped messages.
+
+			private:
+				/**
+				 * Writer thread function.
+				 */
+				void Run()
+				{
+					bool bRunning = true;
+					while (bRunning)
+					{
+						UI64 flushTicket = 0;
+						{
+							std::unique_lock<std::mutex> _lock(mWakeMutex);
+							mWakeCondition.wait_for(_lock, std::chrono::milliseconds(WriterInterval), [&] { return !bShouldRun || mFlushRequested > mFlushCompleted; });
+
+							flushTicket = mFlushRequested;
+							bRunning = bShouldRun;
+						}
+
+						Drain();
+
+						if (flushTicket)
+						{
+							std::lock_guard<std::mutex> _lock(mWakeMutex);
+							mFlushCompleted = flushTicket;
+						}
+
+						mFlushCondition.notify_all();
+					}
+				}
+
+				/**
+				 * Collect the messages of all the threads and write them as one batch.
+				 */
+				void Drain()
+				{
+					{
+						std::lock_guard<std::mutex> _lock(mRegistryMutex);
+						for (auto itr = mBuffers.begin(); itr != mBuffers.end();)
+						{
+							// Read the retired flag first. If it is set, no more messages can be pushed after the drain.
+							const bool bRetired = (*itr)->bRetired.load(std::memory_order_acquire);
+							Collect(**itr);
+
+							if (bRetired)
+								itr = mBuffers.erase(itr);
+							else
+								itr++;
+						}
+					}
+
+					const UI64 droppedCount = mDroppedCount.load(std::memory_order_relaxed);
+					if (droppedCount != mReportedDroppedCount)
+					{
+						LogRecord record;
+						record.mTimeStamp = GetTimeStamp();
+						record.mSeverity = 1;
+						record.mText = std::to_wstring(droppedCount - mReportedDroppedCount) + TEXT(" log message(s) were dropped because the log buffer was full.");
+						mRecords.push_back(std::move(record));
+
+						mReportedDroppedCount = droppedCount;
+					}
+
+					if (mRecords.empty())
+						return;
+
+					// Records of a single thread are already in order. Merge the threads by time.
+					std::stable_sort(mRecords.begin(), mRecords.end(), [](const LogRecord& lhs, const LogRecord& rhs) { return lhs.mTimeStamp < rhs.mTimeStamp; });
+
+					wchar timeBuffer[16] = {};
+					UI64 formattedSecond = ~0ULL;
+					for (const auto& record : mRecords)
+					{
+						// Formatting the time is relatively expensive, so only do it when the second changes.
+						if (record.mTimeStamp / 1000000 != formattedSecond)
+						{
+							formattedSecond = record.mTimeStamp / 1000000;
+							FormatTime(record.mTimeStamp, timeBuffer, 16);
+						}
+
+						mBatch.append(SEVERITY_COLORS[record.mSeverity]);
+						mBatch.append(TEXT("["));
+						mBatch.append(timeBuffer);
+						mBatch.append(TEXT("] "));
+						mBatch.append(LOG_INFO[record.mSeverity]);
+						mBatch.append(record.mText);
+						mBatch.append(normal);
+						mBatch.append(TEXT("\n"));
+					}
+
+					fputws(mBatch.c_str(), stdout);
+					fflush(stdout);
+
+					mBatch.clear();
+					mRecords.clear();
+				}
+
+				/**
+				 * Move the complete messages of a thread buffer to the record list.
+				 *
+				 * @param buffer: The thread buffer.
+				 */
+				void Collect(ThreadBuffer& buffer)
+				{
+					while (LogSlot* pSlot = buffer.mSlots.Front())
+					{
+						LogRecord& record = buffer.mPartialRecord;
+						if (record.mText.empty())
+						{
+							record.mTimeStamp = pSlot->mTimeStamp;
+							record.mSeverity = pSlot->mSeverity;
+						}
+
+						record.mText.append(pSlot->mText, pSlot->mLength);
+						const bool bContinued = pSlot->bContinued;
+						buffer.mSlots.Pop();
+
+						if (!bContinued)
+						{
+							mRecords.push_back(std::move(record));
+							record = LogRecord();
+						}
+					}
+				}
+
+				std::vector<std::shared_ptr<ThreadBuffer>> mBuffers;	// Registered thread buffers.
+				std::mutex mRegistryMutex;	// Guards the buffer registry.
+
+				std::vector<LogRecord> mRecords;	// Records of the current batch.
+				WString mBatch;	// Formatted batch.
+				UI64 mReportedDroppedCount = 0;	// Dropped message count which was reported last.
+
+				std::mutex mWakeMutex;	// Guards the state below.
+				std::condition_variable mWakeCondition;	// Wakes the writer thread.
+				std::condition_variable mFlushCondition;	// Notifies the flushing threads.
+				UI64 mFlushRequested = 0;	// Last requested flush ticket.
+				UI64 mFlushCompleted = 0;	// Last completed flush ticket.
+				bool bShouldRun = true;	// Whether the writer should keep running.
+
+				std::thread mThread;	// Writer thread. Declared last so that it starts after the rest is constructed.
+			};
+
+			/**
+			 * Get the log writer instance. It is created on first use.
+			 */
+			LogWriter& GetWriter()
+			{
+				static LogWriter mWriter;
+				return mWriter;
+			}
+
+			/**
+			 * Thread Buffer Handle structure.
+			 * Marks the buffer as retired when the owning thread exits, so that the writer can release it.
+			 */
+			struct ThreadBufferHandle {
+				~ThreadBufferHandle()
+				{
+					if (pBuffer)
+						pBuffer->bRetired.store(true, std::memory_order_release);
+				}
+
+				std::shared_ptr<ThreadBuffer> pBuffer;
+			};
+
+			/**
+			 * Get the buffer of the calling thread.
+			 */
+			ThreadBuffer& GetThreadBuffer(LogWriter& writer)
+			{
+				thread_local ThreadBufferHandle mHandle;
+				if (!mHandle.pBuffer)
+					mHandle.pBuffer = writer.Register();
+
+				return *mHandle.pBuffer;
+			}
+
+			/**
+			 * Push a message to the calling thread's buffer.
+			 *
+			 * @param severity: Message priority.
+			 * @param message: The actual message to be logged.
+			 */
+			void Enqueue(UI8 severity, const wchar* message)
+			{
+				LogWriter& writer = GetWriter();
+				ThreadBuffer& buffer = GetThreadBuffer(writer);
+
+				UI64 length = wcslen(message);
+				UI64 slotCount = length ? (length + SlotTextLength - 1) / SlotTextLength : 1;
+
+				// Truncate messages which would not fit in the whole buffer.
+				if (slotCount > SlotCount)
+				{
+					slotCount = SlotCount;
+					length = SlotCount * SlotTextLength;
+				}
+
+				if (writer.mPolicy.load(std::memory_order_relaxed) == OverflowPolicy::DROP && !buffer.mSlots.CanPush(slotCount))
+				{
+					writer.mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+					writer.Wake();
+					return;
+				}
+
+				const UI64 timeStamp = GetTimeStamp();
+				for (UI64 index = 0; index < slotCount; index++)
+				{
+					LogSlot* pSlot = buffer.mSlots.TryReserve();
+					while (!pSlot)
+					{
+						writer.Wake();
+						std::this_thread::yield();
+						pSlot = buffer.mSlots.TryReserve();
+					}
+
+					const UI64 offset = index * SlotTextLength;
+					const UI64 slotLength = (length - offset) < SlotTextLength ? (length - offset) : SlotTextLength;
+
+					pSlot->mTimeStamp = timeStamp;
+					pSlot->mSeverity = severity;
+					pSlot->mLength = static_cast<UI16>(slotLength);
+					pSlot->bContinued = index + 1 < slotCount;
+					wmemcpy(pSlot->mText, message + offset, slotLength);
+
+					buffer.mSlots.Commit();
+				}
+
+				// Do not let the buffer fill up while the writer is sleeping.
+				if (buffer.mSlots.Size() > SlotCount / 2)
+					writer.Wake();
+			}
+		}
+
 		/**
 		 * Log information to the console by submitting a color.
 		 *
@@ -53,43 +411,53 @@ namespace DMK
 		* @param msg: The actual message to be logged.
 		 */
 		void LOG(int severity, const wchar* msg) {
-			wchar tmpBuff[128];
-			_tzset();
+			_Helpers::Enqueue(static_cast<UI8>(severity), msg);
+		}
 
-			changeToColor(severity);
+		void SetOverflowPolicy(OverflowPolicy policy)
+		{
+			_Helpers::GetWriter().mPolicy.store(policy, std::memory_order_relaxed);
+		}
 
-			_wstrtime_s(tmpBuff, 128);
-			wprintf(TEXT("[%s] %s%s%s\n"), tmpBuff, LOG_INFO[severity], msg, normal);
+		bool Flush(UI64 timeoutMilliseconds)
+		{
+			return _Helpers::GetWriter().Flush(timeoutMilliseconds);
+		}
+
+		UI64 GetDroppedMessageCount()
+		{
+			return _Helpers::GetWriter().mDroppedCount.load(std::memory_order_relaxed);
 		}
 
 		void LogInfo(const wchar* message)
 		{
-			changeToColor(0);
 			LOG(0, message);
 		}
 
 		void LogWarn(const wchar* message)
 		{
-			changeToColor(1);
 			LOG(1, message);
 		}
 
 		void LogError(const wchar* message)
 		{
-			changeToColor(2);
 			LOG(2, message);
 		}
 
 		void LogFatal(const wchar* message, const wchar* file, UI32 line)
 		{
-			changeToColor(3);
-			wprintf(TEXT("[%s:%u] %s%s%s\n"), file, line, LOG_INFO[3], message, normal);
+			// Write everything which was logged before the fatal error, but do not wait forever since the writer
+			// might be the reason of the failure. The fatal message itself is written synchronously so that it
+			// reaches the console before the debug break.
+			Flush();
+
+			fwprintf(stdout, TEXT("%ls[%ls:%u] %ls%ls%ls\n"), fatalRed, file, line, LOG_INFO[3], message, normal);
+			fflush(stdout);
 		}
 
 		void LogDebug(const wchar* message)
 		{
-			changeToColor(4);
 			LOG(4, message);
 		}
 	}
-}
\ No newline at end of file
+}
@@ -2,16 +2,284 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Core/Hash/Hasher.h"
+#include "Core/ErrorHandler/Logger.h"
 
 #include <xxhash.h>
+#include <atomic>
+#include <fstream>
+#include <thread>
 
 namespace DMK
 {
 	namespace Hasher
 	{
+		namespace _Helpers
+		{
+			/**
+			 * Convert a xxhash 128 bit hash to the engine type.
+			 */
+			Hash128 ToHash128(const XXH128_hash_t& hash)
+			{
+				Hash128 result;
+				result.mLow = hash.low64;
+				result.mHigh = hash.high64;
+
+				return result;
+			}
+
+			/**
+			 * Resolve the number of threads to use for a chunked hash.
+			 *
+			 * @param threadCount: The requested thread count. 0 means hardware concurrency.
+			 * @param chunkCount: The number of chunks to hash.
+			 * @return The thread count.
+			 */
+			UI64 ResolveThreadCount(UI32 threadCount, UI64 chunkCount)
+			{
+				UI64 count = threadCount ? threadCount : std::thread::hardware_concurrency();
+				if (count == 0)
+					count = 1;
+
+				if (count > chunkCount)
+					count = chunkCount ? chunkCount : 1;
+
+				return count;
+			}
+
+			/**
+			 * Run a chunk hashing function on multiple threads.
+			 * Chunks are distributed dynamically so that slow chunks (for example page faults or disk reads) do
+			 * not stall a whole thread's share of the work.
+			 *
+			 * @param chunkCount: The number of chunks.
+			 * @param threadCount: The requested thread count.
+			 * @param function: The function to be called with the thread-local context and the chunk index.
+			 */
+			template<class Context, class Function>
+			void ForEachChunk(UI64 chunkCount, UI32 threadCount, Function function)
+			{
+				std::atomic<UI64> nextChunk(0);
+				auto worker = [&]()
+				{
+					Context context;
+					for (UI64 index = nextChunk++; index < chunkCount; index = nextChunk++)
+						function(context, index);
+				};
+
+				const UI64 count = ResolveThreadCount(threadCount, chunkCount);
+				std::vector<std::thread> threads;
+				threads.reserve(count - 1);
+
+				for (UI64 index = 1; index < count; index++)
+					threads.emplace_back(worker);
+
+				// The calling thread does its share of the work as well.
+				worker();
+
+				for (auto& thread : threads)
+					thread.join();
+			}
+
+			/**
+			 * Combine the chunk hashes to the final hash.
+			 *
+			 * @param chunkHashes: The hashes of all the chunks.
+			 * @param size: The total size of the data.
+			 * @param seed: The seed to generate the hash from.
+			 * @return The final hash.
+			 */
+			Hash128 CombineChunkHashes(const std::vector<Hash128>& chunkHashes, UI64 size, UI64 seed)
+			{
+				StreamHasher hasher(seed);
+				hasher.Update(chunkHashes.data(), chunkHashes.size() * sizeof(Hash128));
+				hasher.Update(&size, sizeof(UI64));
+
+				return hasher.Digest128();
+			}
+
+			/**
+			 * Empty context for hashing in-memory chunks.
+			 */
+			struct MemoryChunkContext {};
+
+			/**
+			 * File chunk hashing context.
+			 * Each thread has its own file handle and read buffer.
+			 */
+			struct FileChunkContext {
+				std::ifstream mFile;
+				std::vector<char> mBuffer;
+			};
+		}
+
 		UI64 GetHash(const void* pData, UI64 size, UI64 seed)
 		{
-			return XXH3_64bits(pData, size);
+			return XXH3_64bits_withSeed(pData, size, seed);
+		}
+
+		Hash128 GetHash128(const void* pData, UI64 size, UI64 seed)
+		{
+			return _Helpers::ToHash128(XXH3_128bits_withSeed(pData, size, seed));
+		}
+
+		Hash128 GetHashParallel(const void* pData, UI64 size, UI64 seed, UI32 threadCount, UI64 chunkSize)
+		{
+			if (chunkSize == 0)
+				chunkSize = size ? size : 1;
+
+			const UI64 chunkCount = (size + chunkSize - 1) / chunkSize;
+			std::vector<Hash128> chunkHashes(chunkCount);
+
+			const BYTE* pBytes = static_cast<const BYTE*>(pData);
+			_Helpers::ForEachChunk<_Helpers::MemoryChunkContext>(chunkCount, threadCount,
+				[&](_Helpers::MemoryChunkContext&, UI64 index)
+				{
+					const UI64 offset = index * chunkSize;
+					const UI64 length = (size - offset) < chunkSize ? (size - offset) : chunkSize;
+					chunkHashes[index] = GetHash128(pBytes + offset, length, seed);
+				});
+
+			return _Helpers::CombineChunkHashes(chunkHashes, size, seed);
+		}
+
+		Hash128 GetFileHash(const char* pPath, UI64 seed, UI32 threadCount, UI64 chunkSize)
+		{
+			std::ifstream file(pPath, std::ios::binary | std::ios::ate);
+			if (!file.is_open())
+			{
+				DMK_LOG_ERROR(TEXT("Failed to open the file to hash!"));
+				return Hash128();
+			}
+
+			const UI64 size = static_cast<UI64>(file.tellg());
+			file.close();
+
+			if (chunkSize == 0)
+				chunkSize = size ? size : 1;
+
+			const UI64 chunkCount = (size + chunkSize - 1) / chunkSize;
+			std::vector<Hash128> chunkHashes(chunkCount);
+			std::atomic<bool> bHasFailed(false);
+
+			_Helpers::ForEachChunk<_Helpers::FileChunkContext>(chunkCount, threadCount,
+				[&](_Helpers::FileChunkContext& context, UI64 index)
+				{
+					if (bHasFailed.load(std::memory_order_relaxed))
+						return;
+
+					if (!context.mFile.is_open())
+					{
+						context.mFile.open(pPath, std::ios::binary);
+						if (!context.mFile.is_open())
+						{
+							bHasFailed.store(true, std::memory_order_relaxed);
+							return;
+						}
+
+						context.mBuffer.resize(chunkSize);
+					}
+
+					const UI64 offset = index * chunkSize;
+					const UI64 length = (size - offset) < chunkSize ? (size - offset) : chunkSize;
+
+					// A failed read leaves the stream in a failed state, so clear it before reusing the stream.
+					context.mFile.clear();
+					context.mFile.seekg(offset);
+					context.mFile.read(context.mBuffer.data(), length);
+					if (static_cast<UI64>(context.mFile.gcount()) != length)
+					{
+						bHasFailed.store(true, std::memory_order_relaxed);
+						return;
+					}
+
+					chunkHashes[index] = GetHash128(context.mBuffer.data(), length, seed);
+				});
+
+			// The file could not be opened or was shortened while it was being read.
+			if (bHasFailed.load())
+			{
+				DMK_LOG_ERROR(TEXT("Failed to read the file to hash!"));
+				return Hash128();
+			}
+
+			return _Helpers::CombineChunkHashes(chunkHashes, size, seed);
+		}
+
+		StreamHasher::StreamHasher(UI64 seed)
+			: pState(XXH3_createState())
+		{
+			Reset(seed);
+		}
+
+		StreamHasher::StreamHasher(const StreamHasher& other)
+			: pState(XXH3_createState())
+		{
+			XXH3_copyState(pState, other.pState);
+		}
+
+		StreamHasher::StreamHasher(StreamHasher&& other) noexcept
+			: pState(other.pState)
+		{
+			other.pState = nullptr;
+		}
+
+		StreamHasher::~StreamHasher()
+		{
+			if (pState)
+				XXH3_freeState(pState);
+		}
+
+		StreamHasher& StreamHasher::operator=(const StreamHasher& other)
+		{
+			if (this != &other)
+			{
+				if (!pState)
+					pState = XXH3_createState();
+
+				XXH3_copyState(pState, other.pState);
+			}
+
+			return *this;
+		}
+
+		StreamHasher& StreamHasher::operator=(StreamHasher&& other) noexcept
+		{
+			if (this != &other)
+			{
+				if (pState)
+					XXH3_freeState(pState);
+
+				pState = other.pState;
+				other.pState = nullptr;
+			}
+
+			return *this;
+		}
+
+		void StreamHasher::Reset(UI64 seed)
+		{
+			// A freshly created state has an uninitialized seed, which the seeded reset uses to skip regenerating
+			// the secret. Resetting without a seed first makes sure it is always generated.
+			XXH3_64bits_reset(pState);
+
+			if (seed)
+				XXH3_64bits_reset_withSeed(pState, seed);
+		}
+
+		void StreamHasher::Update(const void* pData, UI64 size)
+		{
+			// The 64 and 128 bit variants share the same state and update routine, only the digest differs.
+			XXH3_64bits_update(pState, pData, size);
+		}
+
+		UI64 StreamHasher::Digest() const
+		{
+			return XXH3_64bits_digest(pState);
+		}
+
+		Hash128 StreamHasher::Digest128() const
+		{
+			return _Helpers::ToHash128(XXH3_128bits_digest(pState));
 		}
 	}
-}
\ No newline at end of file
+}
@@ -8,36 +8,6 @@
 
 namespace DMK
 {
-	Matrix22::Matrix22()
-		: x(0.0f), y(0.0f)
-	{
-	}
-
-	Matrix22::Matrix22(float value)
-		:
-		x(value, 0.0f),
-		y(0.0f, value)
-	{
-	}
-
-	Matrix22::Matrix22(Vector2 vec1, Vector2 vec2)
-		: x(vec1), y(vec2)
-	{
-	}
-
-	Matrix22::Matrix22(
-		float a, float b,
-		float c, float d)
-		:
-		x(a, b), y(c, d)
-	{
-	}
-
-	Matrix22::Matrix22(const Matrix22& other)
-		: r(other.r), g(other.g)
-	{
-	}
-
 	Matrix22::Matrix22(std::initializer_list<float> list)
 		: x(0.0f), y(0.0f)
 	{
@@ -47,42 +17,7 @@ namespace DMK
 		MemoryFunctions::MoveData(this, Cast<const void*>(list.begin()), list.size() * sizeof(float));
 	}
 
-	Matrix22 Matrix22::operator=(const Matrix22& other)
-	{
-		this->r = other.r;
-		this->g = other.g;
-
-		return *this;
-	}
-
-	const Vector2 Matrix22::operator[](UI32 index) const
-	{
-		return (&this->r)[index];
-	}
-
-	Vector2& Matrix22::operator[](UI32 index)
-	{
-		return (&this->r)[index];
-	}
-
-	Matrix22& Matrix22::operator*(const float& value)
-	{
-		this->r *= value;
-		this->g *= value;
-
-		return *this;
-	}
-
-	Vector2 Matrix22::operator*(const Vector2& other)
-	{
-		return { (this->r[0] * other[0]) + (this->r[1] * other[1]), (this->g[0] * other[0]) + (this->g[1] * other[1]) };
-	}
-
-	Matrix22& Matrix22::operator*(const Matrix22& other)
-	{
-		this->r = ((*this)[0] * other[0][0]) + ((*this)[1] * other[0][1]);
-		this->g = ((*this)[0] * other[1][0]) + ((*this)[1] * other[1][1]);
-
-		return *this;
-	}
+	/* Compile time checks for the constexpr constructors and operators. */
+	static_assert(Matrix22(2.0f)[1][1] == 2.0f, "Constant evaluation failed!");
+	static_assert((Matrix22(1.0f) * Vector2(3.0f, 4.0f)) == Vector2(3.0f, 4.0f), "Constant evaluation failed!");
 }
\ No newline at end of file
@@ -0,0 +1,359 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Core/Maths/Quantization.h"
+#include "Core/Maths/IncludeSIMD.h"
+#include "Core/Macros/Global.h"
+
+#include <cmath>
+#include <cstring>
+
+/**
+ * F16C ships with every AVX2 capable processor. MSVC exposes the intrinsics with /arch:AVX2, GCC and Clang
+ * need -mf16c.
+ */
+#if (SSE_INSTR_SET > 7) && (defined(_MSC_VER) || defined(__F16C__))
+#define DMK_QUANTIZATION_F16C
+
+#endif
+
+#if (SSE_INSTR_SET > 7)
+#define DMK_QUANTIZATION_AVX2
+
+#endif
+
+namespace DMK
+{
+	namespace Quantization
+	{
+		namespace _Helpers
+		{
+			/**
+			 * Get the bits of a float.
+			 *
+			 * @param value: The float value.
+			 * @return The bits.
+			 */
+			DMK_FORCEINLINE UI32 FloatBits(float value)
+			{
+				UI32 bits = 0;
+				std::memcpy(&bits, &value, sizeof(float));
+				return bits;
+			}
+
+			/**
+			 * Create a float using its bits.
+			 *
+			 * @param bits: The bits.
+			 * @return The float value.
+			 */
+			DMK_FORCEINLINE float BitsFloat(UI32 bits)
+			{
+				float value = 0.0f;
+				std::memcpy(&value, &bits, sizeof(float));
+				return value;
+			}
+
+			/**
+			 * Clamp a value to a range. NaN is mapped to the lower bound.
+			 */
+			DMK_FORCEINLINE float Clamp(float value, float low, float high)
+			{
+				return value > low ? (value < high ? value : high) : low;
+			}
+
+			/**
+			 * Get the sign of a value, treating 0 as positive.
+			 */
+			DMK_FORCEINLINE float SignNotZero(float value)
+			{
+				return value >= 0.0f ? 1.0f : -1.0f;
+			}
+
+			/**
+			 * Map a direction to the octahedron and unfold the lower hemisphere.
+			 *
+			 * @param normal: The direction.
+			 * @param outX: The mapped x coordinate in [-1, 1].
+			 * @param outY: The mapped y coordinate in [-1, 1].
+			 */
+			DMK_FORCEINLINE void OctahedralMap(const Vector3& normal, float& outX, float& outY)
+			{
+				const float length = std::fabs(normal.x) + std::fabs(normal.y) + std::fabs(normal.z);
+				if (length == 0.0f)
+				{
+					outX = 0.0f;
+					outY = 0.0f;
+					return;
+				}
+
+				float x = normal.x / length;
+				float y = normal.y / length;
+
+				if (normal.z < 0.0f)
+				{
+					const float oldX = x;
+					x = (1.0f - std::fabs(y)) * SignNotZero(oldX);
+					y = (1.0f - std::fabs(oldX)) * SignNotZero(y);
+				}
+
+				outX = x;
+				outY = y;
+			}
+
+			/**
+			 * Unmap an octahedral coordinate back to a normalized direction.
+			 *
+			 * @param x: The x coordinate in [-1, 1].
+			 * @param y: The y coordinate in [-1, 1].
+			 * @return The normalized direction.
+			 */
+			DMK_FORCEINLINE Vector3 OctahedralUnmap(float x, float y)
+			{
+				float z = 1.0f - std::fabs(x) - std::fabs(y);
+				const float t = z < 0.0f ? -z : 0.0f;
+				x += x >= 0.0f ? -t : t;
+				y += y >= 0.0f ? -t : t;
+
+				const float length = std::sqrt(x * x + y * y + z * z);
+				return Vector3(x / length, y / length, z / length);
+			}
+		}
+
+		UI16 FloatToHalf(float value)
+		{
+			UI32 bits = _Helpers::FloatBits(value);
+			const UI32 sign = bits & 0x80000000u;
+			bits ^= sign;
+
+			UI16 result = 0;
+
+			// Infinity or NaN (all exponent values larger than the half range).
+			if (bits >= 0x47800000u)
+				result = (bits > 0x7f800000u) ? 0x7e00 : 0x7c00;
+
+			// Zero and half precision sub-normals. Let the FPU do the rounding using a magic value.
+			else if (bits < 0x38800000u)
+				result = static_cast<UI16>(_Helpers::FloatBits(_Helpers::BitsFloat(bits) + _Helpers::BitsFloat(0x3f000000u)) - 0x3f000000u);
+
+			// Normalized numbers. Re-bias the exponent and round the mantissa to nearest even.
+			else
+			{
+				const UI32 mantissaOdd = (bits >> 13) & 1;
+				bits += (static_cast<UI32>(15 - 127) << 23) + 0xfff;
+				bits += mantissaOdd;
+				result = static_cast<UI16>(bits >> 13);
+			}
+
+			return result | static_cast<UI16>(sign >> 16);
+		}
+
+		float HalfToFloat(UI16 value)
+		{
+			constexpr UI32 shiftedExponent = 0x7c00u << 13;
+
+			UI32 bits = (value & 0x7fffu) << 13;
+			const UI32 exponent = shiftedExponent & bits;
+			bits += static_cast<UI32>(127 - 15) << 23;
+
+			// Infinity or NaN.
+			if (exponent == shiftedExponent)
+				bits += static_cast<UI32>(128 - 16) << 23;
+
+			// Zero or sub-normal.
+			else if (exponent == 0)
+			{
+				bits += 1u << 23;
+				bits = _Helpers::FloatBits(_Helpers::BitsFloat(bits) - _Helpers::BitsFloat(113u << 23));
+			}
+
+			return _Helpers::BitsFloat(bits | ((value & 0x8000u) << 16));
+		}
+
+		I16 FloatToSNorm16(float value)
+		{
+			return static_cast<I16>(std::nearbyint(_Helpers::Clamp(value, -1.0f, 1.0f) * 32767.0f));
+		}
+
+		float SNorm16ToFloat(I16 value)
+		{
+			const float result = static_cast<float>(value) / 32767.0f;
+			return result < -1.0f ? -1.0f : result;
+		}
+
+		UI8 FloatToUNorm8(float value)
+		{
+			return static_cast<UI8>(std::nearbyint(_Helpers::Clamp(value, 0.0f, 1.0f) * 255.0f));
+		}
+
+		float UNorm8ToFloat(UI8 value)
+		{
+			return static_cast<float>(value) / 255.0f;
+		}
+
+		UI32 EncodeOctahedral16(const Vector3& normal)
+		{
+			float x = 0.0f, y = 0.0f;
+			_Helpers::OctahedralMap(normal, x, y);
+
+			return static_cast<UI16>(FloatToSNorm16(x)) | (static_cast<UI32>(static_cast<UI16>(FloatToSNorm16(y))) << 16);
+		}
+
+		Vector3 DecodeOctahedral16(UI32 value)
+		{
+			return _Helpers::OctahedralUnmap(
+				SNorm16ToFloat(static_cast<I16>(value & 0xffffu)),
+				SNorm16ToFloat(static_cast<I16>(value >> 16)));
+		}
+
+		UI16 EncodeOctahedral8(const Vector3& normal)
+		{
+			float x = 0.0f, y = 0.0f;
+			_Helpers::OctahedralMap(normal, x, y);
+
+			const I8 encodedX = static_cast<I8>(std::nearbyint(_Helpers::Clamp(x, -1.0f, 1.0f) * 127.0f));
+			const I8 encodedY = static_cast<I8>(std::nearbyint(_Helpers::Clamp(y, -1.0f, 1.0f) * 127.0f));
+
+			return static_cast<UI8>(encodedX) | static_cast<UI16>(static_cast<UI8>(encodedY) << 8);
+		}
+
+		Vector3 DecodeOctahedral8(UI16 value)
+		{
+			const float x = static_cast<float>(static_cast<I8>(value & 0xffu)) / 127.0f;
+			const float y = static_cast<float>(static_cast<I8>(value >> 8)) / 127.0f;
+
+			return _Helpers::OctahedralUnmap(x < -1.0f ? -1.0f : x, y < -1.0f ? -1.0f : y);
+		}
+
+		void FloatToHalf(UI16* pDestination, const float* pSource, UI64 count)
+		{
+			UI64 index = 0;
+
+#ifdef DMK_QUANTIZATION_F16C
+			for (; index + 8 <= count; index += 8)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(pDestination + index), _mm256_cvtps_ph(_mm256_loadu_ps(pSource + index), _MM_FROUND_TO_NEAREST_INT));
+
+#endif // DMK_QUANTIZATION_F16C
+
+			for (; index < count; index++)
+				pDestination[index] = FloatToHalf(pSource[index]);
+		}
+
+		void HalfToFloat(float* pDestination, const UI16* pSource, UI64 count)
+		{
+			UI64 index = 0;
+
+#ifdef DMK_QUANTIZATION_F16C
+			for (; index + 8 <= count; index += 8)
+				_mm256_storeu_ps(pDestination + index, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource + index))));
+
+#endif // DMK_QUANTIZATION_F16C
+
+			for (; index < count; index++)
+				pDestination[index] = HalfToFloat(pSource[index]);
+		}
+
+		void FloatToSNorm16(I16* pDestination, const float* pSource, UI64 count)
+		{
+			UI64 index = 0;
+
+#ifdef DMK_QUANTIZATION_AVX2
+			const __m256 low = _mm256_set1_ps(-1.0f);
+			const __m256 high = _mm256_set1_ps(1.0f);
+			const __m256 scale = _mm256_set1_ps(32767.0f);
+
+			for (; index + 8 <= count; index += 8)
+			{
+				// max(x, -1) maps NaN to -1, matching the scalar clamp.
+				const __m256 clamped = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(pSource + index), low), high);
+				const __m256i integers = _mm256_cvtps_epi32(_mm256_mul_ps(clamped, scale));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(pDestination + index),
+					_mm_packs_epi32(_mm256_castsi256_si128(integers), _mm256_extracti128_si256(integers, 1)));
+			}
+
+#endif // DMK_QUANTIZATION_AVX2
+
+			for (; index < count; index++)
+				pDestination[index] = FloatToSNorm16(pSource[index]);
+		}
+
+		void SNorm16ToFloat(float* pDestination, const I16* pSource, UI64 count)
+		{
+			UI64 index = 0;
+
+#ifdef DMK_QUANTIZATION_AVX2
+			const __m256 low = _mm256_set1_ps(-1.0f);
+			const __m256 scale = _mm256_set1_ps(32767.0f);
+
+			for (; index + 8 <= count; index += 8)
+			{
+				const __m256 values = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource + index))));
+				_mm256_storeu_ps(pDestination + index, _mm256_max_ps(_mm256_div_ps(values, scale), low));
+			}
+
+#endif // DMK_QUANTIZATION_AVX2
+
+			for (; index < count; index++)
+				pDestination[index] = SNorm16ToFloat(pSource[index]);
+		}
+
+		void FloatToUNorm8(UI8* pDestination, const float* pSource, UI64 count)
+		{
+			UI64 index = 0;
+
+#ifdef DMK_QUANTIZATION_AVX2
+			const __m256 low = _mm256_setzero_ps();
+			const __m256 high = _mm256_set1_ps(1.0f);
+			const __m256 scale = _mm256_set1_ps(255.0f);
+
+			for (; index + 8 <= count; index += 8)
+			{
+				const __m256 clamped = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(pSource + index), low), high);
+				const __m256i integers = _mm256_cvtps_epi32(_mm256_mul_ps(clamped, scale));
+				const __m128i shorts = _mm_packs_epi32(_mm256_castsi256_si128(integers), _mm256_extracti128_si256(integers, 1));
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(pDestination + index), _mm_packus_epi16(shorts, shorts));
+			}
+
+#endif // DMK_QUANTIZATION_AVX2
+
+			for (; index < count; index++)
+				pDestination[index] = FloatToUNorm8(pSource[index]);
+		}
+
+		void UNorm8ToFloat(float* pDestination, const UI8* pSource, UI64 count)
+		{
+			UI64 index = 0;
+
+#ifdef DMK_QUANTIZATION_AVX2
+			const __m256 scale = _mm256_set1_ps(255.0f);
+
+			for (; index + 8 <= count; index += 8)
+			{
+				const __m256 values = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pSource + index))));
+				_mm256_storeu_ps(pDestination + index, _mm256_div_ps(values, scale));
+			}
+
+#endif // DMK_QUANTIZATION_AVX2
+
+			for (; index < count; index++)
+				pDestination[index] = UNorm8ToFloat(pSource[index]);
+		}
+
+		void EncodeOctahedral16(UI32* pDestination, const float* pNormals, UI64 count)
+		{
+			for (UI64 index = 0; index < count; index++, pNormals += 3)
+				pDestination[index] = EncodeOctahedral16(Vector3(pNormals[0], pNormals[1], pNormals[2]));
+		}
+
+		void DecodeOctahedral16(float* pNormals, const UI32* pSource, UI64 count)
+		{
+			for (UI64 index = 0; index < count; index++, pNormals += 3)
+			{
+				const Vector3 normal = DecodeOctahedral16(pSource[index]);
+				pNormals[0] = normal.x;
+				pNormals[1] = normal.y;
+				pNormals[2] = normal.z;
+			}
+		}
+	}
+}
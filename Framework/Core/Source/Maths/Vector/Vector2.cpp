@@ -8,15 +8,6 @@
 
 namespace DMK
 {
-	Vector2::Vector2(std::initializer_list<float> list)
-		: x(0.0f), y(0.0f)
-	{
-		if ((list.size() > 2) || (list.size() < 2))
-			DMK_LOG_ERROR(TEXT("The size of the provided list does not match the current Vector size! Expected size is 2."));
-
-		MemoryFunctions::MoveData(this, Cast<const void*>(list.begin()), list.size() * sizeof(float));
-	}
-
 	Vector2 Vector2::operator=(const std::initializer_list<float>& list)
 	{
 		if ((list.size() > 2) || (list.size() < 2))
@@ -27,91 +18,6 @@ namespace DMK
 		return *this;
 	}
 
-	const float Vector2::operator[](UI32 index) const
-	{
-		return (operator const float* ())[index];
-	}
-
-	float& Vector2::operator[](UI32 index)
-	{
-		return const_cast<float&>((operator const float* ())[index]);
-	}
-
-	Vector2::operator const float* () const
-	{
-		return &this->x;
-	}
-
-	Vector2 operator+(const Vector2& lhs, const Vector2& rhs)
-	{
-		return Vector2(lhs.x + rhs.x, lhs.y + rhs.y);
-	}
-
-	Vector2 operator-(const Vector2& lhs, const Vector2& rhs)
-	{
-		return Vector2(lhs.x - rhs.x, lhs.y - rhs.y);
-	}
-
-	Vector2 operator*(const Vector2& lhs, const Vector2& rhs)
-	{
-		return Vector2(lhs.x * rhs.x, lhs.y * rhs.y);
-	}
-
-	Vector2 operator/(const Vector2& lhs, const Vector2& rhs)
-	{
-		return Vector2(lhs.x / rhs.x, lhs.y / rhs.y);
-	}
-
-	Vector2 operator+(const Vector2& lhs, const float& value)
-	{
-		return lhs + Vector2(value);
-	}
-
-	Vector2 operator-(const Vector2& lhs, const float& value)
-	{
-		return lhs - Vector2(value);
-	}
-
-	Vector2 operator*(const Vector2& lhs, const float& value)
-	{
-		return lhs * Vector2(value);
-	}
-
-	Vector2 operator/(const Vector2& lhs, const float& value)
-	{
-		return lhs / Vector2(value);
-	}
-
-	bool operator==(const Vector2& lhs, const Vector2& rhs)
-	{
-		return (lhs.x == rhs.x) && (lhs.y == rhs.y);
-	}
-
-	bool operator!=(const Vector2& lhs, const Vector2& rhs)
-	{
-		return (lhs.x != rhs.x) || (lhs.y != rhs.y);
-	}
-
-	bool operator<(const Vector2& lhs, const Vector2& rhs)
-	{
-		return (lhs.x < rhs.x) || (lhs.y < rhs.y);
-	}
-
-	bool operator<=(const Vector2& lhs, const Vector2& rhs)
-	{
-		return (lhs.x <= rhs.x) || (lhs.y <= rhs.y);
-	}
-
-	bool operator>(const Vector2& lhs, const Vector2& rhs)
-	{
-		return (lhs.x > rhs.x) || (lhs.y > rhs.y);
-	}
-
-	bool operator>=(const Vector2& lhs, const Vector2& rhs)
-	{
-		return (lhs.x >= rhs.x) || (lhs.y >= rhs.y);
-	}
-
 	bool operator&&(const Vector2& lhs, const Vector2& rhs)
 	{
 		return (lhs.x && rhs.x) && (lhs.y && rhs.y);
@@ -136,4 +42,8 @@ namespace DMK
 	{
 		return (rhs.x != 0) && (rhs.y != 0);
 	}
+
+	/* Compile time checks for the constexpr constructors and operators. */
+	static_assert((Vector2(1.0f, 2.0f) + Vector2(3.0f)) == Vector2(4.0f, 5.0f), "Constant evaluation failed!");
+	static_assert(Vector2{ 2.0f, 4.0f } / 2.0f == Vector2(1.0f, 2.0f), "Constant evaluation failed!");
 }
\ No newline at end of file
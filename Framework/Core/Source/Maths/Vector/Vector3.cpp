@@ -9,16 +9,6 @@
 
 namespace DMK
 {
-	Vector3::Vector3(std::initializer_list<float> list)
-		: x(0.0f), y(0.0f), z(0.0f), w(0.0f)
-	{
-		if ((list.size() > 3) || (list.size() < 3))
-			DMK_LOG_ERROR(TEXT("The size of the provided list does not match the current Vector size!"));
-
-		MemoryFunctions::MoveData(this, Cast<const void*>(list.begin()), list.size() * sizeof(float));
-		w = 0.0f;
-	}
-
 	Vector3::Vector3(const float* ptr)
 		: x(0.0f), y(0.0f), z(0.0f), w(0.0f)
 	{
@@ -35,125 +25,10 @@ namespace DMK
 		return *this;
 	}
 
-	const float Vector3::operator[](UI32 index) const
-	{
-		return (operator const float* ())[index];
-	}
-
-	float& Vector3::operator[](UI32 index)
-	{
-		return const_cast<float&>((operator const float* ())[index]);
-	}
-
-	Vector3::operator const float* () const
-	{
-		return &this->x;
-	}
-
-	Vector3 operator+(const Vector3& lhs, const Vector3& rhs)
-	{
-		Vector3 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_add_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
-
-		return vec;
-	}
-
-	Vector3 operator-(const Vector3& lhs, const Vector3& rhs)
-	{
-		Vector3 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_sub_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
-
-		return vec;
-	}
-
-	Vector3 operator*(const Vector3& lhs, const Vector3& rhs)
-	{
-		Vector3 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_mul_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
-
-		return vec;
-	}
-
-	Vector3 operator/(const Vector3& lhs, const Vector3& rhs)
-	{
-		Vector3 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_div_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
-
-		return vec;
-	}
-
-	Vector3 operator+(const Vector3& lhs, const float& value)
-	{
-		return lhs + Vector3(value);
-	}
-
-	Vector3 operator-(const Vector3& lhs, const float& value)
-	{
-		return lhs - Vector3(value);
-	}
-
-	Vector3 operator*(const Vector3& lhs, const float& value)
-	{
-		return lhs * Vector3(value);
-	}
-
-	Vector3 operator/(const Vector3& lhs, const float& value)
-	{
-		return lhs / Vector3(value);
-	}
-
-	bool operator==(const Vector3& lhs, const Vector3& rhs)
-	{
-		Vector3 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_cmpeq_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
-
-		return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
-	}
-
-	bool operator!=(const Vector3& lhs, const Vector3& rhs)
-	{
-		Vector3 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_cmpneq_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
-
-		return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
-	}
-
-	bool operator<(const Vector3& lhs, const Vector3& rhs)
-	{
-		Vector3 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_cmplt_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
-
-		return ((vec.r) || (vec.g) || (vec.b) || (vec.a));
-	}
-
-	bool operator<=(const Vector3& lhs, const Vector3& rhs)
-	{
-		Vector3 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_cmple_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
-
-		return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
-	}
-
-	bool operator>(const Vector3& lhs, const Vector3& rhs)
-	{
-		Vector3 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_cmpgt_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
-
-		return ((vec.r) || (vec.g) || (vec.b) || (vec.a));
-	}
-
-	bool operator>=(const Vector3& lhs, const Vector3& rhs)
-	{
-		Vector3 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_cmpge_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
-
-		return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
-	}
-
 	bool operator&&(const Vector3& lhs, const Vector3& rhs)
 	{
 		Vector3 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_and_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
+		_mm_storeu_ps(&vec.x, _mm_and_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
 
 		return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
 	}
@@ -161,7 +36,7 @@ namespace DMK
 	bool operator||(const Vector3& lhs, const Vector3& rhs)
 	{
 		Vector3 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_or_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
+		_mm_storeu_ps(&vec.x, _mm_or_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
 
 		return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
 	}
@@ -169,7 +44,7 @@ namespace DMK
 	bool operator^(const Vector3& lhs, const Vector3& rhs)
 	{
 		Vector3 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_or_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
+		_mm_storeu_ps(&vec.x, _mm_or_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
 
 		return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
 	}
@@ -177,7 +52,7 @@ namespace DMK
 	bool operator~(const Vector3& rhs)
 	{
 		Vector3 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_or_ps(_mm_load_ps(&rhs.x), _mm_load_ps(Vector3(-1.0f))));
+		_mm_storeu_ps(&vec.x, _mm_or_ps(_mm_loadu_ps(&rhs.x), _mm_loadu_ps(Vector3(-1.0f))));
 
 		return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
 	}
@@ -185,8 +60,12 @@ namespace DMK
 	bool operator!(const Vector3& rhs)
 	{
 		Vector3 vec = {};
-		_mm_store_ps(&vec.x, _mm_or_ps(_mm_load_ps(&rhs.x), _mm_load_ps(Vector3(0.0f))));
+		_mm_storeu_ps(&vec.x, _mm_or_ps(_mm_loadu_ps(&rhs.x), _mm_loadu_ps(Vector3(0.0f))));
 
 		return ((vec.r == 0) && (vec.g == 0) && (vec.b == 0) && (vec.a == 0));
 	}
+
+	/* Compile time checks for the constexpr constructors and operators. */
+	static_assert((Vector3(1.0f, 2.0f, 3.0f) * 2.0f) == Vector3(2.0f, 4.0f, 6.0f), "Constant evaluation failed!");
+	static_assert(Vector3{ 1.0f, 2.0f, 3.0f }[2] == 3.0f, "Constant evaluation failed!");
 }
\ No newline at end of file
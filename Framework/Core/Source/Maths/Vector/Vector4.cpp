@@ -9,17 +9,8 @@
 
 namespace DMK
 {
-	Vector4::Vector4(std::initializer_list<float> list)
-		: x(0.0f), y(0.0f), z(0.0f), w(0.0f)
-	{
-		if ((list.size() > 4) || (list.size() < 4))
-			DMK_LOG_ERROR(TEXT("The size of the provided list does not match the current Vector size! Expected size is 4."));
-
-		MemoryFunctions::MoveData(this, Cast<const void*>(list.begin()), list.size() * sizeof(float));
-	}
-
 	Vector4::Vector4(const float* ptr)
-		: x(0.0f), y(0.0f), z(0.0f), w(0.0f)
+		: r(0.0f), g(0.0f), b(0.0f), a(0.0f)
 	{
 		MemoryFunctions::MoveData(this, Cast<const void*>(ptr), sizeof(float) * 4);
 	}
@@ -34,125 +25,10 @@ namespace DMK
 		return *this;
 	}
 
-	const float Vector4::operator[](UI32 index) const
-	{
-		return (operator const float* ())[index];
-	}
-
-	float& Vector4::operator[](UI32 index)
-	{
-		return const_cast<float&>((operator const float* ())[index]);
-	}
-
-	Vector4::operator const float* () const
-	{
-		return &this->x;
-	}
-
-	Vector4 operator+(const Vector4& lhs, const Vector4& rhs)
-	{
-		Vector4 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_add_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
-
-		return vec;
-	}
-
-	Vector4 operator-(const Vector4& lhs, const Vector4& rhs)
-	{
-		Vector4 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_sub_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
-
-		return vec;
-	}
-
-	Vector4 operator*(const Vector4& lhs, const Vector4& rhs)
-	{
-		Vector4 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_mul_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
-
-		return vec;
-	}
-
-	Vector4 operator/(const Vector4& lhs, const Vector4& rhs)
-	{
-		Vector4 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_div_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
-
-		return vec;
-	}
-
-	Vector4 operator+(const Vector4& lhs, const float& value)
-	{
-		return lhs + Vector4(value);
-	}
-
-	Vector4 operator-(const Vector4& lhs, const float& value)
-	{
-		return lhs - Vector4(value);
-	}
-
-	Vector4 operator*(const Vector4& lhs, const float& value)
-	{
-		return lhs * Vector4(value);
-	}
-
-	Vector4 operator/(const Vector4& lhs, const float& value)
-	{
-		return lhs / +Vector4(value);
-	}
-
-	bool operator==(const Vector4& lhs, const Vector4& rhs)
-	{
-		Vector4 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_cmpeq_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
-
-		return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
-	}
-
-	bool operator!=(const Vector4& lhs, const Vector4& rhs)
-	{
-		Vector4 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_cmpneq_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
-
-		return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
-	}
-
-	bool operator<(const Vector4& lhs, const Vector4& rhs)
-	{
-		Vector4 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_cmplt_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
-
-		return ((vec.r) || (vec.g) || (vec.b) || (vec.a));
-	}
-
-	bool operator<=(const Vector4& lhs, const Vector4& rhs)
-	{
-		Vector4 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_cmple_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
-
-		return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
-	}
-
-	bool operator>(const Vector4& lhs, const Vector4& rhs)
-	{
-		Vector4 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_cmpgt_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
-
-		return ((vec.r) || (vec.g) || (vec.b) || (vec.a));
-	}
-
-	bool operator>=(const Vector4& lhs, const Vector4& rhs)
-	{
-		Vector4 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_cmpge_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
-
-		return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
-	}
-
 	bool operator&&(const Vector4& lhs, const Vector4& rhs)
 	{
 		Vector4 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_and_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
+		_mm_storeu_ps(&vec.x, _mm_and_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
 
 		return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
 	}
@@ -160,7 +36,7 @@ namespace DMK
 	bool operator||(const Vector4& lhs, const Vector4& rhs)
 	{
 		Vector4 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_or_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
+		_mm_storeu_ps(&vec.x, _mm_or_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
 
 		return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
 	}
@@ -168,7 +44,7 @@ namespace DMK
 	bool operator^(const Vector4& lhs, const Vector4& rhs)
 	{
 		Vector4 vec = 0.0f;
-		_mm_store_ps(&vec.x, _mm_or_ps(_mm_load_ps(&lhs.x), _mm_load_ps(&rhs.x)));
+		_mm_storeu_ps(&vec.x, _mm_or_ps(_mm_loadu_ps(&lhs.x), _mm_loadu_ps(&rhs.x)));
 
 		return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
 	}
@@ -177,7 +53,7 @@ namespace DMK
 	{
 		Vector4 vec = 0.0f;
 		Vector4 check = { -1.0f };
-		_mm_store_ps(&vec.x, _mm_or_ps(_mm_load_ps(&rhs.x), _mm_load_ps(&check.x)));
+		_mm_storeu_ps(&vec.x, _mm_or_ps(_mm_loadu_ps(&rhs.x), _mm_loadu_ps(&check.x)));
 
 		return ((vec.r) && (vec.g) && (vec.b) && (vec.a));
 	}
@@ -186,8 +62,12 @@ namespace DMK
 	{
 		Vector4 vec = 0.0f;
 		Vector4 check = { 0.0f };
-		_mm_store_ps(&vec.x, _mm_or_ps(_mm_load_ps(&rhs.x), _mm_load_ps(&check.x)));
+		_mm_storeu_ps(&vec.x, _mm_or_ps(_mm_loadu_ps(&rhs.x), _mm_loadu_ps(&check.x)));
 
 		return ((vec.r == 0) && (vec.g == 0) && (vec.b == 0) && (vec.a == 0));
 	}
+
+	/* Compile time checks for the constexpr constructors and operators. */
+	static_assert((Vector4(4.0f) - Vector4(1.0f, 2.0f, 3.0f, 4.0f)) == Vector4(3.0f, 2.0f, 1.0f, 0.0f), "Constant evaluation failed!");
+	static_assert(Vector4(1.0f) < Vector4(1.0f, 1.0f, 1.0f, 2.0f), "Constant evaluation failed!");
 }
\ No newline at end of file
@@ -0,0 +1,367 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Core/Memory/AllocationProfiler.h"
+#include "Core/Random/RandomEngine.h"
+#include "Core/Hash/Hasher.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#ifdef _WIN32
+#include <Windows.h>
+
+#elif defined(__linux__)
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+
+#endif
+
+namespace DMK
+{
+	namespace AllocationProfiler
+	{
+		namespace _Helpers
+		{
+			std::atomic<bool> bIsEnabled = { false };
+			std::atomic<UI64> SampledCount = { 0 };
+			std::atomic<UI16> AddressFilter[AddressFilterSize] = {};
+
+			/**
+			 * Sampled Allocation structure.
+			 */
+			struct SampledAllocation {
+				UI64 mCallSiteIndex = 0;	// The call site which allocated it.
+				UI64 mEstimatedBytes = 0;	// The bytes this sample represents.
+				UI64 mEstimatedCount = 0;	// The allocations this sample represents.
+			};
+
+			std::atomic<UI64> SamplingInterval = { DefaultSamplingInterval };	// Average bytes between two samples.
+
+			std::mutex ProfileMutex;	// Guards the state below.
+			std::vector<CallSiteReport> CallSites;	// All the call sites.
+			std::unordered_map<UI64, UI64> CallSiteIndices;	// Call site indices by stack hash.
+			std::unordered_map<void*, SampledAllocation> Allocations;	// Live sampled allocations.
+
+			/**
+			 * Profile Lifetime structure.
+			 * Allocations can be deallocated by other static objects after the state above is destroyed, so stop
+			 * tracking before that.
+			 */
+			struct ProfileLifetime {
+				~ProfileLifetime()
+				{
+					bIsEnabled.store(false, std::memory_order_relaxed);
+					SampledCount.store(0, std::memory_order_relaxed);
+				}
+			} Lifetime;
+
+			thread_local bool bIsThreadInitialized = false;	// Whether the calling thread drew its first interval.
+			thread_local bool bIsSampling = false;	// Guards against sampling the profiler's own allocations.
+
+			/**
+			 * Draw the number of bytes until the next sample from an exponential distribution.
+			 */
+			I64 DrawInterval()
+			{
+				// 1 - U is in (0, 1], so the logarithm is finite.
+				const double uniform = 1.0 - Random::RandomEngine::ThreadLocal().NextDouble();
+				const double interval = -std::log(uniform) * static_cast<double>(SamplingInterval.load(std::memory_order_relaxed));
+
+				return static_cast<I64>(std::min(interval, 1e15)) + 1;
+			}
+
+			/**
+			 * Capture the return addresses of the calling thread, innermost first.
+			 *
+			 * @param pFrames: The frame array of MaxStackDepth entries.
+			 * @param skipCount: Number of innermost frames to skip.
+			 * @return The number of captured frames.
+			 */
+			UI64 CaptureStack(void** pFrames, UI64 skipCount)
+			{
+#ifdef _WIN32
+				// This function is skipped too.
+				return CaptureStackBackTrace(static_cast<DWORD>(skipCount + 1), static_cast<DWORD>(MaxStackDepth), pFrames, nullptr);
+
+#elif defined(__linux__)
+				void* pBuffer[MaxStackDepth + 4] = {};
+				const UI64 count = static_cast<UI64>(backtrace(pBuffer, static_cast<int>(MaxStackDepth + 4)));
+
+				// This function is skipped too.
+				const UI64 skip = std::min(count, skipCount + 1);
+				const UI64 frameCount = std::min(count - skip, MaxStackDepth);
+				std::memcpy(pFrames, pBuffer + skip, frameCount * sizeof(void*));
+
+				return frameCount;
+
+#else
+				return 0;
+
+#endif
+			}
+
+			/**
+			 * Find or create the call site of a stack. The profile mutex must be locked.
+			 */
+			UI64 GetCallSiteIndex(void** pFrames, UI64 frameCount)
+			{
+				UI64 hash = Hasher::GetHash(pFrames, frameCount * sizeof(void*));
+
+				// Probe linearly in the unlikely case of a hash collision.
+				while (true)
+				{
+					const auto itr = CallSiteIndices.find(hash);
+					if (itr == CallSiteIndices.end())
+						break;
+
+					const auto& report = CallSites[itr->second];
+					if (report.mFrameCount == frameCount && std::memcmp(report.pFrames, pFrames, frameCount * sizeof(void*)) == 0)
+						return itr->second;
+
+					hash++;
+				}
+
+				CallSiteReport callSite;
+				std::memcpy(callSite.pFrames, pFrames, frameCount * sizeof(void*));
+				callSite.mFrameCount = frameCount;
+
+				CallSites.push_back(callSite);
+				CallSiteIndices[hash] = CallSites.size() - 1;
+
+				return CallSites.size() - 1;
+			}
+
+			void SampleAllocation(void* pAddress, UI64 size)
+			{
+				if (bIsSampling)
+					return;
+
+				bIsSampling = true;
+
+				// The first interval of a thread is drawn on its first allocation.
+				if (!bIsThreadInitialized)
+				{
+					bIsThreadInitialized = true;
+					BytesUntilSample = DrawInterval() - static_cast<I64>(size);
+
+					if (BytesUntilSample > 0)
+					{
+						bIsSampling = false;
+						return;
+					}
+				}
+
+				BytesUntilSample = DrawInterval();
+
+				void* pFrames[MaxStackDepth] = {};
+				const UI64 frameCount = CaptureStack(pFrames, 1);
+
+				// An allocation of size bytes is sampled with the probability 1 - e^(-size / interval), so each sample
+				// stands for 1 / probability allocations.
+				const double probability = 1.0 - std::exp(-static_cast<double>(size) / static_cast<double>(SamplingInterval.load(std::memory_order_relaxed)));
+				const double weight = probability > 0.0 ? 1.0 / probability : 1.0;
+
+				SampledAllocation allocation;
+				allocation.mEstimatedBytes = static_cast<UI64>(static_cast<double>(size) * weight + 0.5);
+				allocation.mEstimatedCount = static_cast<UI64>(weight + 0.5);
+
+				{
+					std::lock_guard<std::mutex> _lock(ProfileMutex);
+					allocation.mCallSiteIndex = GetCallSiteIndex(pFrames, frameCount);
+
+					auto& callSite = CallSites[allocation.mCallSiteIndex];
+					callSite.mLiveBytes += allocation.mEstimatedBytes;
+					callSite.mLiveCount += allocation.mEstimatedCount;
+					callSite.mTotalBytes += allocation.mEstimatedBytes;
+					callSite.mTotalCount += allocation.mEstimatedCount;
+
+					// The address can only be reused after it was deallocated, but the deallocation might not have
+					// gone through the static allocator.
+					const auto itr = Allocations.find(pAddress);
+					if (itr != Allocations.end())
+					{
+						auto& previous = CallSites[itr->second.mCallSiteIndex];
+						previous.mLiveBytes -= itr->second.mEstimatedBytes;
+						previous.mLiveCount -= itr->second.mEstimatedCount;
+						itr->second = allocation;
+					}
+					else
+					{
+						Allocations[pAddress] = allocation;
+						AddressFilter[GetFilterIndex(pAddress)].fetch_add(1, std::memory_order_relaxed);
+						SampledCount.fetch_add(1, std::memory_order_relaxed);
+					}
+				}
+
+				bIsSampling = false;
+			}
+
+			void ReleaseAllocation(void* pAddress)
+			{
+				std::lock_guard<std::mutex> _lock(ProfileMutex);
+
+				const auto itr = Allocations.find(pAddress);
+				if (itr == Allocations.end())
+					return;
+
+				auto& callSite = CallSites[itr->second.mCallSiteIndex];
+				callSite.mLiveBytes -= itr->second.mEstimatedBytes;
+				callSite.mLiveCount -= itr->second.mEstimatedCount;
+
+				Allocations.erase(itr);
+				AddressFilter[GetFilterIndex(pAddress)].fetch_sub(1, std::memory_order_relaxed);
+				SampledCount.fetch_sub(1, std::memory_order_relaxed);
+			}
+
+			/**
+			 * Get the name of a frame.
+			 */
+			std::string GetFrameName(void* pFrame)
+			{
+				char buffer[32] = {};
+				snprintf(buffer, sizeof(buffer), "0x%llx", static_cast<unsigned long long>(reinterpret_cast<UI64>(pFrame)));
+
+#ifdef __linux__
+				Dl_info info = {};
+				if (dladdr(pFrame, &info) && info.dli_sname)
+				{
+					int status = 0;
+					char* pDemangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+
+					std::string name = status == 0 && pDemangled ? pDemangled : info.dli_sname;
+					free(pDemangled);
+
+					// Semicolons separate the frames in the folded format.
+					std::replace(name.begin(), name.end(), ';', ':');
+					return name;
+				}
+
+#endif
+
+				return buffer;
+			}
+		}
+
+		void Enable(UI64 samplingInterval)
+		{
+			_Helpers::SamplingInterval.store(samplingInterval ? samplingInterval : 1, std::memory_order_relaxed);
+			_Helpers::bIsEnabled.store(true, std::memory_order_relaxed);
+		}
+
+		void Disable()
+		{
+			_Helpers::bIsEnabled.store(false, std::memory_order_relaxed);
+		}
+
+		UI64 GetSamplingInterval()
+		{
+			return _Helpers::SamplingInterval.load(std::memory_order_relaxed);
+		}
+
+		std::vector<CallSiteReport> GetCallSites()
+		{
+			std::lock_guard<std::mutex> _lock(_Helpers::ProfileMutex);
+			return _Helpers::CallSites;
+		}
+
+		bool ExportFolded(const char* pFilePath, bool bLiveBytes)
+		{
+			FILE* pFile = fopen(pFilePath, "w");
+			if (!pFile)
+				return false;
+
+			std::unordered_map<void*, std::string> names;
+			for (const auto& report : GetCallSites())
+			{
+				const UI64 bytes = bLiveBytes ? report.mLiveBytes : report.mTotalBytes;
+				if (!bytes)
+					continue;
+
+				// The folded format lists the outermost frame first.
+				for (UI64 index = report.mFrameCount; index > 0; index--)
+				{
+					void* pFrame = report.pFrames[index - 1];
+
+					auto itr = names.find(pFrame);
+					if (itr == names.end())
+						itr = names.insert({ pFrame, _Helpers::GetFrameName(pFrame) }).first;
+
+					fprintf(pFile, index == report.mFrameCount ? "%s" : ";%s", itr->second.c_str());
+				}
+
+				fprintf(pFile, " %llu\n", bytes);
+			}
+
+			fclose(pFile);
+			return true;
+		}
+
+		bool ExportHeapProfile(const char* pFilePath)
+		{
+			FILE* pFile = fopen(pFilePath, "w");
+			if (!pFile)
+				return false;
+
+			const auto reports = GetCallSites();
+
+			// The values are already unsampled, so no sampling rate is written.
+			CallSiteReport total;
+			for (const auto& report : reports)
+			{
+				total.mLiveCount += report.mLiveCount;
+				total.mLiveBytes += report.mLiveBytes;
+				total.mTotalCount += report.mTotalCount;
+				total.mTotalBytes += report.mTotalBytes;
+			}
+
+			fprintf(pFile, "heap profile: %llu: %llu [%llu: %llu] @ heap\n", total.mLiveCount, total.mLiveBytes, total.mTotalCount, total.mTotalBytes);
+
+			for (const auto& report : reports)
+			{
+				fprintf(pFile, "%llu: %llu [%llu: %llu] @", report.mLiveCount, report.mLiveBytes, report.mTotalCount, report.mTotalBytes);
+				for (UI64 index = 0; index < report.mFrameCount; index++)
+					fprintf(pFile, " 0x%llx", static_cast<unsigned long long>(reinterpret_cast<UI64>(report.pFrames[index])));
+
+				fprintf(pFile, "\n");
+			}
+
+#ifdef __linux__
+			if (FILE* pMaps = fopen("/proc/self/maps", "r"))
+			{
+				fprintf(pFile, "\nMAPPED_LIBRARIES:\n");
+
+				char buffer[4096] = {};
+				UI64 size = 0;
+				while ((size = fread(buffer, 1, sizeof(buffer), pMaps)) > 0)
+					fwrite(buffer, 1, size, pFile);
+
+				fclose(pMaps);
+			}
+
+#endif
+
+			fclose(pFile);
+			return true;
+		}
+
+		void Reset()
+		{
+			std::lock_guard<std::mutex> _lock(_Helpers::ProfileMutex);
+			_Helpers::CallSites.clear();
+			_Helpers::CallSiteIndices.clear();
+			_Helpers::Allocations.clear();
+
+			_Helpers::SampledCount.store(0, std::memory_order_relaxed);
+			for (auto& counter : _Helpers::AddressFilter)
+				counter.store(0, std::memory_order_relaxed);
+		}
+	}
+}
@@ -3,6 +3,7 @@
 
 #include "Core/Memory/Functions.h"
 
+#include <cstring>
 #include <memory>
 
 namespace DMK
@@ -2,9 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Core/Random/OneTimeGenerator.h"
-#include "Core/Hash/Hasher.h"
-
-#include <chrono>
+#include "Core/Random/RandomEngine.h"
 
 namespace DMK
 {
@@ -12,10 +10,7 @@ namespace DMK
 	{
 		UI64 GenerateRandom(UI64 lowerBound, UI64 upperBound)
 		{
-			UI64 currentTime = static_cast<UI64>(std::chrono::time_point_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now()).time_since_epoch().count());
-			UI64 hashData[2] = { currentTime, reinterpret_cast<UI64>(&currentTime) };
-
-			return currentTime;
+			return RandomEngine::ThreadLocal().NextInRange(lowerBound, upperBound);
 		}
 	}
 }
\ No newline at end of file
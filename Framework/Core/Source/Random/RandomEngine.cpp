@@ -0,0 +1,256 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Core/Random/RandomEngine.h"
+#include "Core/Maths/IncludeSIMD.h"
+
+#include <chrono>
+#include <mutex>
+#include <random>
+
+namespace DMK
+{
+	namespace Random
+	{
+		namespace _Helpers
+		{
+			constexpr UI64 JumpPolynomial[4] = { 0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c };
+			constexpr UI64 LongJumpPolynomial[4] = { 0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241, 0x39109bb02acbe635 };
+
+			/**
+			 * Convert the upper 24 bits of a 32 bit value to a float in the range [0, 1).
+			 */
+			DMK_FORCEINLINE float ToFloat(UI32 value)
+			{
+				return static_cast<float>(value >> 8) * (1.0f / 16777216.0f);
+			}
+
+			/**
+			 * Get the process wide engine which the thread local engines are split from.
+			 * It is seeded using the system's entropy source and the current time.
+			 */
+			RandomEngine& GetMasterEngine()
+			{
+				static RandomEngine mEngine = []()
+				{
+					std::random_device device;
+					const UI64 entropy = (static_cast<UI64>(device()) << 32) | device();
+					const UI64 time = static_cast<UI64>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+
+					return RandomEngine(entropy ^ time);
+				}();
+
+				return mEngine;
+			}
+
+			std::mutex MasterEngineMutex;	// Master engine mutex.
+		}
+
+		void RandomEngine::Seed(UI64 seed)
+		{
+			for (UI64 index = 0; index < 4; index++)
+				mState[index] = SplitMix64(seed);
+
+			// The all zero state is the only invalid state.
+			if (!(mState[0] | mState[1] | mState[2] | mState[3]))
+				mState[0] = 1;
+		}
+
+		UI64 RandomEngine::NextInRange(UI64 lowerBound, UI64 upperBound)
+		{
+			if (lowerBound > upperBound)
+				std::swap(lowerBound, upperBound);
+
+			const UI64 range = upperBound - lowerBound;
+			if (range == std::numeric_limits<UI64>::max())
+				return Next();
+
+			return lowerBound + NextBounded(range + 1);
+		}
+
+		void RandomEngine::Fill(UI64* pArray, UI64 count)
+		{
+			for (UI64 index = 0; index < count; index++)
+				pArray[index] = Next();
+		}
+
+		void RandomEngine::FillFloat(float* pArray, UI64 count)
+		{
+			for (UI64 index = 0; index < count; index++)
+				pArray[index] = NextFloat();
+		}
+
+		void RandomEngine::Jump()
+		{
+			ApplyJump(_Helpers::JumpPolynomial);
+		}
+
+		void RandomEngine::LongJump()
+		{
+			ApplyJump(_Helpers::LongJumpPolynomial);
+		}
+
+		RandomEngine RandomEngine::Split()
+		{
+			RandomEngine engine = *this;
+			Jump();
+
+			return engine;
+		}
+
+		RandomEngine& RandomEngine::ThreadLocal()
+		{
+			thread_local RandomEngine mEngine = []()
+			{
+				std::lock_guard<std::mutex> _lock(_Helpers::MasterEngineMutex);
+				return _Helpers::GetMasterEngine().Split();
+			}();
+
+			return mEngine;
+		}
+
+		void RandomEngine::ApplyJump(const UI64* pPolynomial)
+		{
+			UI64 state[4] = {};
+
+			for (UI64 word = 0; word < 4; word++)
+			{
+				for (UI64 bit = 0; bit < 64; bit++)
+				{
+					if (pPolynomial[word] & (1ULL << bit))
+					{
+						state[0] ^= mState[0];
+						state[1] ^= mState[1];
+						state[2] ^= mState[2];
+						state[3] ^= mState[3];
+					}
+
+					Next();
+				}
+			}
+
+			mState[0] = state[0];
+			mState[1] = state[1];
+			mState[2] = state[2];
+			mState[3] = state[3];
+		}
+
+		BatchRandomEngine::BatchRandomEngine(UI64 seed)
+		{
+			RandomEngine engine(seed);
+			Initialize(engine);
+		}
+
+		BatchRandomEngine::BatchRandomEngine(RandomEngine& engine)
+		{
+			Initialize(engine);
+		}
+
+		void BatchRandomEngine::Initialize(RandomEngine& engine)
+		{
+			for (UI64 lane = 0; lane < 4; lane++)
+			{
+				const RandomEngine stream = engine.Split();
+				for (UI64 word = 0; word < 4; word++)
+					mState[word][lane] = stream.mState[word];
+			}
+		}
+
+		void BatchRandomEngine::Next(UI64* pValues)
+		{
+#if SSE_INSTR_SET > 7
+			__m256i s0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(mState[0]));
+			__m256i s1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(mState[1]));
+			__m256i s2 = _mm256_load_si256(reinterpret_cast<const __m256i*>(mState[2]));
+			__m256i s3 = _mm256_load_si256(reinterpret_cast<const __m256i*>(mState[3]));
+
+			// AVX2 has no 64 bit multiplication, but x * 5 = (x << 2) + x and x * 9 = (x << 3) + x.
+			const __m256i times5 = _mm256_add_epi64(_mm256_slli_epi64(s1, 2), s1);
+			const __m256i rotated = _mm256_or_si256(_mm256_slli_epi64(times5, 7), _mm256_srli_epi64(times5, 57));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(pValues), _mm256_add_epi64(_mm256_slli_epi64(rotated, 3), rotated));
+
+			const __m256i temporary = _mm256_slli_epi64(s1, 17);
+			s2 = _mm256_xor_si256(s2, s0);
+			s3 = _mm256_xor_si256(s3, s1);
+			s1 = _mm256_xor_si256(s1, s2);
+			s0 = _mm256_xor_si256(s0, s3);
+			s2 = _mm256_xor_si256(s2, temporary);
+			s3 = _mm256_or_si256(_mm256_slli_epi64(s3, 45), _mm256_srli_epi64(s3, 19));
+
+			_mm256_store_si256(reinterpret_cast<__m256i*>(mState[0]), s0);
+			_mm256_store_si256(reinterpret_cast<__m256i*>(mState[1]), s1);
+			_mm256_store_si256(reinterpret_cast<__m256i*>(mState[2]), s2);
+			_mm256_store_si256(reinterpret_cast<__m256i*>(mState[3]), s3);
+
+#else
+			for (UI64 lane = 0; lane < 4; lane++)
+			{
+				const UI64 times5 = mState[1][lane] * 5;
+				pValues[lane] = ((times5 << 7) | (times5 >> 57)) * 9;
+
+				const UI64 temporary = mState[1][lane] << 17;
+				mState[2][lane] ^= mState[0][lane];
+				mState[3][lane] ^= mState[1][lane];
+				mState[1][lane] ^= mState[2][lane];
+				mState[0][lane] ^= mState[3][lane];
+				mState[2][lane] ^= temporary;
+				mState[3][lane] = (mState[3][lane] << 45) | (mState[3][lane] >> 19);
+			}
+
+#endif // SSE_INSTR_SET > 7
+		}
+
+		void BatchRandomEngine::Fill(UI64* pArray, UI64 count)
+		{
+			UI64 index = 0;
+			for (; index + 4 <= count; index += 4)
+				Next(pArray + index);
+
+			if (index < count)
+			{
+				UI64 values[4] = {};
+				Next(values);
+
+				for (UI64 lane = 0; index < count; index++, lane++)
+					pArray[index] = values[lane];
+			}
+		}
+
+		void BatchRandomEngine::FillFloat(float* pArray, UI64 count)
+		{
+			alignas(32) UI64 values[4] = {};
+			UI64 index = 0;
+
+#if SSE_INSTR_SET > 7
+			const __m256 scale = _mm256_set1_ps(1.0f / 16777216.0f);
+			for (; index + 8 <= count; index += 8)
+			{
+				Next(values);
+
+				// Treat the 4 64 bit values as 8 32 bit values and keep the upper 24 bits of each.
+				const __m256i integers = _mm256_srli_epi32(_mm256_load_si256(reinterpret_cast<const __m256i*>(values)), 8);
+				_mm256_storeu_ps(pArray + index, _mm256_mul_ps(_mm256_cvtepi32_ps(integers), scale));
+			}
+
+#endif // SSE_INSTR_SET > 7
+
+			while (index < count)
+			{
+				Next(values);
+
+				// Same layout as the AVX2 path: the low half of each 64 bit value comes first.
+				for (UI64 element = 0; element < 8 && index < count; element++, index++)
+					pArray[index] = _Helpers::ToFloat(static_cast<UI32>(values[element / 2] >> ((element % 2) * 32)));
+			}
+		}
+
+		void BatchRandomEngine::FillFloat(float* pArray, UI64 count, float lowerBound, float upperBound)
+		{
+			FillFloat(pArray, count);
+
+			const float range = upperBound - lowerBound;
+			for (UI64 index = 0; index < count; index++)
+				pArray[index] = lowerBound + pArray[index] * range;
+		}
+	}
+}
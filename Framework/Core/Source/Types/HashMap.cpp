@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "Core/Maths/IncludeSIMD.h"
+#include "Core/Types/DataTypes.h"
 #include <vector>
 
 namespace DMK
@@ -35,19 +36,20 @@ namespace DMK
 		}
 
 		size_t count = hashVector.size() / CHUNK_SIZE;
-		__declspec(align(16)) unsigned __int64 hashBlock[CHUNK_SIZE] = { hash, hash };
+		alignas(16) UI64 hashBlock[CHUNK_SIZE] = { hash, hash };
 		auto dataPtr = hashVector.data();
 
 		size_t pos = 0;
 		while (count--)
 		{
-			__declspec(align(16)) unsigned __int64 block[CHUNK_SIZE] = { *(dataPtr + pos + 0), *(dataPtr + pos + 1) };
-			auto cmp = _mm_cmpeq_epi32(*reinterpret_cast<__m128i*>(hashBlock), *reinterpret_cast<__m128i*>(block));
+			alignas(16) UI64 block[CHUNK_SIZE] = { *(dataPtr + pos + 0), *(dataPtr + pos + 1) };
+			alignas(16) UI64 cmp[CHUNK_SIZE] = {};
+			_mm_store_si128(reinterpret_cast<__m128i*>(cmp), _mm_cmpeq_epi32(*reinterpret_cast<__m128i*>(hashBlock), *reinterpret_cast<__m128i*>(block)));
 
-			if (cmp.m128i_u64[pos + 0])
+			if (cmp[0])
 				return pos + 0;
 
-			if (cmp.m128i_u64[pos + 1])
+			if (cmp[1])
 				return pos + 1;
 
 			pos += CHUNK_SIZE;
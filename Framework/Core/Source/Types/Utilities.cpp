@@ -4,6 +4,7 @@
 #include "Core/Types/Utilities.h"
 
 #include <codecvt>
+#include <locale>
 
 namespace DMK
 {
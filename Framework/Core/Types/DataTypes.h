@@ -87,6 +87,19 @@ namespace DMK
 		MAT2 = 16,			// Translates to 16 bit matrix (2x2)
 		MAT3 = 36,			// Translates to 36 bit matrix (3x3)
 		MAT4 = 64,			// Translates to 64 bit matrix (4x4)
+
+		HALF = 2,			// Translates to 16 bit half precision float
+		HVEC2 = 4,			// Translates to 4 byte half precision vector (2 halfs)
+		HVEC3 = 8,			// Translates to 8 byte half precision vector (3 halfs, padded to 4)
+		HVEC4 = 8,			// Translates to 8 byte half precision vector (4 halfs)
+		SNORM16 = 2,		// Translates to 16 bit signed normalized integer ([-1, 1])
+		SNORM16_VEC2 = 4,	// Translates to 4 byte signed normalized vector (2 SNORM16)
+		SNORM16_VEC4 = 8,	// Translates to 8 byte signed normalized vector (4 SNORM16)
+		UNORM8 = 1,			// Translates to 8 bit unsigned normalized integer ([0, 1])
+		UNORM8_VEC2 = 2,	// Translates to 2 byte unsigned normalized vector (2 UNORM8)
+		UNORM8_VEC4 = 4,	// Translates to 4 byte unsigned normalized vector (4 UNORM8)
+		OCT_NORMAL16 = 4,	// Translates to 4 byte octahedral encoded unit vector (2 SNORM16)
+		OCT_NORMAL8 = 2,	// Translates to 2 byte octahedral encoded unit vector (2 SNORM8)
 	};
 
 	/**
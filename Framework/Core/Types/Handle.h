@@ -5,7 +5,7 @@
 
 #include "DataTypes.h"
 
-#define DMK_DEFINE_UI64_HANDLE(name)	enum class name : UI64 { INVALID = 0Ui64 }
+#define DMK_DEFINE_UI64_HANDLE(name)	enum class name : UI64 { INVALID = 0 }
 
 namespace DMK
 {
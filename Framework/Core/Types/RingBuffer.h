@@ -0,0 +1,255 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "DataTypes.h"
+#include "Core/Macros/Global.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace DMK
+{
+	/**
+	 * Ring Buffer structure.
+	 * This is a lock free, wait free, bounded queue for exactly one producer thread and one consumer thread.
+	 * The producer only writes the head index and the consumer only writes the tail index, so neither side needs
+	 * atomic read-modify-write operations. Each side keeps a cached copy of the other side's index to avoid
+	 * touching the shared cache line on every call.
+	 *
+	 * @tparam Type: The type of the elements.
+	 * @tparam ElementCount: The number of slots. Must be a power of two.
+	 */
+	template<class Type, UI64 ElementCount>
+	class RingBuffer {
+		static_assert(ElementCount && ((ElementCount & (ElementCount - 1)) == 0), "The element count of a ring buffer must be a power of two!");
+
+		static constexpr UI64 Mask = ElementCount - 1;
+
+	public:
+		RingBuffer() = default;
+		~RingBuffer() {}
+
+		RingBuffer(const RingBuffer&) = delete;
+		RingBuffer& operator=(const RingBuffer&) = delete;
+
+		/**
+		 * Push an element to the buffer (producer only).
+		 * This method returns true if inserted successfully. Returns false if the buffer is full.
+		 *
+		 * @param data: The data to be added.
+		 * @return Boolean value.
+		 */
+		bool TryPush(const Type& data)
+		{
+			const UI64 head = mHead.load(std::memory_order_relaxed);
+			if (!HasSpace(head, 1))
+				return false;
+
+			mEntries[head & Mask] = data;
+			mHead.store(head + 1, std::memory_order_release);
+			return true;
+		}
+
+		/**
+		 * Push an element to the buffer (producer only).
+		 * This method returns true if inserted successfully. Returns false if the buffer is full.
+		 *
+		 * @param data: The data to be added.
+		 * @return Boolean value.
+		 */
+		bool TryPush(Type&& data)
+		{
+			const UI64 head = mHead.load(std::memory_order_relaxed);
+			if (!HasSpace(head, 1))
+				return false;
+
+			mEntries[head & Mask] = std::move(data);
+			mHead.store(head + 1, std::memory_order_release);
+			return true;
+		}
+
+		/**
+		 * Push a range of elements to the buffer (producer only).
+		 * Either all the elements are inserted or none of them.
+		 *
+		 * @param pData: The elements to be added.
+		 * @param count: The number of elements.
+		 * @return Boolean value.
+		 */
+		bool TryPush(const Type* pData, UI64 count)
+		{
+			const UI64 head = mHead.load(std::memory_order_relaxed);
+			if (!HasSpace(head, count))
+				return false;
+
+			const UI64 index = head & Mask;
+			const UI64 firstCount = std::min(count, ElementCount - index);
+			std::copy(pData, pData + firstCount, mEntries + index);
+			std::copy(pData + firstCount, pData + count, mEntries);
+
+			mHead.store(head + count, std::memory_order_release);
+			return true;
+		}
+
+		/**
+		 * Reserve the next slot to construct an element in place (producer only).
+		 * The element becomes visible to the consumer once Commit() is called.
+		 *
+		 * @return The slot pointer. nullptr if the buffer is full.
+		 */
+		Type* TryReserve()
+		{
+			const UI64 head = mHead.load(std::memory_order_relaxed);
+			if (!HasSpace(head, 1))
+				return nullptr;
+
+			return &mEntries[head & Mask];
+		}
+
+		/**
+		 * Publish the slot returned by TryReserve() (producer only).
+		 */
+		void Commit()
+		{
+			mHead.store(mHead.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+		}
+
+		/**
+		 * Check if a number of elements can be pushed without blocking (producer only).
+		 * The consumer can only free more space, so a true result stays valid.
+		 *
+		 * @param count: The number of elements.
+		 * @return Boolean value.
+		 */
+		bool CanPush(UI64 count)
+		{
+			return HasSpace(mHead.load(std::memory_order_relaxed), count);
+		}
+
+		/**
+		 * Get and remove the first element (consumer only).
+		 * This method returns true if an element was popped. Returns false if the buffer is empty.
+		 *
+		 * @param data: The variable to move the element to.
+		 * @return Boolean value.
+		 */
+		bool TryPop(Type& data)
+		{
+			Type* pFront = Front();
+			if (!pFront)
+				return false;
+
+			data = std::move(*pFront);
+			Pop();
+			return true;
+		}
+
+		/**
+		 * Get the first element without removing it (consumer only).
+		 *
+		 * @return The element pointer. nullptr if the buffer is empty.
+		 */
+		Type* Front()
+		{
+			const UI64 tail = mTail.load(std::memory_order_relaxed);
+			if (tail == mCachedHead)
+			{
+				mCachedHead = mHead.load(std::memory_order_acquire);
+				if (tail == mCachedHead)
+					return nullptr;
+			}
+
+			return &mEntries[tail & Mask];
+		}
+
+		/**
+		 * Remove the element returned by Front() (consumer only).
+		 */
+		void Pop()
+		{
+			mTail.store(mTail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+		}
+
+		/**
+		 * Get the longest contiguous range of elements starting at the front (consumer only).
+		 * Elements which wrap around the end of the buffer are returned by the next call.
+		 *
+		 * @param count: The variable to store the number of elements in the range.
+		 * @return The first element pointer. nullptr if the buffer is empty.
+		 */
+		Type* FrontRange(UI64& count)
+		{
+			const UI64 tail = mTail.load(std::memory_order_relaxed);
+			mCachedHead = mHead.load(std::memory_order_acquire);
+
+			const UI64 index = tail & Mask;
+			count = std::min(mCachedHead - tail, ElementCount - index);
+			return count ? &mEntries[index] : nullptr;
+		}
+
+		/**
+		 * Remove a number of elements from the front (consumer only).
+		 *
+		 * @param count: The number of elements. This must not exceed the number of stored elements.
+		 */
+		void Pop(UI64 count)
+		{
+			mTail.store(mTail.load(std::memory_order_relaxed) + count, std::memory_order_release);
+		}
+
+		/**
+		 * Get the number of elements stored.
+		 * The value is only a snapshot when called while the other side is active.
+		 *
+		 * @return The number of elements.
+		 */
+		UI64 Size() const
+		{
+			return mHead.load(std::memory_order_acquire) - mTail.load(std::memory_order_acquire);
+		}
+
+		/**
+		 * Check if the buffer is empty.
+		 *
+		 * @return Boolean value.
+		 */
+		bool Empty() const { return Size() == 0; }
+
+		/**
+		 * Get the maximum number of elements which can be stored.
+		 *
+		 * @return The capacity.
+		 */
+		static constexpr UI64 Capacity() { return ElementCount; }
+
+	private:
+		/**
+		 * Check if there is space for a number of elements.
+		 *
+		 * @param head: The current head index.
+		 * @param count: The number of elements.
+		 * @return Boolean value.
+		 */
+		bool HasSpace(UI64 head, UI64 count)
+		{
+			if (head + count - mCachedTail > ElementCount)
+			{
+				mCachedTail = mTail.load(std::memory_order_acquire);
+				if (head + count - mCachedTail > ElementCount)
+					return false;
+			}
+
+			return true;
+		}
+
+		alignas(DMK_CACHE_LINE_SIZE) std::atomic<UI64> mHead = { 0 };	// Next slot to write. Written by the producer.
+		UI64 mCachedTail = 0;	// Producer's copy of the tail.
+
+		alignas(DMK_CACHE_LINE_SIZE) std::atomic<UI64> mTail = { 0 };	// Next slot to read. Written by the consumer.
+		UI64 mCachedHead = 0;	// Consumer's copy of the head.
+
+		alignas(DMK_CACHE_LINE_SIZE) Type mEntries[ElementCount] = {};	// The elements.
+	};
+}
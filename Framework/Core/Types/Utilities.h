@@ -44,7 +44,7 @@ namespace DMK
 	template<class Derived, class Base>
 	DMK_FORCEINLINE constexpr Derived InheritCast(Base* pBase)
 	{
-		return dynamic_cast<Derivev*>(pBase);
+		return *dynamic_cast<Derived*>(pBase);
 	}
 
 	/**
@@ -4,6 +4,8 @@
 #pragma once
 
 #include "Thread/Commands/CommandQueue.h"
+#include "Core/Benchmark/LatencyRecorder.h"
+#include "GraphicsCore/Backend/BackendAdapter.h"
 
 namespace DMK
 {
@@ -18,6 +20,7 @@ namespace DMK
 			VULKAN,
 			DIRECT_X_12,
 			WEB_GPU,
+			NULL_BACKEND,	// Accepts all work without a GPU. Used to profile and test the engine side CPU cost.
 		};
 
 		/**
@@ -63,6 +66,13 @@ namespace DMK
 			 */
 			Thread::CommandQueue<THREAD_MAX_COMMAND_COUNT>* GetCommandQueue() { return &mCommandQueue; }
 
+			/**
+			 * Get the backend adapter.
+			 *
+			 * @return GraphicsCore::BackendAdapter pointer. nullptr if the backend does not use an adapter.
+			 */
+			BackendAdapter* GetBackendAdapter() const { return pBackendAdapter.get(); }
+
 			/**
 			 * Issue a command to the engine. This command will directly be passed to the backend.
 			 *
@@ -73,9 +83,24 @@ namespace DMK
 			template<class Type>
 			void IssueCommand(const Type& initializer = Type(), Thread::CommandState* pState = nullptr)
 			{
+				Benchmark::LatencyScope _latencyScope(*pIssueCommandLatency);
 				GetCommandQueue()->PushCommand(initializer, pState);
 			}
 
+			/**
+			 * Issue a command to the engine and get its future. This command will directly be passed to the backend.
+			 *
+			 * @tparam Type: The type of the command.
+			 * @param initializer: The initialization values. Default is Type().
+			 * @return The future of the command.
+			 */
+			template<class Type>
+			Thread::CommandFuture<Thread::CommandResult<Type>> IssueCommandAsync(const Type& initializer = Type())
+			{
+				Benchmark::LatencyScope _latencyScope(*pIssueCommandLatency);
+				return GetCommandQueue()->PushCommandAsync(initializer);
+			}
+
 			/**
 			 * Initialize the Graphics Backend.
 			 *
@@ -91,6 +116,9 @@ namespace DMK
 		private:
 			std::thread mBackendThread;	// Backend thread object.
 			Thread::CommandQueue<THREAD_MAX_COMMAND_COUNT> mCommandQueue;	// Backend command queue.
+			std::unique_ptr<BackendAdapter> pBackendAdapter = nullptr;	// Backend adapter.
+
+			Benchmark::LatencyRecorder* pIssueCommandLatency = &Benchmark::Metrics::GetLatencyRecorder("Graphics.IssueCommand");	// Time taken to issue a command.
 		};
 	}
 }
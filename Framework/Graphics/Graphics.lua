@@ -40,4 +40,5 @@ project "Graphics"
 
 	links { 
 		"VulkanBackend",
+		"NullBackend",
 	}
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #include "Graphics/Engine.h"
 #include "Core/ErrorHandler/Logger.h"
+#include "NullBackend/NullBackendAdapter.h"
 //#include "VulkanBackend/VulkanBackendFunction.h"
 
 //#include "GraphicsCore/Commands/CoreCommands.h"
@@ -26,6 +27,11 @@ namespace DMK
 			case DMK::GraphicsCore::GraphicsBackendAPI::WEB_GPU:
 				break;
 
+			case DMK::GraphicsCore::GraphicsBackendAPI::NULL_BACKEND:
+				pBackendAdapter = std::make_unique<NullBackend::NullBackendAdapter>();
+				pBackendAdapter->Initialize(initInfo.enableValidation);
+				break;
+
 			default:
 				DMK_LOG_ERROR(TEXT("Invalid Graphics Backend API type!"));
 				break;
@@ -40,7 +46,14 @@ namespace DMK
 		void Engine::Terminate()
 		{
 			//GetCommandQueue()->PushCommand<GraphicsCore::Commands::TerminateBackend>();
-			mBackendThread.join();
+			if (mBackendThread.joinable())
+				mBackendThread.join();
+
+			if (pBackendAdapter)
+			{
+				pBackendAdapter->Terminate();
+				pBackendAdapter.reset();
+			}
 		}
 	}
 }
\ No newline at end of file
@@ -4,16 +4,33 @@
 #pragma once
 
 #include "Handles.h"
+#include "RenderTarget.h"
 #include "Inputs/InputCenter.h"
 
 namespace DMK
 {
 	namespace GraphicsCore
 	{
+		/**
+		 * Buffer Type enum.
+		 * This defines how a buffer created by a backend is used.
+		 */
+		enum class BufferType : UI8 {
+			UNDEFINED,
+			VERTEX,
+			INDEX,
+			UNIFORM,
+			STORAGE,
+			STAGING,
+		};
+
 		/**
 		 * Backend Adapter class.
 		 * This is the base class for the backend and is responsible of creating the necessary backend objects,
 		 * handling them and destroying them.
+		 *
+		 * Every method has a default which does nothing and returns an invalid handle, so a backend only overrides
+		 * what it supports.
 		 */
 		class BackendAdapter {
 		public:
@@ -29,6 +46,84 @@ namespace DMK
 
 			virtual DeviceHandle CreateDevice(const DisplayHandle& displayHandle) { return DeviceHandle(); }
 			virtual void DestroyDevice(const DeviceHandle& handle) {}
+
+			/**
+			 * Create a render target.
+			 *
+			 * @param deviceHandle: The device to create the render target on.
+			 * @param type: The type of the render target.
+			 * @param extent: The extent of the render target area.
+			 * @param bufferCount: The number of frame buffers. Default is 0 (see RenderTarget::Initialize()).
+			 * @return The render target handle.
+			 */
+			virtual RenderTargetHandle CreateRenderTarget(const DeviceHandle& deviceHandle, RenderTargetType type, Vector2 extent, UI32 bufferCount = 0) { return RenderTargetHandle(); }
+			virtual void DestroyRenderTarget(const RenderTargetHandle& handle) {}
+
+			/**
+			 * Create a buffer.
+			 *
+			 * @param deviceHandle: The device to create the buffer on.
+			 * @param type: The type of the buffer.
+			 * @param size: The size of the buffer in bytes.
+			 * @return The buffer handle.
+			 */
+			virtual BufferHandle CreateBuffer(const DeviceHandle& deviceHandle, BufferType type, UI64 size) { return BufferHandle(); }
+
+			/**
+			 * Copy data to a buffer.
+			 *
+			 * @param handle: The buffer handle.
+			 * @param pData: The data to copy.
+			 * @param size: The number of bytes to copy.
+			 * @param offset: The offset in the buffer to copy to. Default is 0.
+			 */
+			virtual void CopyToBuffer(const BufferHandle& handle, const void* pData, UI64 size, UI64 offset = 0) {}
+
+			/**
+			 * Map a buffer to host memory, so it can be written directly.
+			 *
+			 * @param handle: The buffer handle.
+			 * @return The mapped memory. nullptr if the buffer cannot be mapped.
+			 */
+			virtual void* MapBuffer(const BufferHandle& handle) { return nullptr; }
+			virtual void UnmapBuffer(const BufferHandle& handle) {}
+			virtual void DestroyBuffer(const BufferHandle& handle) {}
+
+			/**
+			 * Create a command buffer which records draws to a render target.
+			 *
+			 * @param renderTargetHandle: The render target handle.
+			 * @return The command buffer handle.
+			 */
+			virtual CommandBuffer CreateCommandBuffer(const RenderTargetHandle& renderTargetHandle) { return CommandBuffer(); }
+
+			/**
+			 * Begin recording a command buffer. The commands recorded before are discarded.
+			 *
+			 * @param handle: The command buffer handle.
+			 */
+			virtual void BeginCommandBuffer(const CommandBuffer& handle) {}
+			virtual void BindVertexBuffer(const CommandBuffer& handle, const BufferHandle& bufferHandle, UI64 offset = 0) {}
+			virtual void BindIndexBuffer(const CommandBuffer& handle, const BufferHandle& bufferHandle, UI64 offset = 0) {}
+			virtual void BindUniformBuffer(const CommandBuffer& handle, const BufferHandle& bufferHandle, UI32 binding, UI64 offset = 0) {}
+			virtual void Draw(const CommandBuffer& handle, UI32 vertexCount, UI32 instanceCount = 1, UI32 firstVertex = 0, UI32 firstInstance = 0) {}
+			virtual void DrawIndexed(const CommandBuffer& handle, UI32 indexCount, UI32 instanceCount = 1, UI32 firstIndex = 0, I32 vertexOffset = 0, UI32 firstInstance = 0) {}
+			virtual void EndCommandBuffer(const CommandBuffer& handle) {}
+
+			/**
+			 * Submit a recorded command buffer for execution.
+			 *
+			 * @param handle: The command buffer handle.
+			 */
+			virtual void SubmitCommandBuffer(const CommandBuffer& handle) {}
+			virtual void DestroyCommandBuffer(const CommandBuffer& handle) {}
+
+			/**
+			 * Present the current frame of a screen bound render target to its display.
+			 *
+			 * @param renderTargetHandle: The render target handle.
+			 */
+			virtual void Present(const RenderTargetHandle& renderTargetHandle) {}
 		};
 	}
-}
\ No newline at end of file
+}
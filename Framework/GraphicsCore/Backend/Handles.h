@@ -53,5 +53,7 @@ namespace DMK
 		DMK_DEFINE_UI64_HANDLE(RenderTargetOS2D);
 		DMK_DEFINE_UI64_HANDLE(RenderTargetOS3D);
 		DMK_DEFINE_UI64_HANDLE(RenderTargetOSRT);
+		DMK_DEFINE_UI64_HANDLE(RenderTargetHandle);
+		DMK_DEFINE_UI64_HANDLE(BufferHandle);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,38 @@
+-- Copyright 2020 Dhiraj Wishal
+-- SPDX-License-Identifier: Apache-2.0
+
+---------- Null Backend project description ----------
+
+project "NullBackend"
+	kind "StaticLib"
+	language "C++"
+	systemversion "latest"
+	cppdialect "C++17"
+	staticruntime "On"
+
+	defines {
+		"DMK_INTERNAL"
+	}
+
+	targetdir "$(SolutionDir)Builds/Framework/Binaries/$(Configuration)-$(Platform)"
+	objdir "$(SolutionDir)Builds/Framework/Intermediate/$(Configuration)-$(Platform)/$(ProjectName)"
+
+	files {
+		"**.txt",
+		"**.cpp",
+		"**.h",
+		"**.lua",
+		"**.txt",
+		"**.md",
+	}
+
+	includedirs {
+		"$(SolutionDir)Framework/",
+	}
+
+	libdirs {
+	}
+
+	links { 
+		"GraphicsCore",
+	}
@@ -0,0 +1,300 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "GraphicsCore/Backend/BackendAdapter.h"
+
+#include <memory>
+#include <vector>
+
+namespace DMK
+{
+	namespace NullBackend
+	{
+		/**
+		 * Null Backend Statistics structure.
+		 * The object counts are the objects which exist now. The other counts add up from the initialization or
+		 * the last reset of the statistics.
+		 */
+		struct NullBackendStatistics {
+			UI64 mDisplayCount = 0;	// Number of displays.
+			UI64 mDeviceCount = 0;	// Number of devices.
+			UI64 mRenderTargetCount = 0;	// Number of render targets.
+			UI64 mBufferCount = 0;	// Number of buffers.
+			UI64 mBufferSize = 0;	// Total size of the buffers in bytes.
+			UI64 mCommandBufferCount = 0;	// Number of command buffers.
+
+			UI64 mCopyCount = 0;	// Number of copies to buffers.
+			UI64 mCopySize = 0;	// Bytes copied to buffers.
+			UI64 mMapCount = 0;	// Number of times buffers were mapped.
+			UI64 mBindCount = 0;	// Number of recorded buffer binds.
+			UI64 mDrawCount = 0;	// Number of recorded draws, indexed or not.
+			UI64 mVertexCount = 0;	// Vertices of the recorded non indexed draws, times their instance counts.
+			UI64 mIndexCount = 0;	// Indices of the recorded indexed draws, times their instance counts.
+			UI64 mSubmitCount = 0;	// Number of submitted command buffers.
+			UI64 mSubmittedDrawCount = 0;	// Number of draws in the submitted command buffers.
+			UI64 mPresentCount = 0;	// Number of presented frames.
+			UI64 mInvalidCallCount = 0;	// Number of calls with an invalid handle or argument.
+		};
+
+		namespace _Helpers
+		{
+			/**
+			 * Null Object Pool object.
+			 * This stores the objects of a type and hands out handles to them. A handle holds the slot index plus
+			 * one and the generation of the slot. Destroying an object increments the generation of its slot, so
+			 * a destroyed handle is not found even after its slot is reused. Objects do not move once created.
+			 */
+			template<class Type>
+			class NullObjectPool {
+				/**
+				 * Pool Slot structure.
+				 */
+				struct PoolSlot {
+					Type mObject = {};	// The object.
+					UI32 mGeneration = 0;	// Incremented when the object is destroyed.
+					bool bIsAlive = false;	// Whether the slot holds an object.
+				};
+
+			public:
+				NullObjectPool() {}
+				~NullObjectPool() {}
+
+				/**
+				 * Create an object.
+				 *
+				 * @return The handle data and the object, which is default constructed.
+				 */
+				std::pair<UI64, Type*> Create()
+				{
+					UI32 index = 0;
+					if (mFreeSlots.empty())
+					{
+						index = static_cast<UI32>(mSlots.size());
+						mSlots.emplace_back(new PoolSlot());
+					}
+					else
+					{
+						index = mFreeSlots.back();
+						mFreeSlots.pop_back();
+					}
+
+					PoolSlot& slot = *mSlots[index];
+					slot.bIsAlive = true;
+					mCount++;
+
+					return { (static_cast<UI64>(slot.mGeneration) << 32) | (static_cast<UI64>(index) + 1), &slot.mObject };
+				}
+
+				/**
+				 * Find an object.
+				 *
+				 * @param handle: The handle data.
+				 * @return The object pointer. nullptr if the handle is invalid or destroyed.
+				 */
+				Type* Find(UI64 handle)
+				{
+					const UI64 index = (handle & 0xFFFFFFFF) - 1;
+					if (index >= mSlots.size())
+						return nullptr;
+
+					PoolSlot& slot = *mSlots[index];
+					return slot.bIsAlive && slot.mGeneration == static_cast<UI32>(handle >> 32) ? &slot.mObject : nullptr;
+				}
+
+				/**
+				 * Destroy an object.
+				 *
+				 * @param handle: The handle data.
+				 * @return Boolean value stating whether the handle was valid.
+				 */
+				bool Destroy(UI64 handle)
+				{
+					if (!Find(handle))
+						return false;
+
+					const UI32 index = static_cast<UI32>((handle & 0xFFFFFFFF) - 1);
+					PoolSlot& slot = *mSlots[index];
+					slot.mObject = Type();
+					slot.mGeneration++;
+					slot.bIsAlive = false;
+
+					mFreeSlots.push_back(index);
+					mCount--;
+					return true;
+				}
+
+				/**
+				 * Destroy every object.
+				 */
+				void Clear()
+				{
+					for (UI32 index = 0; index < mSlots.size(); index++)
+						if (mSlots[index]->bIsAlive)
+							Destroy((static_cast<UI64>(mSlots[index]->mGeneration) << 32) | (static_cast<UI64>(index) + 1));
+				}
+
+				/**
+				 * Get the number of objects.
+				 *
+				 * @return The object count.
+				 */
+				UI64 Count() const { return mCount; }
+
+			private:
+				std::vector<std::unique_ptr<PoolSlot>> mSlots;	// The slots. Each is allocated on its own, so objects stay in place as the vector grows.
+				std::vector<UI32> mFreeSlots;	// Indexes of the slots which do not hold an object.
+				UI64 mCount = 0;	// Number of objects.
+			};
+		}
+
+		/**
+		 * Null Backend Adapter.
+		 * This backend accepts all the work a backend is given without a GPU. It returns valid handles, keeps the
+		 * objects it is asked to create, counts the calls and the sizes of the work, and checks that the handles it
+		 * is given exist. This lets the engine side CPU cost (scene traversal, command generation, uniform packing)
+		 * be profiled and tested on machines which have no GPU.
+		 *
+		 * Buffers are backed by host memory, so data copied to them and written to their mapped memory costs what
+		 * writing to mapped GPU memory would. Handles carry a generation, so a destroyed handle is detected.
+		 *
+		 * If validation is enabled, invalid calls are logged as well as counted.
+		 *
+		 * Like the other backends, this object belongs to the backend thread and is not thread safe.
+		 */
+		class NullBackendAdapter final : public GraphicsCore::BackendAdapter {
+			/**
+			 * Null Display structure.
+			 */
+			struct NullDisplay {
+				Inputs::InputCenter mInputCenter = {};	// Input center of the display.
+				UI32 mWidth = 0;	// The display width.
+				UI32 mHeight = 0;	// The display height.
+			};
+
+			/**
+			 * Null Render Target structure.
+			 */
+			struct NullRenderTarget {
+				Vector2 mExtent = Vector2::ZeroAll;	// The extent of the render target area.
+				UI32 mBufferCount = 0;	// The number of frame buffers.
+				GraphicsCore::RenderTargetType mType = GraphicsCore::RenderTargetType::UNDEFINED;	// The render target type.
+			};
+
+			/**
+			 * Null Buffer structure.
+			 */
+			struct NullBuffer {
+				std::unique_ptr<BYTE[]> pMemory = nullptr;	// Host memory of the buffer.
+				UI64 mSize = 0;	// The buffer size in bytes.
+				GraphicsCore::BufferType mType = GraphicsCore::BufferType::UNDEFINED;	// The buffer type.
+				bool bIsMapped = false;	// Whether the buffer is mapped.
+			};
+
+			/**
+			 * Null Device structure.
+			 */
+			struct NullDevice {
+				GraphicsCore::DisplayHandle mDisplay = {};	// The display of the device.
+			};
+
+			/**
+			 * Null Command Buffer structure.
+			 */
+			struct NullCommandBuffer {
+				UI64 mDrawCount = 0;	// Number of draws recorded since the recording began.
+				bool bIsRecording = false;	// Whether the command buffer is being recorded.
+			};
+
+		public:
+			NullBackendAdapter() {}
+			~NullBackendAdapter() {}
+
+			virtual void Initialize(bool enableValidation = true) override final;
+			virtual void Terminate() override final;
+
+			virtual GraphicsCore::DisplayHandle CreateDisplay(UI32 width, UI32 height, const char* pTitle = "Dynamik Engine") override final;
+			virtual Inputs::InputCenter* GetDisplayInputCenter(const GraphicsCore::DisplayHandle& displayHandle) override final;
+			virtual void DestroyDisplay(const GraphicsCore::DisplayHandle& handle) override final;
+
+			virtual GraphicsCore::DeviceHandle CreateDevice(const GraphicsCore::DisplayHandle& displayHandle) override final;
+			virtual void DestroyDevice(const GraphicsCore::DeviceHandle& handle) override final;
+
+			virtual GraphicsCore::RenderTargetHandle CreateRenderTarget(const GraphicsCore::DeviceHandle& deviceHandle, GraphicsCore::RenderTargetType type, Vector2 extent, UI32 bufferCount = 0) override final;
+			virtual void DestroyRenderTarget(const GraphicsCore::RenderTargetHandle& handle) override final;
+
+			virtual GraphicsCore::BufferHandle CreateBuffer(const GraphicsCore::DeviceHandle& deviceHandle, GraphicsCore::BufferType type, UI64 size) override final;
+			virtual void CopyToBuffer(const GraphicsCore::BufferHandle& handle, const void* pData, UI64 size, UI64 offset = 0) override final;
+			virtual void* MapBuffer(const GraphicsCore::BufferHandle& handle) override final;
+			virtual void UnmapBuffer(const GraphicsCore::BufferHandle& handle) override final;
+			virtual void DestroyBuffer(const GraphicsCore::BufferHandle& handle) override final;
+
+			virtual GraphicsCore::CommandBuffer CreateCommandBuffer(const GraphicsCore::RenderTargetHandle& renderTargetHandle) override final;
+			virtual void BeginCommandBuffer(const GraphicsCore::CommandBuffer& handle) override final;
+			virtual void BindVertexBuffer(const GraphicsCore::CommandBuffer& handle, const GraphicsCore::BufferHandle& bufferHandle, UI64 offset = 0) override final;
+			virtual void BindIndexBuffer(const GraphicsCore::CommandBuffer& handle, const GraphicsCore::BufferHandle& bufferHandle, UI64 offset = 0) override final;
+			virtual void BindUniformBuffer(const GraphicsCore::CommandBuffer& handle, const GraphicsCore::BufferHandle& bufferHandle, UI32 binding, UI64 offset = 0) override final;
+			virtual void Draw(const GraphicsCore::CommandBuffer& handle, UI32 vertexCount, UI32 instanceCount = 1, UI32 firstVertex = 0, UI32 firstInstance = 0) override final;
+			virtual void DrawIndexed(const GraphicsCore::CommandBuffer& handle, UI32 indexCount, UI32 instanceCount = 1, UI32 firstIndex = 0, I32 vertexOffset = 0, UI32 firstInstance = 0) override final;
+			virtual void EndCommandBuffer(const GraphicsCore::CommandBuffer& handle) override final;
+			virtual void SubmitCommandBuffer(const GraphicsCore::CommandBuffer& handle) override final;
+			virtual void DestroyCommandBuffer(const GraphicsCore::CommandBuffer& handle) override final;
+
+			virtual void Present(const GraphicsCore::RenderTargetHandle& renderTargetHandle) override final;
+
+		public:
+			/**
+			 * Get the statistics of the work the backend was given.
+			 *
+			 * @return The statistics.
+			 */
+			NullBackendStatistics GetStatistics() const;
+
+			/**
+			 * Reset the counts which add up. The object counts are kept.
+			 */
+			void ResetStatistics();
+
+		private:
+			/**
+			 * Find the object of a handle. An unknown handle is reported as an invalid call.
+			 */
+			template<class Type, class Handle>
+			Type* Find(_Helpers::NullObjectPool<Type>& objects, const Handle& handle, const wchar* pMessage)
+			{
+				Type* pObject = objects.Find(GetHandle(handle));
+				if (!pObject)
+					ReportInvalidCall(pMessage);
+
+				return pObject;
+			}
+
+			/**
+			 * Find a command buffer which is being recorded.
+			 */
+			NullCommandBuffer* FindRecording(const GraphicsCore::CommandBuffer& handle);
+
+			/**
+			 * Find a buffer to bind to a command buffer which is being recorded.
+			 */
+			bool RecordBind(const GraphicsCore::CommandBuffer& handle, const GraphicsCore::BufferHandle& bufferHandle, UI64 offset);
+
+			/**
+			 * Report an invalid call.
+			 */
+			void ReportInvalidCall(const wchar* pMessage);
+
+			_Helpers::NullObjectPool<NullDisplay> mDisplays;
+			_Helpers::NullObjectPool<NullDevice> mDevices;
+			_Helpers::NullObjectPool<NullRenderTarget> mRenderTargets;
+			_Helpers::NullObjectPool<NullBuffer> mBuffers;
+			_Helpers::NullObjectPool<NullCommandBuffer> mCommandBuffers;
+
+			NullBackendStatistics mStatistics = {};	// The counts which add up.
+			UI64 mBufferSize = 0;	// Total size of the buffers in bytes.
+
+			bool bEnableValidation = true;	// Whether invalid calls are logged.
+		};
+	}
+}
@@ -0,0 +1,305 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "NullBackend/NullBackendAdapter.h"
+#include "Core/ErrorHandler/Logger.h"
+
+#include <cstring>
+
+namespace DMK
+{
+	namespace NullBackend
+	{
+		void NullBackendAdapter::Initialize(bool enableValidation)
+		{
+			bEnableValidation = enableValidation;
+			ResetStatistics();
+		}
+
+		void NullBackendAdapter::Terminate()
+		{
+			mCommandBuffers.Clear();
+			mBuffers.Clear();
+			mRenderTargets.Clear();
+			mDevices.Clear();
+			mDisplays.Clear();
+
+			mBufferSize = 0;
+		}
+
+		GraphicsCore::DisplayHandle NullBackendAdapter::CreateDisplay(UI32 width, UI32 height, [[maybe_unused]] const char* pTitle)
+		{
+			const auto [handle, pDisplay] = mDisplays.Create();
+			pDisplay->mWidth = width;
+			pDisplay->mHeight = height;
+
+			return CreateHandle<GraphicsCore::DisplayHandle>(handle);
+		}
+
+		Inputs::InputCenter* NullBackendAdapter::GetDisplayInputCenter(const GraphicsCore::DisplayHandle& displayHandle)
+		{
+			NullDisplay* pDisplay = Find(mDisplays, displayHandle, TEXT("Null Backend: Invalid display handle!"));
+			return pDisplay ? &pDisplay->mInputCenter : nullptr;
+		}
+
+		void NullBackendAdapter::DestroyDisplay(const GraphicsCore::DisplayHandle& handle)
+		{
+			if (!mDisplays.Destroy(GetHandle(handle)))
+				ReportInvalidCall(TEXT("Null Backend: Destroying an invalid display handle!"));
+		}
+
+		GraphicsCore::DeviceHandle NullBackendAdapter::CreateDevice(const GraphicsCore::DisplayHandle& displayHandle)
+		{
+			if (!Find(mDisplays, displayHandle, TEXT("Null Backend: Creating a device on an invalid display handle!")))
+				return GraphicsCore::DeviceHandle();
+
+			const auto [handle, pDevice] = mDevices.Create();
+			pDevice->mDisplay = displayHandle;
+
+			return CreateHandle<GraphicsCore::DeviceHandle>(handle);
+		}
+
+		void NullBackendAdapter::DestroyDevice(const GraphicsCore::DeviceHandle& handle)
+		{
+			if (!mDevices.Destroy(GetHandle(handle)))
+				ReportInvalidCall(TEXT("Null Backend: Destroying an invalid device handle!"));
+		}
+
+		GraphicsCore::RenderTargetHandle NullBackendAdapter::CreateRenderTarget(const GraphicsCore::DeviceHandle& deviceHandle, GraphicsCore::RenderTargetType type, Vector2 extent, UI32 bufferCount)
+		{
+			if (!Find(mDevices, deviceHandle, TEXT("Null Backend: Creating a render target on an invalid device handle!")))
+				return GraphicsCore::RenderTargetHandle();
+
+			const auto [handle, pRenderTarget] = mRenderTargets.Create();
+			pRenderTarget->mExtent = extent;
+			pRenderTarget->mBufferCount = bufferCount;
+			pRenderTarget->mType = type;
+
+			return CreateHandle<GraphicsCore::RenderTargetHandle>(handle);
+		}
+
+		void NullBackendAdapter::DestroyRenderTarget(const GraphicsCore::RenderTargetHandle& handle)
+		{
+			if (!mRenderTargets.Destroy(GetHandle(handle)))
+				ReportInvalidCall(TEXT("Null Backend: Destroying an invalid render target handle!"));
+		}
+
+		GraphicsCore::BufferHandle NullBackendAdapter::CreateBuffer(const GraphicsCore::DeviceHandle& deviceHandle, GraphicsCore::BufferType type, UI64 size)
+		{
+			if (!Find(mDevices, deviceHandle, TEXT("Null Backend: Creating a buffer on an invalid device handle!")))
+				return GraphicsCore::BufferHandle();
+
+			const auto [handle, pBuffer] = mBuffers.Create();
+
+			// The memory is not cleared, like the memory of a new GPU buffer.
+			pBuffer->pMemory.reset(new BYTE[size ? size : 1]);
+			pBuffer->mSize = size;
+			pBuffer->mType = type;
+
+			mBufferSize += size;
+			return CreateHandle<GraphicsCore::BufferHandle>(handle);
+		}
+
+		void NullBackendAdapter::CopyToBuffer(const GraphicsCore::BufferHandle& handle, const void* pData, UI64 size, UI64 offset)
+		{
+			NullBuffer* pBuffer = Find(mBuffers, handle, TEXT("Null Backend: Copying to an invalid buffer handle!"));
+			if (!pBuffer)
+				return;
+
+			if (offset > pBuffer->mSize || size > pBuffer->mSize - offset)
+				return ReportInvalidCall(TEXT("Null Backend: Copying outside of the buffer!"));
+
+			std::memcpy(pBuffer->pMemory.get() + offset, pData, size);
+
+			mStatistics.mCopyCount++;
+			mStatistics.mCopySize += size;
+		}
+
+		void* NullBackendAdapter::MapBuffer(const GraphicsCore::BufferHandle& handle)
+		{
+			NullBuffer* pBuffer = Find(mBuffers, handle, TEXT("Null Backend: Mapping an invalid buffer handle!"));
+			if (!pBuffer)
+				return nullptr;
+
+			if (pBuffer->bIsMapped)
+				ReportInvalidCall(TEXT("Null Backend: Mapping a buffer which is already mapped!"));
+
+			pBuffer->bIsMapped = true;
+			mStatistics.mMapCount++;
+
+			return pBuffer->pMemory.get();
+		}
+
+		void NullBackendAdapter::UnmapBuffer(const GraphicsCore::BufferHandle& handle)
+		{
+			NullBuffer* pBuffer = Find(mBuffers, handle, TEXT("Null Backend: Unmapping an invalid buffer handle!"));
+			if (!pBuffer)
+				return;
+
+			if (!pBuffer->bIsMapped)
+				ReportInvalidCall(TEXT("Null Backend: Unmapping a buffer which is not mapped!"));
+
+			pBuffer->bIsMapped = false;
+		}
+
+		void NullBackendAdapter::DestroyBuffer(const GraphicsCore::BufferHandle& handle)
+		{
+			NullBuffer* pBuffer = Find(mBuffers, handle, TEXT("Null Backend: Destroying an invalid buffer handle!"));
+			if (!pBuffer)
+				return;
+
+			mBufferSize -= pBuffer->mSize;
+			mBuffers.Destroy(GetHandle(handle));
+		}
+
+		GraphicsCore::CommandBuffer NullBackendAdapter::CreateCommandBuffer(const GraphicsCore::RenderTargetHandle& renderTargetHandle)
+		{
+			if (!Find(mRenderTargets, renderTargetHandle, TEXT("Null Backend: Creating a command buffer for an invalid render target handle!")))
+				return GraphicsCore::CommandBuffer();
+
+			return CreateHandle<GraphicsCore::CommandBuffer>(mCommandBuffers.Create().first);
+		}
+
+		void NullBackendAdapter::BeginCommandBuffer(const GraphicsCore::CommandBuffer& handle)
+		{
+			NullCommandBuffer* pCommandBuffer = Find(mCommandBuffers, handle, TEXT("Null Backend: Beginning an invalid command buffer handle!"));
+			if (!pCommandBuffer)
+				return;
+
+			if (pCommandBuffer->bIsRecording)
+				ReportInvalidCall(TEXT("Null Backend: Beginning a command buffer which is being recorded!"));
+
+			pCommandBuffer->mDrawCount = 0;
+			pCommandBuffer->bIsRecording = true;
+		}
+
+		void NullBackendAdapter::BindVertexBuffer(const GraphicsCore::CommandBuffer& handle, const GraphicsCore::BufferHandle& bufferHandle, UI64 offset)
+		{
+			RecordBind(handle, bufferHandle, offset);
+		}
+
+		void NullBackendAdapter::BindIndexBuffer(const GraphicsCore::CommandBuffer& handle, const GraphicsCore::BufferHandle& bufferHandle, UI64 offset)
+		{
+			RecordBind(handle, bufferHandle, offset);
+		}
+
+		void NullBackendAdapter::BindUniformBuffer(const GraphicsCore::CommandBuffer& handle, const GraphicsCore::BufferHandle& bufferHandle, [[maybe_unused]] UI32 binding, UI64 offset)
+		{
+			RecordBind(handle, bufferHandle, offset);
+		}
+
+		void NullBackendAdapter::Draw(const GraphicsCore::CommandBuffer& handle, UI32 vertexCount, UI32 instanceCount, [[maybe_unused]] UI32 firstVertex, [[maybe_unused]] UI32 firstInstance)
+		{
+			NullCommandBuffer* pCommandBuffer = FindRecording(handle);
+			if (!pCommandBuffer)
+				return;
+
+			pCommandBuffer->mDrawCount++;
+			mStatistics.mDrawCount++;
+			mStatistics.mVertexCount += static_cast<UI64>(vertexCount) * instanceCount;
+		}
+
+		void NullBackendAdapter::DrawIndexed(const GraphicsCore::CommandBuffer& handle, UI32 indexCount, UI32 instanceCount, [[maybe_unused]] UI32 firstIndex, [[maybe_unused]] I32 vertexOffset, [[maybe_unused]] UI32 firstInstance)
+		{
+			NullCommandBuffer* pCommandBuffer = FindRecording(handle);
+			if (!pCommandBuffer)
+				return;
+
+			pCommandBuffer->mDrawCount++;
+			mStatistics.mDrawCount++;
+			mStatistics.mIndexCount += static_cast<UI64>(indexCount) * instanceCount;
+		}
+
+		void NullBackendAdapter::EndCommandBuffer(const GraphicsCore::CommandBuffer& handle)
+		{
+			NullCommandBuffer* pCommandBuffer = FindRecording(handle);
+			if (pCommandBuffer)
+				pCommandBuffer->bIsRecording = false;
+		}
+
+		void NullBackendAdapter::SubmitCommandBuffer(const GraphicsCore::CommandBuffer& handle)
+		{
+			NullCommandBuffer* pCommandBuffer = Find(mCommandBuffers, handle, TEXT("Null Backend: Submitting an invalid command buffer handle!"));
+			if (!pCommandBuffer)
+				return;
+
+			if (pCommandBuffer->bIsRecording)
+				return ReportInvalidCall(TEXT("Null Backend: Submitting a command buffer which is being recorded!"));
+
+			mStatistics.mSubmitCount++;
+			mStatistics.mSubmittedDrawCount += pCommandBuffer->mDrawCount;
+		}
+
+		void NullBackendAdapter::DestroyCommandBuffer(const GraphicsCore::CommandBuffer& handle)
+		{
+			if (!mCommandBuffers.Destroy(GetHandle(handle)))
+				ReportInvalidCall(TEXT("Null Backend: Destroying an invalid command buffer handle!"));
+		}
+
+		void NullBackendAdapter::Present(const GraphicsCore::RenderTargetHandle& renderTargetHandle)
+		{
+			if (Find(mRenderTargets, renderTargetHandle, TEXT("Null Backend: Presenting an invalid render target handle!")))
+				mStatistics.mPresentCount++;
+		}
+
+		NullBackendStatistics NullBackendAdapter::GetStatistics() const
+		{
+			NullBackendStatistics statistics = mStatistics;
+			statistics.mDisplayCount = mDisplays.Count();
+			statistics.mDeviceCount = mDevices.Count();
+			statistics.mRenderTargetCount = mRenderTargets.Count();
+			statistics.mBufferCount = mBuffers.Count();
+			statistics.mBufferSize = mBufferSize;
+			statistics.mCommandBufferCount = mCommandBuffers.Count();
+
+			return statistics;
+		}
+
+		void NullBackendAdapter::ResetStatistics()
+		{
+			mStatistics = NullBackendStatistics();
+		}
+
+		NullBackendAdapter::NullCommandBuffer* NullBackendAdapter::FindRecording(const GraphicsCore::CommandBuffer& handle)
+		{
+			NullCommandBuffer* pCommandBuffer = Find(mCommandBuffers, handle, TEXT("Null Backend: Recording to an invalid command buffer handle!"));
+			if (pCommandBuffer && !pCommandBuffer->bIsRecording)
+			{
+				ReportInvalidCall(TEXT("Null Backend: Recording to a command buffer which did not begin!"));
+				return nullptr;
+			}
+
+			return pCommandBuffer;
+		}
+
+		bool NullBackendAdapter::RecordBind(const GraphicsCore::CommandBuffer& handle, const GraphicsCore::BufferHandle& bufferHandle, UI64 offset)
+		{
+			if (!FindRecording(handle))
+				return false;
+
+			NullBuffer* pBuffer = Find(mBuffers, bufferHandle, TEXT("Null Backend: Binding an invalid buffer handle!"));
+			if (!pBuffer)
+				return false;
+
+			if (offset > pBuffer->mSize)
+			{
+				ReportInvalidCall(TEXT("Null Backend: Binding a buffer at an offset outside of it!"));
+				return false;
+			}
+
+			mStatistics.mBindCount++;
+			return true;
+		}
+
+		void NullBackendAdapter::ReportInvalidCall([[maybe_unused]] const wchar* pMessage)
+		{
+			mStatistics.mInvalidCallCount++;
+
+			// The log macros are empty when logging is disabled.
+			if (bEnableValidation)
+			{
+				DMK_LOG_ERROR(pMessage);
+			}
+		}
+	}
+}
@@ -5,6 +5,8 @@
 
 #include "Core/Types/DataTypes.h"
 #include "Core/Macros/Global.h"
+#include "Core/Hash/CompileTimeHash.h"
+#include "CommandCompletion.h"
 
 #include <mutex>
 
@@ -14,25 +16,21 @@ namespace DMK
 	{
 		template<class Type> class Command;
 
-		/**
-		 * Command State enum.
-		 * This defines the states of a given command.
-		 */
-		enum class CommandState : UI8 {
-			PENDING,		// Command is waiting in the queue.
-			EXECUTING,	// Command is being executed.
-			SUCCESS,		// Command execution was successful.
-			FAILED,		// Command execution failed.
-			INVALID		// Invalid command was passed.
-		};
-
 		/**
 		 * Base bject for the commands.
 		 */
 		class CommandBase {
 		public:
-			CommandBase(CommandState* pCommandState = nullptr) : pComandState(pCommandState) {}
-			virtual ~CommandBase() {}
+			CommandBase(UI64 commandID = 0, CommandState* pCommandState = nullptr) : mCommandID(commandID), pComandState(pCommandState) {}
+
+			/**
+			 * A command which is destroyed without being executed completes its futures as invalid.
+			 */
+			virtual ~CommandBase()
+			{
+				if (pCompletion && !pCompletion->IsReady())
+					pCompletion->SetState(CommandState::INVALID);
+			}
 
 			/**
 			 * Get the command type name.
@@ -41,14 +39,24 @@ namespace DMK
 			 */
 			virtual const char* GetCommandName() const { return nullptr; }
 
+			/**
+			 * Get the command type ID.
+			 * This is a compile time constant (TypeId<Type>()) and can be used to dispatch commands using a switch
+			 * or a CommandDispatcher.
+			 *
+			 * @return The ID as UI64.
+			 */
+			UI64 GetCommandID() const { return mCommandID; }
+
 			/**
 			 * Cast and get the command as the derived type.
+			 * This does not check the type. The command ID must be TypeId<Type>().
 			 *
 			 * @tparam Type: The type of the command.
 			 * @return The Command<Type> pointer.
 			 */
 			template<class Type>
-			constexpr Command<Type>* Derived() { return dynamic_cast<Command<Type>*>(this); }
+			constexpr Command<Type>* Derived() { return static_cast<Command<Type>*>(this); }
 
 			/**
 			 * Get the data stored in the command.
@@ -80,9 +88,18 @@ namespace DMK
 			 *
 			 * @param state: The state of the command.
 			 */
-			void SetState(CommandState state) { if (pComandState) *pComandState = state; }
+			void SetState(CommandState state)
+			{
+				if (pComandState)
+					*pComandState = state;
+
+				if (pCompletion)
+					pCompletion->SetState(state);
+			}
 
+			UI64 mCommandID = 0;	// Command type ID.
 			CommandState* pComandState = nullptr;	// Command state pointer.
+			std::shared_ptr<CommandCompletion> pCompletion = nullptr;	// Completion shared with the futures of the command.
 		};
 
 		/**
@@ -98,7 +115,7 @@ namespace DMK
 			 *
 			 * @param pCommandState: The command state pointer. Default is nullptr.
 			 */
-			Command(CommandState* pCommandState = nullptr) : CommandBase(pCommandState) {}
+			Command(CommandState* pCommandState = nullptr) : CommandBase(TypeId<Type>(), pCommandState) {}
 
 			/**
 			 * Construct the command by providing the command data (copy).
@@ -107,7 +124,7 @@ namespace DMK
 			 * @param pCommandState: The command state pointer. Default is nullptr.
 			 */
 			Command(const Type& command, CommandState* pCommandState = nullptr)
-				: mData(command), CommandBase(pCommandState) {}
+				: mData(command), CommandBase(TypeId<Type>(), pCommandState) {}
 
 			/**
 			 * Construct the command by providing the command data (move).
@@ -116,11 +133,11 @@ namespace DMK
 			 * @param pCommandState: The command state pointer. Default is nullptr.
 			 */
 			Command(Type&& command, CommandState* pCommandState = nullptr)
-				: mData(std::move(command)), CommandBase(pCommandState) {}
+				: mData(std::move(command)), CommandBase(TypeId<Type>(), pCommandState) {}
 
 			~Command() {}
 
-			typedef typename Type Type;	// The type of the command.
+			using DataType = Type;	// The type of the command.
 
 			/**
 			 * Get the command type name.
@@ -164,6 +181,19 @@ namespace DMK
 			 */
 			virtual void* Data() const override final { return const_cast<Type*>(&mData); }
 
+			/**
+			 * Set the result of the command.
+			 * The result is passed to the futures of the command once its state is set to a final state. This
+			 * does nothing if the command was pushed without a future.
+			 *
+			 * @param result: The result.
+			 */
+			void SetResult(CommandResult<Type> result)
+			{
+				if (pCompletion)
+					static_cast<CommandResultCompletion<CommandResult<Type>>*>(pCompletion.get())->SetResult(std::move(result));
+			}
+
 		public:
 			/**
 			 * Get the data pointer.
@@ -0,0 +1,279 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Thread/Synchronization/WaitQueue.h"
+
+#include <functional>
+#include <memory>
+#include <type_traits>
+
+namespace DMK
+{
+	namespace Thread
+	{
+		/**
+		 * Command State enum.
+		 * This defines the states of a given command.
+		 */
+		enum class CommandState : UI8 {
+			PENDING,		// Command is waiting in the queue.
+			EXECUTING,	// Command is being executed.
+			SUCCESS,		// Command execution was successful.
+			FAILED,		// Command execution failed.
+			INVALID		// Invalid command was passed.
+		};
+
+		/**
+		 * Check if a command state is final, which is when the command has been executed or rejected.
+		 *
+		 * @param state: The command state.
+		 * @return Boolean value.
+		 */
+		constexpr bool IsFinalCommandState(CommandState state)
+		{
+			return state == CommandState::SUCCESS || state == CommandState::FAILED || state == CommandState::INVALID;
+		}
+
+		/**
+		 * No Result structure.
+		 * The result type of commands which do not return anything.
+		 */
+		struct NoResult {};
+
+		namespace _Helpers
+		{
+			/**
+			 * Command result type trait.
+			 * A command returns a result when its type declares it as "using Result = ...;".
+			 */
+			template<class Type, class = void>
+			struct CommandResultTrait {
+				using ResultType = NoResult;
+			};
+
+			template<class Type>
+			struct CommandResultTrait<Type, std::void_t<typename Type::Result>> {
+				using ResultType = typename Type::Result;
+			};
+		}
+
+		/**
+		 * The result type of a command type.
+		 *
+		 * @tparam Type: The command type.
+		 */
+		template<class Type>
+		using CommandResult = typename _Helpers::CommandResultTrait<Type>::ResultType;
+
+		/**
+		 * Command Completion object.
+		 * This is the state shared by a command and its futures. The backend sets the state of the command and
+		 * the futures read it. Reading the state is a single atomic load.
+		 *
+		 * Once the state becomes final, the waiting threads are woken and the continuations are called on the
+		 * thread which completed the command. Continuations are kept in a lock free list which is closed when
+		 * the command completes, so a continuation added afterwards is called immediately.
+		 */
+		class CommandCompletion : public std::enable_shared_from_this<CommandCompletion> {
+		public:
+			/**
+			 * Continuation function type. The argument is the completion itself.
+			 */
+			using ContinuationFunction = std::function<void(const std::shared_ptr<CommandCompletion>&)>;
+
+			CommandCompletion() {}
+
+			/**
+			 * Delete the continuations which were not called.
+			 */
+			virtual ~CommandCompletion()
+			{
+				Continuation* pContinuation = pContinuations.load(std::memory_order_acquire);
+				while (pContinuation && pContinuation != GetClosedMarker())
+				{
+					Continuation* pNext = pContinuation->pNext;
+					delete pContinuation;
+					pContinuation = pNext;
+				}
+			}
+
+			CommandCompletion(const CommandCompletion&) = delete;
+			CommandCompletion& operator=(const CommandCompletion&) = delete;
+
+			/**
+			 * Set the state of the command.
+			 * Setting a final state completes the command. Only the first final state is kept.
+			 *
+			 * @param state: The command state.
+			 */
+			void SetState(CommandState state)
+			{
+				if (IsReady())
+					return;
+
+				mState.store(state, std::memory_order_release);
+
+				if (IsFinalCommandState(state))
+					Complete();
+			}
+
+			/**
+			 * Get the state of the command.
+			 *
+			 * @return The command state.
+			 */
+			CommandState GetState() const { return mState.load(std::memory_order_acquire); }
+
+			/**
+			 * Check if the command has completed.
+			 *
+			 * @return Boolean value.
+			 */
+			bool IsReady() const { return IsFinalCommandState(GetState()); }
+
+			/**
+			 * Wait till the command completes.
+			 */
+			void Wait()
+			{
+				mWaitQueue.Wait([this] { return IsReady(); });
+			}
+
+			/**
+			 * Wait till the command completes or a timeout expires.
+			 *
+			 * @param timeout: The longest time to wait.
+			 * @return True if the command completed, false if the wait timed out.
+			 */
+			template<class Rep, class Period>
+			bool WaitFor(std::chrono::duration<Rep, Period> timeout)
+			{
+				return mWaitQueue.WaitFor([this] { return IsReady(); }, timeout);
+			}
+
+			/**
+			 * Add a continuation.
+			 * The continuation is called on the thread which completes the command, or immediately if the command
+			 * has already completed.
+			 *
+			 * @param function: The continuation function.
+			 */
+			void AddContinuation(ContinuationFunction&& function)
+			{
+				if (!TryAddContinuation(function))
+					function(shared_from_this());
+			}
+
+			/**
+			 * Add a continuation unless the command has already completed.
+			 * Unlike AddContinuation(), the continuation is never called by this function, so a caller which would
+			 * otherwise be re-entered can continue directly.
+			 *
+			 * @param function: The continuation function. It is left in place if it was not added.
+			 * @return False if the command has already completed.
+			 */
+			bool TryAddContinuation(ContinuationFunction& function)
+			{
+				Continuation* pContinuation = new Continuation{ std::move(function), nullptr };
+
+				Continuation* pHead = pContinuations.load(std::memory_order_acquire);
+				do {
+					if (pHead == GetClosedMarker())
+					{
+						function = std::move(pContinuation->mFunction);
+						delete pContinuation;
+						return false;
+					}
+
+					pContinuation->pNext = pHead;
+				} while (!pContinuations.compare_exchange_weak(pHead, pContinuation, std::memory_order_acq_rel, std::memory_order_acquire));
+
+				return true;
+			}
+
+		private:
+			/**
+			 * Continuation structure.
+			 */
+			struct Continuation {
+				ContinuationFunction mFunction;	// The continuation function.
+				Continuation* pNext = nullptr;	// The next continuation in the list.
+			};
+
+			/**
+			 * Get the marker which closes the continuation list.
+			 */
+			Continuation* GetClosedMarker() const
+			{
+				return reinterpret_cast<Continuation*>(const_cast<CommandCompletion*>(this));
+			}
+
+			/**
+			 * Wake the waiting threads and call the continuations in the order they were added.
+			 */
+			void Complete()
+			{
+				mWaitQueue.NotifyAll();
+
+				Continuation* pHead = pContinuations.exchange(GetClosedMarker(), std::memory_order_acq_rel);
+				if (pHead == GetClosedMarker() || !pHead)
+					return;
+
+				// The list is in reverse order.
+				Continuation* pReversed = nullptr;
+				while (pHead)
+				{
+					Continuation* pNext = pHead->pNext;
+					pHead->pNext = pReversed;
+					pReversed = pHead;
+					pHead = pNext;
+				}
+
+				const std::shared_ptr<CommandCompletion> pSelf = shared_from_this();
+				while (pReversed)
+				{
+					Continuation* pNext = pReversed->pNext;
+					pReversed->mFunction(pSelf);
+					delete pReversed;
+					pReversed = pNext;
+				}
+			}
+
+			std::atomic<CommandState> mState = { CommandState::PENDING };	// The command state.
+			std::atomic<Continuation*> pContinuations = { nullptr };	// Continuations, or the closed marker once completed.
+			WaitQueue mWaitQueue;	// Threads waiting for the command.
+		};
+
+		/**
+		 * Command Result Completion object.
+		 * The completion of a command which returns a result.
+		 *
+		 * @tparam Result: The result type.
+		 */
+		template<class Result>
+		class CommandResultCompletion : public CommandCompletion {
+		public:
+			CommandResultCompletion() {}
+			~CommandResultCompletion() {}
+
+			/**
+			 * Set the result. This must be done before the command completes.
+			 *
+			 * @param result: The result.
+			 */
+			void SetResult(Result result) { mResult = std::move(result); }
+
+			/**
+			 * Get the result.
+			 *
+			 * @return The result reference.
+			 */
+			const Result& GetResult() const { return mResult; }
+
+		private:
+			Result mResult = {};	// The result.
+		};
+	}
+}
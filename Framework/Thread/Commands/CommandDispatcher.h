@@ -0,0 +1,65 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Command.h"
+#include "CommandRegistry.h"
+
+namespace DMK
+{
+	namespace Thread
+	{
+		template<class Registry>
+		class CommandDispatcher;
+
+		/**
+		 * Command Dispatcher object.
+		 * The dispatcher builds a jump table with a handler call for every command type of a registry, and
+		 * dispatches a command by indexing it with the command's dense index. The command is cast with a
+		 * static_cast, as its type is known from its ID.
+		 *
+		 * A handler is an object with a call operator for every registered type, taking the Command<Type>
+		 * reference and returning whether the command succeeded. A missing overload is a compile error.
+		 *
+		 * Usage: Thread::CommandDispatcher<AudioCommands>::Dispatch(handler, pCommand);
+		 *
+		 * @tparam Types: The command types of the registry.
+		 */
+		template<class... Types>
+		class CommandDispatcher<CommandRegistry<Types...>> {
+			static_assert(sizeof...(Types), "The command registry is empty!");
+
+			/**
+			 * Call the handler with the command cast to its type.
+			 */
+			template<class Handler, class Type>
+			static bool Invoke(Handler& handler, CommandBase* pCommand)
+			{
+				return handler(*pCommand->Derived<Type>());
+			}
+
+		public:
+			/**
+			 * Dispatch a command to its handler.
+			 * The command is not deleted.
+			 *
+			 * @param handler: The handler object.
+			 * @param pCommand: The command to dispatch.
+			 * @return SUCCESS or FAILED, as reported by the handler. INVALID if the command type is not registered.
+			 */
+			template<class Handler>
+			static CommandState Dispatch(Handler& handler, CommandBase* pCommand)
+			{
+				using InvokeFunction = bool(*)(Handler&, CommandBase*);
+				static constexpr InvokeFunction JumpTable[] = { &Invoke<Handler, Types>... };
+
+				const UI32 index = CommandRegistry<Types...>::IndexOf(pCommand->GetCommandID());
+				if (index == InvalidCommandIndex)
+					return CommandState::INVALID;
+
+				return JumpTable[index](handler, pCommand) ? CommandState::SUCCESS : CommandState::FAILED;
+			}
+		};
+	}
+}
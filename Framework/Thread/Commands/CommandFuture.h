@@ -0,0 +1,198 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Command.h"
+#include "Thread/Jobs/JobSystem.h"
+
+namespace DMK
+{
+	namespace Thread
+	{
+		/**
+		 * Command Future object.
+		 * A future is returned when a command is pushed asynchronously. It reports the state of the command, waits
+		 * for it to complete, returns its result and runs continuations once it completes. Futures can be copied
+		 * and they all share the completion of the command.
+		 *
+		 * Usage:
+		 *	auto future = mCommandQueue.PushCommandAsync(LoadAudioFromFile{ "Music.wav" });
+		 *	future.Then(jobSystem, [](const auto& future) { Play(future.GetResult()); });
+		 *
+		 * @tparam Result: The result type of the command. Default is NoResult.
+		 */
+		template<class Result = NoResult>
+		class CommandFuture {
+		public:
+			using CompletionType = CommandResultCompletion<Result>;
+
+			CommandFuture() {}
+
+			/**
+			 * Construct the future using the completion of the command.
+			 *
+			 * @param pCompletion: The completion pointer.
+			 */
+			explicit CommandFuture(std::shared_ptr<CompletionType> pCompletion) : pCompletion(std::move(pCompletion)) {}
+
+			~CommandFuture() {}
+
+			/**
+			 * Check if the future belongs to a command.
+			 *
+			 * @return Boolean value.
+			 */
+			bool IsValid() const { return pCompletion != nullptr; }
+
+			/**
+			 * Check if the command has completed. This does not block.
+			 *
+			 * @return Boolean value.
+			 */
+			bool IsReady() const { return pCompletion->IsReady(); }
+
+			/**
+			 * Get the state of the command. This does not block.
+			 *
+			 * @return The command state.
+			 */
+			CommandState GetState() const { return pCompletion->GetState(); }
+
+			/**
+			 * Wait till the command completes.
+			 */
+			void Wait() const { pCompletion->Wait(); }
+
+			/**
+			 * Wait till the command completes or a timeout expires.
+			 *
+			 * @param timeout: The longest time to wait.
+			 * @return True if the command completed, false if the wait timed out.
+			 */
+			template<class Rep, class Period>
+			bool WaitFor(std::chrono::duration<Rep, Period> timeout) const { return pCompletion->WaitFor(timeout); }
+
+			/**
+			 * Wait till the command completes and get its result.
+			 * The result is only valid if the state is SUCCESS.
+			 *
+			 * @return The result reference.
+			 */
+			const Result& Get() const
+			{
+				Wait();
+				return pCompletion->GetResult();
+			}
+
+			/**
+			 * Get the result without waiting. The command must have completed.
+			 *
+			 * @return The result reference.
+			 */
+			const Result& GetResult() const { return pCompletion->GetResult(); }
+
+			/**
+			 * Run a function once the command completes.
+			 * The function is called on the thread which completes the command, which is usually a backend thread,
+			 * so it must be short. It is called immediately if the command has already completed.
+			 *
+			 * @param function: The function. It is called with a const reference to the future.
+			 */
+			template<class Function>
+			void Then(Function&& function) const
+			{
+				pCompletion->AddContinuation(MakeContinuation(std::forward<Function>(function)));
+			}
+
+			/**
+			 * Run a function once the command completes, unless it has already completed.
+			 * The function is never called from within this function, which lets a caller continue directly
+			 * instead of being re-entered.
+			 *
+			 * @param function: The function. It is called with a const reference to the future.
+			 * @return False if the command has already completed, in which case the function is not called.
+			 */
+			template<class Function>
+			bool TryThen(Function&& function) const
+			{
+				CommandCompletion::ContinuationFunction continuation = MakeContinuation(std::forward<Function>(function));
+				return pCompletion->TryAddContinuation(continuation);
+			}
+
+			/**
+			 * Schedule a function on a job system once the command completes.
+			 * The completing thread only schedules the job, so the backend thread is not held up.
+			 *
+			 * @param system: The job system. It must outlive the command.
+			 * @param function: The function. It is called with a const reference to the future.
+			 */
+			template<class Function>
+			void Then(JobSystem& system, Function&& function) const
+			{
+				pCompletion->AddContinuation(MakeContinuation(system, std::forward<Function>(function)));
+			}
+
+			/**
+			 * Schedule a function on a job system once the command completes, unless it has already completed.
+			 *
+			 * @param system: The job system. It must outlive the command.
+			 * @param function: The function. It is called with a const reference to the future.
+			 * @return False if the command has already completed, in which case the function is not scheduled.
+			 */
+			template<class Function>
+			bool TryThen(JobSystem& system, Function&& function) const
+			{
+				CommandCompletion::ContinuationFunction continuation = MakeContinuation(system, std::forward<Function>(function));
+				return pCompletion->TryAddContinuation(continuation);
+			}
+
+		private:
+			/**
+			 * Wrap a function to be called with the future.
+			 */
+			template<class Function>
+			static CommandCompletion::ContinuationFunction MakeContinuation(Function&& function)
+			{
+				return [function = std::forward<Function>(function)](const std::shared_ptr<CommandCompletion>& pState) mutable
+				{
+					function(CommandFuture(std::static_pointer_cast<CompletionType>(pState)));
+				};
+			}
+
+			/**
+			 * Wrap a function to be scheduled on a job system with the future.
+			 */
+			template<class Function>
+			static CommandCompletion::ContinuationFunction MakeContinuation(JobSystem& system, Function&& function)
+			{
+				// The function is shared, so that the job stays small whatever the function captures.
+				auto pFunction = std::make_shared<std::decay_t<Function>>(std::forward<Function>(function));
+				return [&system, pFunction](const std::shared_ptr<CommandCompletion>& pState)
+				{
+					system.Schedule([pFunction, future = CommandFuture(std::static_pointer_cast<CompletionType>(pState))]
+						{
+							(*pFunction)(future);
+						});
+				};
+			}
+
+			std::shared_ptr<CompletionType> pCompletion = nullptr;	// The completion of the command.
+		};
+
+		/**
+		 * Create the completion and the future of a command.
+		 *
+		 * @tparam Type: The type of the command.
+		 * @param command: The command.
+		 * @return The future of the command.
+		 */
+		template<class Type>
+		CommandFuture<CommandResult<Type>> CreateCommandFuture(Command<Type>& command)
+		{
+			auto pCompletion = std::make_shared<CommandResultCompletion<CommandResult<Type>>>();
+			command.pCompletion = pCompletion;
+			return CommandFuture<CommandResult<Type>>(std::move(pCompletion));
+		}
+	}
+}
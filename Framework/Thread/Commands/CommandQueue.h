@@ -3,18 +3,23 @@
 
 #pragma once
 
-#include "Command.h"
-#include "Core/Types/StaticQueue.h"
+#include "CommandFuture.h"
+#include "CommandRecorder.h"
+#include "Core/Benchmark/ExternalMarkers.h"
+#include "Thread/Synchronization/WaitQueue.h"
+
+#include <cstddef>
+#include <new>
+#include <thread>
+#include <type_traits>
 
 #define THREAD_MAX_COMMAND_COUNT	10
+#define THREAD_COMMAND_SLOT_SIZE	128
 
 namespace DMK
 {
 	namespace Thread
 	{
-		// Command queue mutex.
-		static std::mutex __CommandQueueMutex = {};
-
 		/**
 		 * Command Queue for the Dynamik Engine.
 		 * This object is used to store commands in a queue which is submitted to the thread.
@@ -24,13 +29,53 @@ namespace DMK
 		 * - Executing: The command is being executed.
 		 * - Result/ Exit: The command is executed and its state will be returned.
 		 *
+		 * Threads which wait for space, for a command or for synchronization spin briefly and then park, so an
+		 * idle backend thread does not use CPU time.
+		 *
+		 * Every queue owns its synchronization. Any number of threads can push commands and exactly one thread
+		 * consumes them. The queue is the bounded queue of Dmitry Vyukov: every slot has a sequence number which
+		 * tells producers whether the slot is free and the consumer whether it is published, so pushing is one
+		 * compare exchange and popping takes no atomic read-modify-write on the slot.
+		 *
+		 * Commands of up to THREAD_COMMAND_SLOT_SIZE bytes which cannot throw while being copied are constructed
+		 * in their slot, so pushing them does not allocate. Other commands are allocated. The consumer executes the command in its slot and then destroys
+		 * it using PopCommand(), which frees the slot.
+		 *
 		 * @tparam CommandCount: The maximum number of commands which can be stored.
 		 */
 		template<UI64 CommandCount = THREAD_MAX_COMMAND_COUNT>
 		class CommandQueue {
+			static_assert(CommandCount, "A command queue must be able to store at least one command!");
+
+			/**
+			 * Command Slot structure.
+			 */
+			struct CommandSlot {
+				std::atomic<UI64> mSequence = { 0 };	// Position the slot is free for, plus one once published.
+				UI64 mCommandID = 0;	// The command type ID.
+				CommandBase* pCommand = nullptr;	// The command. Points to the storage if it is stored in place.
+				bool bIsInPlace = false;	// Whether the command is constructed in the storage.
+				alignas(std::max_align_t) BYTE mStorage[THREAD_COMMAND_SLOT_SIZE];	// Storage of the commands which fit.
+			};
+
 		public:
-			CommandQueue() {}
-			~CommandQueue() {}
+			CommandQueue()
+			{
+				for (UI64 index = 0; index < CommandCount; index++)
+					mSlots[index].mSequence.store(index, std::memory_order_relaxed);
+			}
+
+			/**
+			 * Delete the commands which were not executed.
+			 */
+			~CommandQueue()
+			{
+				while (mCount.load(std::memory_order_relaxed))
+					PopCommand();
+			}
+
+			CommandQueue(const CommandQueue&) = delete;
+			CommandQueue& operator=(const CommandQueue&) = delete;
 
 			/**
 			 * Push a new command to the command queue.
@@ -42,12 +87,7 @@ namespace DMK
 			template<class Type>
 			void PushCommand(CommandState* pState = nullptr)
 			{
-				// Wait till the command queue has space.
-				while (mCommandQueue.Size() >= CommandCount || mLockDown);
-
-				// Lock the queue and push the data.
-				std::lock_guard<std::mutex> _lock(__CommandQueueMutex);
-				mCommandQueue.Push(std::make_pair(typeid(Type).name(), new Command<Type>(Type(), pState)));
+				Emplace(Type(), pState);
 			}
 
 			/**
@@ -61,48 +101,104 @@ namespace DMK
 			template<class Type>
 			void PushCommand(const Type& command, CommandState* pState = nullptr)
 			{
-				// Wait till the command queue has space.
-				while (mCommandQueue.Size() >= CommandCount);
+				Emplace(command, pState);
+			}
 
-				// Lock the queue and push the data.
-				std::lock_guard<std::mutex> _lock(__CommandQueueMutex);
-				mCommandQueue.Push(std::make_pair(typeid(Type).name(), new Command<Type>(std::move(command), pState)));
+			/**
+			 * Push a new command to the command queue and get its future.
+			 * This method will wait till the command queue has an empty slot to push the data. Unlike the other
+			 * pushes, this allocates the completion which is shared with the future.
+			 *
+			 * @tparam Type: The type of the command.
+			 * @param command: The command data to be pushed with.
+			 * @return The future of the command.
+			 */
+			template<class Type>
+			CommandFuture<CommandResult<Type>> PushCommandAsync(const Type& command = Type())
+			{
+				auto pCompletion = std::make_shared<CommandResultCompletion<CommandResult<Type>>>();
+				CommandFuture<CommandResult<Type>> future(pCompletion);
+
+				Emplace(command, nullptr, std::move(pCompletion));
+				return future;
 			}
 
 			/**
-			 * Get the next command name from the queue.
+			 * Push a command which was already created, for example by a CommandReplayer.
+			 * This method will wait till the command queue has an empty slot to push the data. The queue takes
+			 * the ownership of the command, which must be allocated using new.
 			 *
-			 * @return The const char pointer name.
+			 * @param pCommand: The command.
 			 */
-			const char* GetCommandName() const
+			void PushCommand(CommandBase* pCommand)
 			{
-				// Lock the queue and get the command name.
-				std::lock_guard<std::mutex> _lock(__CommandQueueMutex);
-				return mCommandQueue.Get().first;
+				Record(*pCommand);
+
+				UI64 position = 0;
+				CommandSlot& slot = ClaimSlot(position);
+				slot.bIsInPlace = false;
+
+				Publish(slot, position, pCommand->GetCommandID(), pCommand);
 			}
 
 			/**
-			 * Get the next command from the queue.
+			 * Check if the commands of a type are constructed in their slot, which is when pushing them does not
+			 * allocate. The command must fit the slot and copying it must not throw, as a claimed slot has to be
+			 * published.
 			 *
-			 * @return CommandBase pointer.
+			 * @tparam Type: The type of the command.
+			 * @return Boolean value.
 			 */
-			CommandBase* GetCommand() const
+			template<class Type>
+			static constexpr bool IsStoredInPlace()
+			{
+				return sizeof(Command<Type>) <= THREAD_COMMAND_SLOT_SIZE && alignof(Command<Type>) <= alignof(std::max_align_t)
+					&& std::is_nothrow_copy_constructible_v<Type>;
+			}
+
+			/**
+			 * Get the next command ID from the queue (consumer only).
+			 * The queue must not be empty.
+			 *
+			 * @return The command type ID.
+			 */
+			UI64 GetCommandID() const
 			{
-				// Lock the queue and get the command.
-				std::lock_guard<std::mutex> _lock(__CommandQueueMutex);
-				return mCommandQueue.Get().second;
+				return GetFrontSlot().mCommandID;
 			}
 
 			/**
-			 * Get the first command and pop it from the queue.
+			 * Get the next command from the queue (consumer only).
+			 * The command stays in the queue till PopCommand() is called. The queue must not be empty.
 			 *
 			 * @return CommandBase pointer.
 			 */
-			CommandBase* GetAndPop()
+			CommandBase* GetCommand() const
 			{
-				// Lock the queue and get the command.
-				std::lock_guard<std::mutex> _lock(__CommandQueueMutex);
-				return mCommandQueue.GetAndPop().second;
+				return GetFrontSlot().pCommand;
+			}
+
+			/**
+			 * Destroy the first command and pop it from the queue (consumer only).
+			 * The command may be stored in its slot, so pop it once it is executed. The queue must not be empty.
+			 */
+			void PopCommand()
+			{
+				CommandSlot& slot = GetFrontSlot();
+				if (slot.bIsInPlace)
+					slot.pCommand->~CommandBase();
+				else
+					delete slot.pCommand;
+
+				slot.pCommand = nullptr;
+
+				// Free the slot for the producer one lap ahead.
+				slot.mSequence.store(mDequeuePosition + CommandCount, std::memory_order_release);
+				mDequeuePosition++;
+				mCount.fetch_sub(1, std::memory_order_release);
+
+				// Wake a producer waiting for space.
+				mProducerWaitQueue.NotifyOne();
 			}
 
 			/**
@@ -112,10 +208,34 @@ namespace DMK
 			 */
 			UI64 Count() const
 			{
-				if (mLockDown)
-					mLockDown = false;
+				ReleaseLockDown();
+				return mCount.load(std::memory_order_acquire);
+			}
 
-				return mCommandQueue.Size();
+			/**
+			 * Wait till the command queue has a command.
+			 * This also completes a pending synchronization, like Count().
+			 *
+			 * @return The number of commands in the command queue.
+			 */
+			UI64 WaitForCommand() const
+			{
+				mConsumerWaitQueue.Wait([this] { return mCount.load(std::memory_order_acquire) || mLockDown.load(std::memory_order_acquire); });
+				return Count();
+			}
+
+			/**
+			 * Wait till the command queue has a command or a timeout expires.
+			 * This also completes a pending synchronization, like Count().
+			 *
+			 * @param timeout: The longest time to wait.
+			 * @return The number of commands in the command queue. 0 if the wait timed out.
+			 */
+			template<class Rep, class Period>
+			UI64 WaitForCommand(std::chrono::duration<Rep, Period> timeout) const
+			{
+				mConsumerWaitQueue.WaitFor([this] { return mCount.load(std::memory_order_acquire) || mLockDown.load(std::memory_order_acquire); }, timeout);
+				return Count();
 			}
 
 			/**
@@ -129,19 +249,176 @@ namespace DMK
 			 */
 			void Synchronize()
 			{
-				mLockDown = true;
-				while (mLockDown);
+				mLockDown.store(true, std::memory_order_release);
+				mConsumerWaitQueue.NotifyAll();
+
+				mProducerWaitQueue.Wait([this] { return !mLockDown.load(std::memory_order_acquire); });
 			}
 
+			/**
+			 * Set the recorder which records the pushed commands.
+			 * A command is recorded when it is pushed, before waiting for space, so the recording holds the time
+			 * the producer issued it at. Pushing without a recorder only costs a load and a branch.
+			 *
+			 * @param pCommandRecorder: The recorder. nullptr stops recording. The recorder must outlive its use by the
+			 * producers.
+			 */
+			void SetRecorder(CommandRecorderBase* pCommandRecorder) { pRecorder.store(pCommandRecorder, std::memory_order_release); }
+
+			/**
+			 * Get the recorder which records the pushed commands.
+			 *
+			 * @return The recorder pointer. nullptr if the queue is not recorded.
+			 */
+			CommandRecorderBase* GetRecorder() const { return pRecorder.load(std::memory_order_acquire); }
+
 		private:
-			StaticQueue<std::pair<const char*, CommandBase*>, CommandCount> mCommandQueue;	// Command Queue.
-			mutable bool mLockDown = false;
+			/**
+			 * Construct a command in a claimed slot, or allocate it if it is not stored in place, and publish it.
+			 * Allocating and copying commands which are not stored in place can throw, so it is done before the
+			 * slot is claimed. Once claimed, nothing throws till the slot is published, as the consumer waits for it.
+			 */
+			template<class Type>
+			void Emplace(const Type& command, CommandState* pState, std::shared_ptr<CommandCompletion> pCompletion = nullptr)
+			{
+				if (pRecorder.load(std::memory_order_acquire))
+					Record(Command<Type>(command));
+
+				Command<Type>* pHeapCommand = nullptr;
+				if constexpr (!IsStoredInPlace<Type>())
+					pHeapCommand = new Command<Type>(command, pState);
+
+				UI64 position = 0;
+				CommandSlot& slot = ClaimSlot(position);
+
+				Command<Type>* pCommand = pHeapCommand;
+				if constexpr (IsStoredInPlace<Type>())
+					pCommand = new (slot.mStorage) Command<Type>(command, pState);
+
+				pCommand->pCompletion = std::move(pCompletion);
+				slot.bIsInPlace = IsStoredInPlace<Type>();
+
+				Publish(slot, position, TypeId<Type>(), pCommand);
+			}
+
+			/**
+			 * Record a command if the queue has a recorder.
+			 * This is done when the command is pushed, before waiting for space, so the recording holds the time
+			 * the producer issued it at.
+			 */
+			void Record(const CommandBase& command)
+			{
+				if (CommandRecorderBase* pActiveRecorder = pRecorder.load(std::memory_order_acquire))
+					pActiveRecorder->RecordCommand(command);
+			}
+
+			/**
+			 * Claim a slot, waiting till the command queue is not locked down and has an empty slot. Another
+			 * producer may take the free slot first.
+			 */
+			CommandSlot& ClaimSlot(UI64& position)
+			{
+				mProducerWaitQueue.Wait([this] { return !mLockDown.load(std::memory_order_acquire); });
+
+				CommandSlot* pSlot = nullptr;
+				while (!TryClaimSlot(pSlot, position))
+					mProducerWaitQueue.Wait([this] { return mCount.load(std::memory_order_acquire) < CommandCount; });
+
+				return *pSlot;
+			}
+
+			/**
+			 * Publish the command of a claimed slot and wake the consumer.
+			 */
+			void Publish(CommandSlot& slot, UI64 position, UI64 commandID, CommandBase* pCommand)
+			{
+				slot.mCommandID = commandID;
+				slot.pCommand = pCommand;
+				slot.mSequence.store(position + 1, std::memory_order_release);
+				mCount.fetch_add(1, std::memory_order_release);
+
+				DMK_MARKER_COMMAND_PUSH(commandID);
+
+				// Wake the consumer.
+				mConsumerWaitQueue.NotifyOne();
+			}
+
+			/**
+			 * Claim the slot at the enqueue position.
+			 * Returns false if the queue is full.
+			 */
+			bool TryClaimSlot(CommandSlot*& pSlot, UI64& position)
+			{
+				position = mEnqueuePosition.load(std::memory_order_relaxed);
+				for (;;)
+				{
+					pSlot = &mSlots[position % CommandCount];
+					const I64 difference = static_cast<I64>(pSlot->mSequence.load(std::memory_order_acquire) - position);
+
+					// The slot is free. Claim the position.
+					if (difference == 0)
+					{
+						if (mEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+							return true;
+					}
+
+					// The slot still holds the command of the previous lap.
+					else if (difference < 0)
+						return false;
+
+					// Another producer claimed the position.
+					else
+						position = mEnqueuePosition.load(std::memory_order_relaxed);
+				}
+			}
+
+			/**
+			 * Get the slot at the dequeue position (consumer only).
+			 * A producer may have claimed the slot but not published it yet, in which case this waits for it. The
+			 * producer is only a few instructions away from publishing.
+			 */
+			CommandSlot& GetFrontSlot() const
+			{
+				CommandSlot& slot = mSlots[mDequeuePosition % CommandCount];
+				for (UI32 iteration = 0; slot.mSequence.load(std::memory_order_acquire) != mDequeuePosition + 1; iteration++)
+				{
+					if (iteration < 64)
+						Utilities::Pause();
+					else
+						std::this_thread::yield();
+				}
+
+				return slot;
+			}
+
+			/**
+			 * Release a synchronizing parent thread.
+			 */
+			void ReleaseLockDown() const
+			{
+				if (mLockDown.load(std::memory_order_relaxed) && mLockDown.exchange(false, std::memory_order_acq_rel))
+					mProducerWaitQueue.NotifyAll();
+			}
+
+			mutable CommandSlot mSlots[CommandCount];	// The command slots.
+
+			alignas(DMK_CACHE_LINE_SIZE) std::atomic<UI64> mEnqueuePosition = { 0 };	// Next position to claim. Written by the producers.
+			mutable WaitQueue mProducerWaitQueue;	// Producers and synchronizing threads wait here.
+
+			alignas(DMK_CACHE_LINE_SIZE) UI64 mDequeuePosition = 0;	// Next position to pop. Written by the consumer.
+			mutable WaitQueue mConsumerWaitQueue;	// The consumer waits here for commands.
+
+			alignas(DMK_CACHE_LINE_SIZE) std::atomic<UI64> mCount = { 0 };	// Number of published commands.
+			mutable std::atomic<bool> mLockDown = { false };	// Whether a parent thread is synchronizing.
+
+			alignas(DMK_CACHE_LINE_SIZE) std::atomic<CommandRecorderBase*> pRecorder = { nullptr };	// Records the pushed commands. Read by the producers.
 		};
 	}
 }
 
 /**
  * Macro to delete a command if it is not deleted.
+ * Only for commands allocated using new. The commands of a command queue are destroyed by PopCommand().
  */
 #define DELETE_COMMAND(command, type)		delete command->Derived<type>(), command = nullptr
 
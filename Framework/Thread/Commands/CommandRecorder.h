@@ -0,0 +1,237 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Command.h"
+#include "CommandRegistry.h"
+#include "CommandSerializer.h"
+#include "Thread/Utilities.h"
+
+#include <atomic>
+
+namespace DMK
+{
+	namespace Thread
+	{
+		/**
+		 * Magic number at the start of a command recording ("DMKC").
+		 */
+		constexpr UI32 CommandRecordingMagic = 0x434B4D44;
+
+		/**
+		 * Version of the command recording format.
+		 */
+		constexpr UI16 CommandRecordingVersion = 1;
+
+		/**
+		 * Command Recorder Base object.
+		 * A command queue which has a recorder set passes every pushed command to it. This interface lets the
+		 * queue record without knowing the command registry.
+		 */
+		class CommandRecorderBase {
+		public:
+			CommandRecorderBase() {}
+			virtual ~CommandRecorderBase() {}
+
+			/**
+			 * Record a command.
+			 * This is called by the producer thread which pushes the command, before the command is published, so
+			 * that it can be called from any number of threads at once.
+			 *
+			 * @param command: The command.
+			 */
+			virtual void RecordCommand(const CommandBase& command) = 0;
+		};
+
+		template<class Registry>
+		class CommandRecorder;
+
+		/**
+		 * Command Recorder object.
+		 * This records commands, with the time they were pushed at, to a compact binary recording which a
+		 * CommandReplayer can replay to a backend later. Set it to a command queue using
+		 * CommandQueue::SetRecorder() to capture the traffic of the queue.
+		 *
+		 * The recording starts with a header which holds the magic number, the format version and the command IDs
+		 * of the registry. Every command is then stored as the time since the previous command in nanoseconds,
+		 * the index of its type in the header, the size of its data (all three as variable length integers) and
+		 * the data written by its CommandSerializer. A command usually takes a few bytes more than its data.
+		 *
+		 * Commands of types which are not registered are not recorded; they are counted instead. Recording takes a
+		 * lock, so concurrent producers are recorded in the order they took it.
+		 *
+		 * Usage:
+		 *	Thread::CommandRecorder<AudioCommandRegistry> recorder;
+		 *	pCommandQueue->SetRecorder(&recorder);
+		 *	...
+		 *	pCommandQueue->SetRecorder(nullptr);
+		 *	recorder.SaveToFile("Audio.dmkc");
+		 *
+		 * @tparam Types: The command types of the registry.
+		 */
+		template<class... Types>
+		class CommandRecorder<CommandRegistry<Types...>> final : public CommandRecorderBase {
+			static_assert(sizeof...(Types), "The command registry is empty!");
+			using Registry = CommandRegistry<Types...>;
+
+			/**
+			 * Serialize the data of a command.
+			 */
+			template<class Type>
+			static void Serialize(CommandWriter& writer, const void* pData)
+			{
+				CommandSerializer<Type>::Serialize(writer, *static_cast<const Type*>(pData));
+			}
+
+		public:
+			/**
+			 * Construct the recorder. The recording time starts now.
+			 */
+			CommandRecorder() { Clear(); }
+			~CommandRecorder() {}
+
+			CommandRecorder(const CommandRecorder&) = delete;
+			CommandRecorder& operator=(const CommandRecorder&) = delete;
+
+			/**
+			 * Record a command.
+			 *
+			 * @param command: The command.
+			 */
+			virtual void RecordCommand(const CommandBase& command) override final
+			{
+				using SerializeFunction = void(*)(CommandWriter&, const void*);
+				static constexpr SerializeFunction JumpTable[] = { &Serialize<Types>... };
+
+				const UI32 index = Registry::IndexOf(command.GetCommandID());
+				if (index == InvalidCommandIndex)
+				{
+					mSkippedCount.fetch_add(1, std::memory_order_relaxed);
+					return;
+				}
+
+				Append(index, JumpTable[index], command.Data());
+			}
+
+			/**
+			 * Record command data which is not pushed to a queue.
+			 *
+			 * @tparam Type: The command type. Must be registered.
+			 * @param command: The command data.
+			 */
+			template<class Type>
+			void Record(const Type& command)
+			{
+				Append(Registry::template IndexOf<Type>(), &Serialize<Type>, &command);
+			}
+
+			/**
+			 * Discard the recorded commands and restart the recording time.
+			 */
+			void Clear()
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+
+				mData.clear();
+				CommandWriter writer(mData);
+				writer.Write(CommandRecordingMagic);
+				writer.Write(CommandRecordingVersion);
+				writer.Write(static_cast<UI16>(Registry::Count));
+
+				for (const UI64 commandID : { TypeId<Types>()... })
+					writer.Write(commandID);
+
+				mCommandCount = 0;
+				mSkippedCount.store(0, std::memory_order_relaxed);
+				mStartTime = Utilities::Clock::now();
+				mLastTime = mStartTime;
+			}
+
+			/**
+			 * Get the number of recorded commands.
+			 *
+			 * @return The command count.
+			 */
+			UI64 GetCommandCount() const
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				return mCommandCount;
+			}
+
+			/**
+			 * Get the number of commands which were not recorded as their types are not registered.
+			 *
+			 * @return The command count.
+			 */
+			UI64 GetSkippedCount() const { return mSkippedCount.load(std::memory_order_relaxed); }
+
+			/**
+			 * Get the time from the start of the recording to the last recorded command.
+			 *
+			 * @return The duration.
+			 */
+			Utilities::Duration GetDuration() const
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				return mLastTime - mStartTime;
+			}
+
+			/**
+			 * Get a copy of the recording.
+			 *
+			 * @return The recording bytes.
+			 */
+			std::vector<BYTE> GetData() const
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				return mData;
+			}
+
+			/**
+			 * Save the recording to a file.
+			 *
+			 * @param path: The file path.
+			 * @return Boolean value stating whether the file was written.
+			 */
+			bool SaveToFile(const std::string& path) const
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				return _Helpers::WriteCommandRecordingFile(path, mData);
+			}
+
+		private:
+			/**
+			 * Append a command to the recording.
+			 * The data is serialized before taking the lock, so the lock is only held to copy it.
+			 */
+			void Append(UI32 index, void(*serialize)(CommandWriter&, const void*), const void* pData)
+			{
+				thread_local std::vector<BYTE> payload;
+				payload.clear();
+
+				CommandWriter payloadWriter(payload);
+				serialize(payloadWriter, pData);
+
+				std::lock_guard<std::mutex> lock(mMutex);
+				const Utilities::TimePoint time = Utilities::Clock::now();
+
+				CommandWriter writer(mData);
+				writer.WriteVarInt(static_cast<UI64>(std::chrono::duration_cast<Utilities::Nanoseconds>(time - mLastTime).count()));
+				writer.WriteVarInt(index);
+				writer.WriteVarInt(payload.size());
+				writer.WriteBytes(payload.data(), payload.size());
+
+				mLastTime = time;
+				mCommandCount++;
+			}
+
+			std::vector<BYTE> mData;	// The recording.
+			Utilities::TimePoint mStartTime = {};	// When the recording started.
+			Utilities::TimePoint mLastTime = {};	// When the last command was recorded.
+			UI64 mCommandCount = 0;	// Number of recorded commands.
+			std::atomic<UI64> mSkippedCount = { 0 };	// Number of commands of types which are not registered.
+			mutable std::mutex mMutex;	// Serializes the producers.
+		};
+	}
+}
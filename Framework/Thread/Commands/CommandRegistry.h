@@ -0,0 +1,179 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Core/Types/DataTypes.h"
+#include "Core/Hash/CompileTimeHash.h"
+
+#include <array>
+#include <cstddef>
+
+namespace DMK
+{
+	namespace Thread
+	{
+		/**
+		 * Command index returned for command types which are not registered.
+		 */
+		constexpr UI32 InvalidCommandIndex = ~0u;
+
+		namespace _Helpers
+		{
+			/**
+			 * Perfect hash parameters.
+			 * A command ID is mapped to the slot ((ID >> mShift) & (mTableSize - 1)).
+			 */
+			struct CommandHashParameters {
+				UI64 mTableSize = 0;	// Number of slots. A power of two.
+				UI32 mShift = 0;	// Right shift applied to the command ID.
+			};
+
+			/**
+			 * Find the index of a command ID in a list.
+			 */
+			template<std::size_t Count>
+			constexpr UI32 FindCommandIndex(const std::array<UI64, Count>& commandIDs, UI64 commandID)
+			{
+				for (UI64 index = 0; index < Count; index++)
+					if (commandIDs[index] == commandID)
+						return static_cast<UI32>(index);
+
+				return InvalidCommandIndex;
+			}
+
+			/**
+			 * Check if a command ID is in a list more than once, which is when a type is registered twice.
+			 */
+			template<std::size_t Count>
+			constexpr bool HasDuplicateCommandIDs(const std::array<UI64, Count>& commandIDs)
+			{
+				for (UI64 lhs = 0; lhs < Count; lhs++)
+					for (UI64 rhs = lhs + 1; rhs < Count; rhs++)
+						if (commandIDs[lhs] == commandIDs[rhs])
+							return true;
+
+				return false;
+			}
+
+			/**
+			 * Find the smallest table size and a shift which map every command ID to a different slot.
+			 * The table size is 0 if there is none. This happens if a type is registered twice, and for distinct
+			 * IDs whose bits collide within the searched table sizes and shifts.
+			 */
+			template<std::size_t Count>
+			constexpr CommandHashParameters FindCommandHashParameters(const std::array<UI64, Count>& commandIDs)
+			{
+				UI64 minimumSize = 1;
+				while (minimumSize < Count)
+					minimumSize <<= 1;
+
+				for (UI64 tableSize = minimumSize; tableSize <= minimumSize * 64; tableSize <<= 1)
+				{
+					for (UI32 shift = 0; shift < 64; shift++)
+					{
+						bool bIsCollisionFree = true;
+						for (UI64 lhs = 0; lhs < Count && bIsCollisionFree; lhs++)
+							for (UI64 rhs = lhs + 1; rhs < Count && bIsCollisionFree; rhs++)
+								bIsCollisionFree = ((commandIDs[lhs] >> shift) & (tableSize - 1)) != ((commandIDs[rhs] >> shift) & (tableSize - 1));
+
+						if (bIsCollisionFree)
+							return CommandHashParameters{ tableSize, shift };
+					}
+				}
+
+				return CommandHashParameters{};
+			}
+
+			/**
+			 * Build the slot table, which stores the command index of every slot.
+			 */
+			template<UI64 TableSize, std::size_t Count>
+			constexpr std::array<UI32, TableSize> BuildCommandSlots(const std::array<UI64, Count>& commandIDs, UI32 shift)
+			{
+				std::array<UI32, TableSize> slots = {};
+				for (UI64 index = 0; index < TableSize; index++)
+					slots[index] = InvalidCommandIndex;
+
+				for (UI64 index = 0; index < Count; index++)
+					slots[(commandIDs[index] >> shift) & (TableSize - 1)] = static_cast<UI32>(index);
+
+				return slots;
+			}
+		}
+
+		/**
+		 * Command Registry object.
+		 * A registry lists the command types a backend handles and assigns them dense indexes, in the order they
+		 * are listed, at compile time. These indexes are used by the CommandDispatcher to index its jump table.
+		 *
+		 * Commands carry their TypeId<>(). A registry maps it to the dense index in constant time using a perfect
+		 * hash which is also found at compile time, so no RTTI is needed.
+		 *
+		 * Usage: using AudioCommands = Thread::CommandRegistry<InitializeBackend, TerminateBackend, ...>;
+		 *
+		 * @tparam Types: The command types.
+		 */
+		template<class... Types>
+		class CommandRegistry {
+			static constexpr std::array<UI64, sizeof...(Types)> mCommandIDs = { TypeId<Types>()... };
+			static constexpr _Helpers::CommandHashParameters mHashParameters = _Helpers::FindCommandHashParameters(mCommandIDs);
+			static_assert(!_Helpers::HasDuplicateCommandIDs(mCommandIDs), "A command type is registered more than once!");
+			static_assert(mHashParameters.mTableSize || _Helpers::HasDuplicateCommandIDs(mCommandIDs), "No collision free hash was found for the command IDs! Register fewer command types.");
+
+			static constexpr std::array<UI32, mHashParameters.mTableSize> mSlots = _Helpers::BuildCommandSlots<mHashParameters.mTableSize>(mCommandIDs, mHashParameters.mShift);
+
+		public:
+			/**
+			 * Number of registered command types.
+			 */
+			static constexpr UI32 Count = sizeof...(Types);
+
+			/**
+			 * Check if a command type is registered.
+			 *
+			 * @tparam Type: The command type.
+			 * @return Boolean value.
+			 */
+			template<class Type>
+			static constexpr bool Contains()
+			{
+				return _Helpers::FindCommandIndex(mCommandIDs, TypeId<Type>()) != InvalidCommandIndex;
+			}
+
+			/**
+			 * Get the dense index of a command type.
+			 *
+			 * @tparam Type: The command type. Must be registered.
+			 * @return The index as UI32.
+			 */
+			template<class Type>
+			static constexpr UI32 IndexOf()
+			{
+				static_assert(Contains<Type>(), "The command type is not registered!");
+				return _Helpers::FindCommandIndex(mCommandIDs, TypeId<Type>());
+			}
+
+			/**
+			 * Get the dense index of a command ID.
+			 *
+			 * @param commandID: The command ID (TypeId<>() of the command type).
+			 * @return The index as UI32. InvalidCommandIndex if the command type is not registered.
+			 */
+			static constexpr UI32 IndexOf(UI64 commandID)
+			{
+				const UI32 index = mSlots[(commandID >> mHashParameters.mShift) & (mHashParameters.mTableSize - 1)];
+				return index != InvalidCommandIndex && mCommandIDs[index] == commandID ? index : InvalidCommandIndex;
+			}
+		};
+
+		template<class... Types>
+		constexpr std::array<UI64, sizeof...(Types)> CommandRegistry<Types...>::mCommandIDs;
+
+		template<class... Types>
+		constexpr _Helpers::CommandHashParameters CommandRegistry<Types...>::mHashParameters;
+
+		template<class... Types>
+		constexpr std::array<UI32, CommandRegistry<Types...>::mHashParameters.mTableSize> CommandRegistry<Types...>::mSlots;
+	}
+}
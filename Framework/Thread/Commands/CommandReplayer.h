@@ -0,0 +1,309 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "CommandQueue.h"
+#include "CommandDispatcher.h"
+
+#include <algorithm>
+
+namespace DMK
+{
+	namespace Thread
+	{
+		/**
+		 * Command Replay Speed enum.
+		 */
+		enum class CommandReplaySpeed : UI8 {
+			RECORDED,	// Commands are issued at the times they were recorded at.
+			MAXIMUM,	// Commands are issued back to back.
+		};
+
+		/**
+		 * Command Replay Statistics structure.
+		 * The lag of a command is how late it was issued compared to the time it was recorded at. It grows when
+		 * the queue is full, as the replayer then waits for the backend to make space.
+		 */
+		struct CommandReplayStatistics {
+			UI64 mCommandCount = 0;	// Number of replayed commands.
+			UI64 mSkippedCount = 0;	// Number of recorded commands of types which are not registered.
+			Utilities::Duration mElapsedTime = Utilities::Duration::zero();	// Time taken by the replay.
+			Utilities::Duration mMaxLag = Utilities::Duration::zero();	// Highest lag of a command.
+		};
+
+		template<class Registry>
+		class CommandReplayer;
+
+		/**
+		 * Command Replayer object.
+		 * This loads a recording made by a CommandRecorder and issues its commands again, either by pushing them
+		 * to a command queue which a backend thread consumes, or by dispatching them to a handler on the calling
+		 * thread. Replaying the same recording gives a backend the same load on every run.
+		 *
+		 * The command types of the recording are matched to the registry by their IDs, so the registry may list
+		 * them in another order than the recorder did. Commands of types the registry does not have are skipped.
+		 *
+		 * Strings of the replayed commands are owned by the replayer, so it must outlive the commands it issues.
+		 * Pointers which the backend writes its output to are replayed as nullptr (see CommandSerializer), and
+		 * handles are replayed as recorded, which matches when the backend creates its objects in the same order.
+		 *
+		 * Usage:
+		 *	Thread::CommandReplayer<AudioCommandRegistry> replayer;
+		 *	if (replayer.LoadFromFile("Audio.dmkc"))
+		 *		replayer.Replay(*pCommandQueue, Thread::CommandReplaySpeed::MAXIMUM);
+		 *
+		 * @tparam Types: The command types of the registry.
+		 */
+		template<class... Types>
+		class CommandReplayer<CommandRegistry<Types...>> {
+			static_assert(sizeof...(Types), "The command registry is empty!");
+			using Registry = CommandRegistry<Types...>;
+
+			/**
+			 * Recorded Command structure.
+			 */
+			struct RecordedCommand {
+				Utilities::Duration mTime = Utilities::Duration::zero();	// Time since the start of the recording.
+				UI64 mDataOffset = 0;	// Offset of the command data in the recording.
+				UI32 mDataSize = 0;	// Size of the command data.
+				UI32 mCommandIndex = InvalidCommandIndex;	// Index of the command type in the registry.
+			};
+
+			/**
+			 * Create a command by reading its data.
+			 */
+			template<class Type>
+			static CommandBase* Deserialize(CommandReader& reader)
+			{
+				return new Command<Type>(CommandSerializer<Type>::Deserialize(reader));
+			}
+
+		public:
+			CommandReplayer() {}
+			~CommandReplayer() {}
+
+			CommandReplayer(const CommandReplayer&) = delete;
+			CommandReplayer& operator=(const CommandReplayer&) = delete;
+
+			/**
+			 * Load a recording from a file.
+			 *
+			 * @param path: The file path.
+			 * @return Boolean value stating whether the recording was loaded.
+			 */
+			bool LoadFromFile(const std::string& path)
+			{
+				std::vector<BYTE> data;
+				if (!_Helpers::ReadCommandRecordingFile(path, data))
+				{
+					Clear();
+					return false;
+				}
+
+				return Load(std::move(data));
+			}
+
+			/**
+			 * Load a recording.
+			 * The recording is checked as a whole, so a truncated or corrupt recording is not loaded at all.
+			 *
+			 * @param data: The recording, as returned by CommandRecorder::GetData().
+			 * @return Boolean value stating whether the recording was loaded.
+			 */
+			bool Load(std::vector<BYTE> data)
+			{
+				Clear();
+				mData = std::move(data);
+
+				CommandReader reader(mData.data(), mData.size(), mStringPool);
+				const UI32 magic = reader.Read<UI32>();
+				const UI16 version = reader.Read<UI16>();
+				const UI16 typeCount = reader.Read<UI16>();
+				if (!reader.IsValid() || magic != CommandRecordingMagic || version != CommandRecordingVersion)
+				{
+					Clear();
+					return false;
+				}
+
+				// Map the command types of the recording to the registry.
+				std::vector<UI32> commandIndexes(typeCount);
+				for (UI32& commandIndex : commandIndexes)
+					commandIndex = Registry::IndexOf(reader.Read<UI64>());
+
+				Utilities::Duration time = Utilities::Duration::zero();
+				while (reader.IsValid() && reader.GetRemainingSize())
+				{
+					time += Utilities::Duration(static_cast<Utilities::Duration::rep>(reader.ReadVarInt()));
+					const UI64 typeIndex = reader.ReadVarInt();
+					const UI64 dataSize = reader.ReadVarInt();
+
+					if (!reader.IsValid() || typeIndex >= typeCount || dataSize > reader.GetRemainingSize())
+					{
+						Clear();
+						return false;
+					}
+
+					RecordedCommand command;
+					command.mTime = time;
+					command.mDataOffset = mData.size() - reader.GetRemainingSize();
+					command.mDataSize = static_cast<UI32>(dataSize);
+					command.mCommandIndex = commandIndexes[typeIndex];
+					mCommands.push_back(command);
+
+					if (command.mCommandIndex == InvalidCommandIndex)
+						mSkippedCount++;
+
+					reader.Skip(dataSize);
+				}
+
+				if (!reader.IsValid())
+				{
+					Clear();
+					return false;
+				}
+
+				return true;
+			}
+
+			/**
+			 * Unload the recording and release the strings of the replayed commands.
+			 */
+			void Clear()
+			{
+				mData.clear();
+				mCommands.clear();
+				mSkippedCount = 0;
+				ReleaseStrings();
+			}
+
+			/**
+			 * Release the strings of the replayed commands. Every replay copies the strings it issues, so call
+			 * this between replays once the backend has executed the commands of the previous ones.
+			 */
+			void ReleaseStrings() { mStringPool.clear(); }
+
+			/**
+			 * Get the number of recorded commands, including the skipped ones.
+			 *
+			 * @return The command count.
+			 */
+			UI64 GetCommandCount() const { return mCommands.size(); }
+
+			/**
+			 * Get the number of recorded commands of types which are not registered.
+			 *
+			 * @return The command count.
+			 */
+			UI64 GetSkippedCount() const { return mSkippedCount; }
+
+			/**
+			 * Get the time from the start of the recording to the last recorded command.
+			 *
+			 * @return The duration.
+			 */
+			Utilities::Duration GetDuration() const { return mCommands.empty() ? Utilities::Duration::zero() : mCommands.back().mTime; }
+
+			/**
+			 * Create a recorded command.
+			 *
+			 * @param index: The index of the command in the recording.
+			 * @return The command, which the caller owns. nullptr if its type is not registered or its data does
+			 * not match its serializer.
+			 */
+			CommandBase* CreateCommand(UI64 index)
+			{
+				using DeserializeFunction = CommandBase*(*)(CommandReader&);
+				static constexpr DeserializeFunction JumpTable[] = { &Deserialize<Types>... };
+
+				const RecordedCommand& command = mCommands[index];
+				if (command.mCommandIndex == InvalidCommandIndex)
+					return nullptr;
+
+				CommandReader reader(mData.data() + command.mDataOffset, command.mDataSize, mStringPool);
+				CommandBase* pCommand = JumpTable[command.mCommandIndex](reader);
+				if (!reader.IsValid())
+				{
+					delete pCommand;
+					return nullptr;
+				}
+
+				return pCommand;
+			}
+
+			/**
+			 * Push the recorded commands to a command queue.
+			 * The backend thread consuming the queue executes and pops them.
+			 *
+			 * @tparam CommandCount: The command count of the queue.
+			 * @param queue: The command queue.
+			 * @param speed: The replay speed. Default is RECORDED.
+			 * @param spinThreshold: How long to spin before the time of a command. Default is
+			 * Utilities::DefaultSpinThreshold.
+			 * @return The replay statistics.
+			 */
+			template<UI64 CommandCount>
+			CommandReplayStatistics Replay(CommandQueue<CommandCount>& queue, CommandReplaySpeed speed = CommandReplaySpeed::RECORDED, Utilities::Duration spinThreshold = Utilities::DefaultSpinThreshold)
+			{
+				return Issue(speed, spinThreshold, [&queue](CommandBase* pCommand) { queue.PushCommand(pCommand); });
+			}
+
+			/**
+			 * Dispatch the recorded commands to a handler on the calling thread, without a command queue.
+			 * This runs the backend's handler in isolation, as the CommandDispatcher would on the backend thread.
+			 *
+			 * @param handler: The handler object.
+			 * @param speed: The replay speed. Default is MAXIMUM.
+			 * @param spinThreshold: How long to spin before the time of a command. Default is
+			 * Utilities::DefaultSpinThreshold.
+			 * @return The replay statistics.
+			 */
+			template<class Handler>
+			CommandReplayStatistics Dispatch(Handler& handler, CommandReplaySpeed speed = CommandReplaySpeed::MAXIMUM, Utilities::Duration spinThreshold = Utilities::DefaultSpinThreshold)
+			{
+				return Issue(speed, spinThreshold, [&handler](CommandBase* pCommand)
+					{
+						pCommand->SetState(CommandDispatcher<Registry>::Dispatch(handler, pCommand));
+						delete pCommand;
+					});
+			}
+
+		private:
+			/**
+			 * Create every recorded command and pass it to a function at its time.
+			 */
+			template<class Function>
+			CommandReplayStatistics Issue(CommandReplaySpeed speed, Utilities::Duration spinThreshold, const Function& function)
+			{
+				CommandReplayStatistics statistics;
+				statistics.mSkippedCount = mSkippedCount;
+
+				const Utilities::TimePoint startTime = Utilities::Clock::now();
+				for (UI64 index = 0; index < mCommands.size(); index++)
+				{
+					CommandBase* pCommand = CreateCommand(index);
+					if (!pCommand)
+						continue;
+
+					const Utilities::TimePoint deadline = startTime + mCommands[index].mTime;
+					if (speed == CommandReplaySpeed::RECORDED)
+						Utilities::SleepUntil(deadline, spinThreshold);
+
+					function(pCommand);
+					statistics.mCommandCount++;
+
+					if (speed == CommandReplaySpeed::RECORDED)
+						statistics.mMaxLag = std::max(statistics.mMaxLag, Utilities::Duration(Utilities::Clock::now() - deadline));
+				}
+
+				statistics.mElapsedTime = Utilities::Clock::now() - startTime;
+				return statistics;
+			}
+
+			std::vector<BYTE> mData;	// The recording.
+			std::vector<RecordedCommand> mCommands;	// The commands of the recording.
+			std::vector<std::unique_ptr<BYTE[]>> mStringPool;	// Strings of the replayed commands.
+			UI64 mSkippedCount = 0;	// Number of commands of types which are not registered.
+		};
+	}
+}
@@ -0,0 +1,368 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "CommandDispatcher.h"
+#include "Core/Benchmark/ExternalMarkers.h"
+#include "CommandFuture.h"
+#include "Thread/Synchronization/WaitQueue.h"
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+#define THREAD_COMMAND_RING_SIZE	65536
+
+namespace DMK
+{
+	namespace Thread
+	{
+		namespace _Helpers
+		{
+			/**
+			 * Alignment of the records in a command ring.
+			 */
+			constexpr UI64 CommandRecordAlignment = alignof(std::max_align_t);
+
+			/**
+			 * Command record header.
+			 * Every record starts with this header, followed by the Command<Type> object.
+			 */
+			struct alignas(CommandRecordAlignment) CommandRecordHeader {
+				UI64 mSize = 0;	// Size of the record including the header, in bytes.
+				bool bIsPadding = false;	// Padding records fill the end of the buffer when a record does not fit.
+			};
+
+			/**
+			 * Get the size of the record of a command type.
+			 */
+			template<class Type>
+			constexpr UI64 GetCommandRecordSize()
+			{
+				return (sizeof(CommandRecordHeader) + sizeof(Command<Type>) + CommandRecordAlignment - 1) & ~(CommandRecordAlignment - 1);
+			}
+		}
+
+		/**
+		 * Command Ring object.
+		 * This is a zero allocation alternative to the CommandQueue for exactly one producer thread and one
+		 * consumer thread. Commands are constructed in place in a byte ring as records of a header (the record
+		 * size) and the Command<Type> object (the type ID, the state pointer and the payload). The consumer executes
+		 * them in place using a CommandDispatcher and destroys them in place, so no command is allocated or copied.
+		 *
+		 * A backend with more than one producer owns one ring per producer and drains all of them.
+		 *
+		 * Like the queue, a full ring blocks the producer and an empty ring blocks the consumer, spinning briefly
+		 * and then parking.
+		 *
+		 * @tparam ByteCount: The size of the ring in bytes. Must be a power of two.
+		 */
+		template<UI64 ByteCount = THREAD_COMMAND_RING_SIZE>
+		class CommandRing {
+			static_assert(ByteCount >= 1024 && ((ByteCount & (ByteCount - 1)) == 0), "The byte count of a command ring must be a power of two of at least 1024!");
+
+			static constexpr UI64 Mask = ByteCount - 1;
+
+		public:
+			CommandRing() {}
+
+			/**
+			 * Destroy the commands which were not executed.
+			 */
+			~CommandRing()
+			{
+				while (CommandBase* pCommand = Front())
+					Pop(pCommand);
+			}
+
+			CommandRing(const CommandRing&) = delete;
+			CommandRing& operator=(const CommandRing&) = delete;
+
+			/**
+			 * Push a new command to the ring (producer only).
+			 * This method will wait till the ring has space for the command.
+			 *
+			 * @tparam Type: The type of the command.
+			 * @param command: The command data.
+			 * @param pState: The state variable pointer. Default is nullptr.
+			 */
+			template<class Type>
+			void PushCommand(Type&& command, CommandState* pState = nullptr)
+			{
+				UI64 head = mHead.load(std::memory_order_relaxed);
+				Write(head, std::forward<Type>(command), pState);
+				Publish(head);
+			}
+
+			/**
+			 * Push a new default constructed command to the ring (producer only).
+			 * This method will wait till the ring has space for the command.
+			 *
+			 * @tparam Type: The type of the command.
+			 * @param pState: The state variable pointer. Default is nullptr.
+			 */
+			template<class Type>
+			void PushCommand(CommandState* pState = nullptr)
+			{
+				PushCommand(Type(), pState);
+			}
+
+			/**
+			 * Push a new command to the ring and get its future (producer only).
+			 * This method will wait till the ring has space for the command. Unlike the other pushes, this
+			 * allocates the completion which is shared with the future.
+			 *
+			 * @tparam Type: The type of the command.
+			 * @param command: The command data.
+			 * @return The future of the command.
+			 */
+			template<class Type>
+			CommandFuture<CommandResult<typename std::decay<Type>::type>> PushCommandAsync(Type&& command)
+			{
+				CommandFuture<CommandResult<typename std::decay<Type>::type>> future;
+
+				UI64 head = mHead.load(std::memory_order_relaxed);
+				Write(head, std::forward<Type>(command), nullptr, &future);
+				Publish(head);
+
+				return future;
+			}
+
+			/**
+			 * Push a number of commands to the ring (producer only).
+			 * The commands are published together with one release store and one notification. If the ring cannot
+			 * hold all of them, the written commands are published and the rest are written once space is freed.
+			 *
+			 * @tparam Types: The types of the commands.
+			 * @param commands: The command data.
+			 */
+			template<class... Types>
+			void PushCommands(Types&&... commands)
+			{
+				UI64 head = mHead.load(std::memory_order_relaxed);
+				(Write(head, std::forward<Types>(commands), nullptr), ...);
+				Publish(head);
+			}
+
+			/**
+			 * Push an array of commands to the ring (producer only).
+			 * The commands are published together with one release store and one notification. If the ring cannot
+			 * hold all of them, the written commands are published and the rest are written once space is freed.
+			 *
+			 * @tparam Type: The type of the commands.
+			 * @param pCommands: The command data.
+			 * @param count: The number of commands.
+			 */
+			template<class Type>
+			void PushCommandRange(const Type* pCommands, UI64 count)
+			{
+				UI64 head = mHead.load(std::memory_order_relaxed);
+				for (UI64 index = 0; index < count; index++)
+					Write(head, pCommands[index], nullptr);
+
+				Publish(head);
+			}
+
+			/**
+			 * Get the first command without removing it (consumer only).
+			 *
+			 * @return CommandBase pointer. nullptr if the ring is empty.
+			 */
+			CommandBase* Front()
+			{
+				UI64 tail = mTail.load(std::memory_order_relaxed);
+				if (tail == mCachedHead)
+				{
+					mCachedHead = mHead.load(std::memory_order_acquire);
+					if (tail == mCachedHead)
+						return nullptr;
+				}
+
+				return GetCommand(tail);
+			}
+
+			/**
+			 * Destroy the command returned by Front() and remove it (consumer only).
+			 *
+			 * @param pCommand: The command returned by Front().
+			 */
+			void Pop(CommandBase* pCommand)
+			{
+				UI64 tail = mTail.load(std::memory_order_relaxed);
+				GetCommand(tail);
+				pCommand->~CommandBase();
+				tail += GetHeader(tail)->mSize;
+
+				mTail.store(tail, std::memory_order_release);
+				mProducerWaitQueue.NotifyOne();
+			}
+
+			/**
+			 * Execute the commands in the ring and destroy them (consumer only).
+			 * The state of each command is set to the result of the dispatch. The executed commands are released
+			 * together with one release store.
+			 *
+			 * @tparam Registry: The command registry of the consumer.
+			 * @param handler: The handler object.
+			 * @param maxCount: The maximum number of commands to execute. Default is all of them.
+			 * @return The number of executed commands.
+			 */
+			template<class Registry, class Handler>
+			UI64 ExecuteCommands(Handler& handler, UI64 maxCount = ~0ull)
+			{
+				UI64 tail = mTail.load(std::memory_order_relaxed);
+				mCachedHead = mHead.load(std::memory_order_acquire);
+
+				UI64 count = 0;
+				for (; tail != mCachedHead && count < maxCount; count++)
+				{
+					CommandBase* pCommand = GetCommand(tail);
+					const UI64 recordSize = GetHeader(tail)->mSize;
+
+					DMK_MARKER_COMMAND(pCommand->GetCommandID(), pCommand->GetCommandName());
+
+					pCommand->SetState(CommandState::EXECUTING);
+					pCommand->SetState(CommandDispatcher<Registry>::Dispatch(handler, pCommand));
+					pCommand->~CommandBase();
+
+					tail += recordSize;
+				}
+
+				if (count)
+				{
+					mTail.store(tail, std::memory_order_release);
+					mProducerWaitQueue.NotifyOne();
+				}
+
+				return count;
+			}
+
+			/**
+			 * Wait till the ring has a command (consumer only).
+			 */
+			void WaitForCommands()
+			{
+				const UI64 tail = mTail.load(std::memory_order_relaxed);
+				mConsumerWaitQueue.Wait([this, tail] { return mHead.load(std::memory_order_acquire) != tail; });
+			}
+
+			/**
+			 * Check if the ring is empty.
+			 * The value is only a snapshot when called while the other side is active.
+			 *
+			 * @return Boolean value.
+			 */
+			bool IsEmpty() const
+			{
+				return mHead.load(std::memory_order_acquire) == mTail.load(std::memory_order_acquire);
+			}
+
+			/**
+			 * Get the size of the ring in bytes.
+			 *
+			 * @return The byte count.
+			 */
+			static constexpr UI64 Capacity() { return ByteCount; }
+
+		private:
+			/**
+			 * Get the record header at a position.
+			 */
+			_Helpers::CommandRecordHeader* GetHeader(UI64 position)
+			{
+				return std::launder(reinterpret_cast<_Helpers::CommandRecordHeader*>(mBytes + (position & Mask)));
+			}
+
+			/**
+			 * Get the command of the record at a position, skipping a padding record.
+			 */
+			CommandBase* GetCommand(UI64& position)
+			{
+				_Helpers::CommandRecordHeader* pHeader = GetHeader(position);
+				if (pHeader->bIsPadding)
+				{
+					position += pHeader->mSize;
+					pHeader = GetHeader(position);
+				}
+
+				return std::launder(reinterpret_cast<CommandBase*>(pHeader + 1));
+			}
+
+			/**
+			 * Construct a command at the local head without publishing it (producer only).
+			 * Waits till there is space, publishing the already written commands first.
+			 */
+			template<class Type>
+			void Write(UI64& head, Type&& command, CommandState* pState, CommandFuture<CommandResult<typename std::decay<Type>::type>>* pFuture = nullptr)
+			{
+				using CommandType = typename std::decay<Type>::type;
+				constexpr UI64 recordSize = _Helpers::GetCommandRecordSize<CommandType>();
+				static_assert(recordSize <= ByteCount / 4, "The command is too large for the command ring!");
+				static_assert(alignof(Command<CommandType>) <= _Helpers::CommandRecordAlignment, "The command is over aligned!");
+
+				// Records do not wrap around. Pad the end of the buffer if the record does not fit.
+				const UI64 contiguousSize = ByteCount - (head & Mask);
+				const UI64 requiredSize = recordSize > contiguousSize ? contiguousSize + recordSize : recordSize;
+
+				if (!HasSpace(head, requiredSize))
+				{
+					Publish(head);
+					mProducerWaitQueue.Wait([this, head, requiredSize] { return HasSpace(head, requiredSize); });
+				}
+
+				if (recordSize > contiguousSize)
+				{
+					new (mBytes + (head & Mask)) _Helpers::CommandRecordHeader{ contiguousSize, true };
+					head += contiguousSize;
+				}
+
+				_Helpers::CommandRecordHeader* pHeader = new (mBytes + (head & Mask)) _Helpers::CommandRecordHeader{ recordSize, false };
+				Command<CommandType>* pCommand = new (pHeader + 1) Command<CommandType>(std::forward<Type>(command), pState);
+				if (pFuture)
+					*pFuture = CreateCommandFuture(*pCommand);
+
+				head += recordSize;
+
+				DMK_MARKER_COMMAND_PUSH(TypeId<CommandType>());
+			}
+
+			/**
+			 * Publish the commands written up to the local head and wake the consumer (producer only).
+			 */
+			void Publish(UI64 head)
+			{
+				if (head == mHead.load(std::memory_order_relaxed))
+					return;
+
+				mHead.store(head, std::memory_order_release);
+				mConsumerWaitQueue.NotifyOne();
+			}
+
+			/**
+			 * Check if there is space for a number of bytes (producer only).
+			 */
+			bool HasSpace(UI64 head, UI64 size)
+			{
+				if (head + size - mCachedTail > ByteCount)
+				{
+					mCachedTail = mTail.load(std::memory_order_acquire);
+					if (head + size - mCachedTail > ByteCount)
+						return false;
+				}
+
+				return true;
+			}
+
+			alignas(DMK_CACHE_LINE_SIZE) std::atomic<UI64> mHead = { 0 };	// Next byte to write. Written by the producer.
+			UI64 mCachedTail = 0;	// Producer's copy of the tail.
+			WaitQueue mProducerWaitQueue;	// The producer waits here for space.
+
+			alignas(DMK_CACHE_LINE_SIZE) std::atomic<UI64> mTail = { 0 };	// Next byte to read. Written by the consumer.
+			UI64 mCachedHead = 0;	// Consumer's copy of the head.
+			WaitQueue mConsumerWaitQueue;	// The consumer waits here for commands.
+
+			alignas(DMK_CACHE_LINE_SIZE) BYTE mBytes[ByteCount];	// The records.
+		};
+	}
+}
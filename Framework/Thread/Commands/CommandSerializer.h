@@ -0,0 +1,312 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Core/Types/DataTypes.h"
+#include "Core/Macros/Global.h"
+
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace DMK
+{
+	namespace Thread
+	{
+		/**
+		 * Command Writer object.
+		 * This appends the serialized data of commands to a byte buffer. Values are written in the byte order of
+		 * the machine, and integers which are usually small can be written as variable length integers.
+		 */
+		class CommandWriter {
+		public:
+			/**
+			 * Construct the writer using the buffer to append to.
+			 *
+			 * @param buffer: The byte buffer.
+			 */
+			explicit CommandWriter(std::vector<BYTE>& buffer) : mBuffer(buffer) {}
+			~CommandWriter() {}
+
+			/**
+			 * Write raw bytes.
+			 *
+			 * @param pData: The data to write.
+			 * @param size: The number of bytes.
+			 */
+			void WriteBytes(const void* pData, UI64 size)
+			{
+				const UI64 offset = mBuffer.size();
+				mBuffer.resize(offset + size);
+
+				if (size)
+					std::memcpy(mBuffer.data() + offset, pData, size);
+			}
+
+			/**
+			 * Write a value by copying its bytes.
+			 * Pointers stored in the value are written as addresses, which are meaningless when read back.
+			 *
+			 * @tparam Type: The type of the value. Must be trivially copyable.
+			 * @param value: The value to write.
+			 */
+			template<class Type>
+			void Write(const Type& value)
+			{
+				static_assert(std::is_trivially_copyable<Type>::value, "Only trivially copyable values can be written as bytes!");
+				WriteBytes(&value, sizeof(Type));
+			}
+
+			/**
+			 * Write an unsigned integer using 7 bits per byte. Values below 128 take a single byte.
+			 *
+			 * @param value: The value to write.
+			 */
+			void WriteVarInt(UI64 value)
+			{
+				while (value >= 0x80)
+				{
+					mBuffer.push_back(static_cast<BYTE>(value | 0x80));
+					value >>= 7;
+				}
+
+				mBuffer.push_back(static_cast<BYTE>(value));
+			}
+
+			/**
+			 * Write a null terminated string. A null pointer is written as well, and is read back as a null
+			 * pointer.
+			 *
+			 * @tparam Char: The character type.
+			 * @param pString: The string to write. Can be nullptr.
+			 */
+			template<class Char>
+			void WriteString(const Char* pString)
+			{
+				if (!pString)
+					return WriteVarInt(0);
+
+				const UI64 length = std::char_traits<Char>::length(pString);
+				WriteVarInt(length + 1);
+				WriteBytes(pString, length * sizeof(Char));
+			}
+
+		private:
+			std::vector<BYTE>& mBuffer;	// The buffer to append to.
+		};
+
+		/**
+		 * Command Reader object.
+		 * This reads back data written by a CommandWriter. Reading past the end of the data does not throw; it
+		 * marks the reader as invalid and returns zeroed values, so a truncated recording is detected with a single
+		 * check after reading a command.
+		 *
+		 * Strings are copied to a string pool owned by the caller, as the data they are read from may be released
+		 * before the command which uses them is executed.
+		 */
+		class CommandReader {
+		public:
+			/**
+			 * Construct the reader.
+			 *
+			 * @param pBegin: The first byte to read.
+			 * @param size: The number of bytes which can be read.
+			 * @param stringPool: The pool which owns the strings which are read.
+			 */
+			CommandReader(const BYTE* pBegin, UI64 size, std::vector<std::unique_ptr<BYTE[]>>& stringPool)
+				: pCurrent(pBegin), pEnd(pBegin + size), mStringPool(stringPool) {}
+			~CommandReader() {}
+
+			/**
+			 * Read raw bytes.
+			 *
+			 * @param pData: The location to read to.
+			 * @param size: The number of bytes.
+			 * @return Boolean value stating whether the bytes were available.
+			 */
+			bool ReadBytes(void* pData, UI64 size)
+			{
+				if (!bIsValid || static_cast<UI64>(pEnd - pCurrent) < size)
+				{
+					bIsValid = false;
+					std::memset(pData, 0, size);
+					return false;
+				}
+
+				if (size)
+					std::memcpy(pData, pCurrent, size);
+
+				pCurrent += size;
+				return true;
+			}
+
+			/**
+			 * Skip bytes without reading them.
+			 *
+			 * @param size: The number of bytes.
+			 * @return Boolean value stating whether the bytes were available.
+			 */
+			bool Skip(UI64 size)
+			{
+				if (!bIsValid || static_cast<UI64>(pEnd - pCurrent) < size)
+				{
+					bIsValid = false;
+					return false;
+				}
+
+				pCurrent += size;
+				return true;
+			}
+
+			/**
+			 * Read a value written by CommandWriter::Write().
+			 *
+			 * @tparam Type: The type of the value. Must be trivially copyable.
+			 * @return The value.
+			 */
+			template<class Type>
+			Type Read()
+			{
+				static_assert(std::is_trivially_copyable<Type>::value, "Only trivially copyable values can be read as bytes!");
+
+				alignas(Type) BYTE storage[sizeof(Type)];
+				ReadBytes(storage, sizeof(Type));
+				return *std::launder(reinterpret_cast<Type*>(storage));
+			}
+
+			/**
+			 * Read an unsigned integer written by CommandWriter::WriteVarInt().
+			 *
+			 * @return The value.
+			 */
+			UI64 ReadVarInt()
+			{
+				UI64 value = 0;
+				for (UI32 shift = 0; shift < 64; shift += 7)
+				{
+					BYTE byte = 0;
+					if (!ReadBytes(&byte, 1))
+						return 0;
+
+					value |= static_cast<UI64>(byte & 0x7F) << shift;
+					if (!(byte & 0x80))
+						return value;
+				}
+
+				bIsValid = false;
+				return 0;
+			}
+
+			/**
+			 * Read a string written by CommandWriter::WriteString().
+			 *
+			 * @tparam Char: The character type.
+			 * @return The string, owned by the string pool. nullptr if a null pointer was written.
+			 */
+			template<class Char>
+			const Char* ReadString()
+			{
+				const UI64 length = ReadVarInt();
+				if (!length || length - 1 > static_cast<UI64>(pEnd - pCurrent) / sizeof(Char))
+				{
+					bIsValid = bIsValid && length == 0;
+					return nullptr;
+				}
+
+				// Operator new[] aligns the storage for any character type.
+				std::unique_ptr<BYTE[]> pStorage(new BYTE[length * sizeof(Char)]);
+				ReadBytes(pStorage.get(), (length - 1) * sizeof(Char));
+
+				Char* pString = reinterpret_cast<Char*>(pStorage.get());
+				pString[length - 1] = Char();
+
+				mStringPool.push_back(std::move(pStorage));
+				return pString;
+			}
+
+			/**
+			 * Check if every read so far was within the data.
+			 *
+			 * @return Boolean value.
+			 */
+			bool IsValid() const { return bIsValid; }
+
+			/**
+			 * Get the number of bytes which are left to read.
+			 *
+			 * @return The byte count.
+			 */
+			UI64 GetRemainingSize() const { return static_cast<UI64>(pEnd - pCurrent); }
+
+		private:
+			const BYTE* pCurrent = nullptr;	// The next byte to read.
+			const BYTE* pEnd = nullptr;	// One past the last byte.
+			std::vector<std::unique_ptr<BYTE[]>>& mStringPool;	// Owner of the strings which are read.
+			bool bIsValid = true;	// Whether every read was within the data.
+		};
+
+		/**
+		 * Command Serializer trait.
+		 * This writes a command to a recording and creates it back when the recording is replayed. By default a
+		 * command is copied byte by byte, which suits commands made of plain values.
+		 *
+		 * Commands which hold pointers must specialize this trait: strings are written with WriteString(), and
+		 * pointers the backend writes its output to are replayed as nullptr, as the memory they pointed to does not
+		 * exist when the recording is replayed.
+		 *
+		 * Usage:
+		 *	template<>
+		 *	struct Thread::CommandSerializer<LoadAudioFromFile> {
+		 *		static void Serialize(CommandWriter& writer, const LoadAudioFromFile& command) { writer.WriteString(command.pAsset); }
+		 *		static LoadAudioFromFile Deserialize(CommandReader& reader) { return LoadAudioFromFile(reader.ReadString<wchar>()); }
+		 *	};
+		 *
+		 * @tparam Type: The command type.
+		 */
+		template<class Type>
+		struct CommandSerializer {
+			static_assert(std::is_trivially_copyable<Type>::value, "Specialize Thread::CommandSerializer for command types which are not trivially copyable!");
+
+			/**
+			 * Write a command.
+			 *
+			 * @param writer: The writer.
+			 * @param command: The command data.
+			 */
+			static void Serialize(CommandWriter& writer, const Type& command) { writer.Write(command); }
+
+			/**
+			 * Read a command.
+			 *
+			 * @param reader: The reader.
+			 * @return The command data.
+			 */
+			static Type Deserialize(CommandReader& reader) { return reader.Read<Type>(); }
+		};
+
+		namespace _Helpers
+		{
+			/**
+			 * Write a command recording to a file.
+			 *
+			 * @param path: The file path.
+			 * @param data: The recording.
+			 * @return Boolean value stating whether the whole recording was written.
+			 */
+			bool WriteCommandRecordingFile(const std::string& path, const std::vector<BYTE>& data);
+
+			/**
+			 * Read a command recording from a file.
+			 *
+			 * @param path: The file path.
+			 * @param data: The vector to store the recording to.
+			 * @return Boolean value stating whether the file was read.
+			 */
+			bool ReadCommandRecordingFile(const std::string& path, std::vector<BYTE>& data);
+		}
+	}
+}
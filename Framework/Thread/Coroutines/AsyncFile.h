@@ -0,0 +1,36 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "CoroutineExecutor.h"
+
+#include <string>
+#include <vector>
+
+namespace DMK
+{
+	namespace Thread
+	{
+		/**
+		 * Read a whole file.
+		 * The read is done on a worker thread of the executor and the awaiting coroutine continues there.
+		 *
+		 * @param executor: The executor.
+		 * @param path: The file path.
+		 * @return A task which returns the bytes of the file. Empty if the file could not be read.
+		 */
+		Task<std::vector<BYTE>> ReadFileAsync(CoroutineExecutor& executor, std::string path);
+
+		/**
+		 * Write a whole file, replacing it if it exists.
+		 * The write is done on a worker thread of the executor and the awaiting coroutine continues there.
+		 *
+		 * @param executor: The executor.
+		 * @param path: The file path.
+		 * @param bytes: The bytes to write.
+		 * @return A task which returns true if the file was written.
+		 */
+		Task<bool> WriteFileAsync(CoroutineExecutor& executor, std::string path, std::vector<BYTE> bytes);
+	}
+}
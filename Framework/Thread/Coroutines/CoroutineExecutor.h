@@ -0,0 +1,170 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Task.h"
+#include "Thread/Commands/CommandFuture.h"
+
+#include <chrono>
+#include <map>
+#include <thread>
+
+namespace DMK
+{
+	namespace Thread
+	{
+		/**
+		 * Coroutine Executor object.
+		 * The executor resumes coroutines on the worker threads of a job system. A coroutine moves to a worker by
+		 * awaiting Schedule(), sleeps without holding a thread by awaiting Delay(), and waits for an engine
+		 * command by awaiting Await(). Resumptions are scheduled as jobs, so coroutines and jobs share the
+		 * workers and are balanced by work stealing.
+		 *
+		 * Delays are kept by a timer thread owned by the executor, which is parked while no delay is due.
+		 * The executor must outlive the coroutines which use it.
+		 */
+		class CoroutineExecutor {
+		public:
+			/**
+			 * Schedule awaiter.
+			 */
+			struct ScheduleAwaiter {
+				bool await_ready() const noexcept { return false; }
+				void await_suspend(std::coroutine_handle<> handle) const { pExecutor->Resume(handle); }
+				void await_resume() const noexcept {}
+
+				CoroutineExecutor* pExecutor = nullptr;	// The executor.
+			};
+
+			/**
+			 * Delay awaiter.
+			 */
+			struct DelayAwaiter {
+				bool await_ready() const noexcept { return mResumeTime <= std::chrono::steady_clock::now(); }
+				void await_suspend(std::coroutine_handle<> handle) const { pExecutor->AddTimer(mResumeTime, handle); }
+				void await_resume() const noexcept {}
+
+				CoroutineExecutor* pExecutor = nullptr;	// The executor.
+				std::chrono::steady_clock::time_point mResumeTime = {};	// When to resume.
+			};
+
+			/**
+			 * Command awaiter.
+			 * Resumes with the future once the command completes. If it completes while suspending, the coroutine
+			 * continues directly rather than being resumed from within await_suspend(), which would nest a stack
+			 * frame per await.
+			 */
+			template<class Result>
+			struct CommandAwaiter {
+				bool await_ready() const { return mFuture.IsReady(); }
+
+				bool await_suspend(std::coroutine_handle<> handle) const
+				{
+					if (pExecutor)
+						return mFuture.TryThen(pExecutor->GetJobSystem(), [handle](const CommandFuture<Result>&) { handle.resume(); });
+
+					return mFuture.TryThen([handle](const CommandFuture<Result>&) { handle.resume(); });
+				}
+
+				CommandFuture<Result> await_resume() const { return mFuture; }
+
+				CommandFuture<Result> mFuture;	// The future of the command.
+				CoroutineExecutor* pExecutor = nullptr;	// The executor. nullptr resumes on the completing thread.
+			};
+
+			/**
+			 * Construct the executor and start its timer thread.
+			 *
+			 * @param system: The job system to resume coroutines on.
+			 */
+			explicit CoroutineExecutor(JobSystem& system);
+
+			/**
+			 * Stop the timer thread. No delay may be pending.
+			 */
+			~CoroutineExecutor();
+
+			CoroutineExecutor(const CoroutineExecutor&) = delete;
+			CoroutineExecutor& operator=(const CoroutineExecutor&) = delete;
+
+			/**
+			 * Get the job system.
+			 *
+			 * @return The job system reference.
+			 */
+			JobSystem& GetJobSystem() const { return mSystem; }
+
+			/**
+			 * Continue the awaiting coroutine on a worker thread.
+			 *
+			 * @return The awaiter.
+			 */
+			ScheduleAwaiter Schedule() { return { this }; }
+
+			/**
+			 * Continue the awaiting coroutine on a worker thread after a duration.
+			 *
+			 * @param duration: The duration.
+			 * @return The awaiter.
+			 */
+			template<class Rep, class Period>
+			DelayAwaiter Delay(std::chrono::duration<Rep, Period> duration)
+			{
+				return { this, std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(duration) };
+			}
+
+			/**
+			 * Continue the awaiting coroutine on a worker thread once a command completes.
+			 * The result of the co_await is the future.
+			 *
+			 * @param future: The future of the command.
+			 * @return The awaiter.
+			 */
+			template<class Result>
+			CommandAwaiter<Result> Await(CommandFuture<Result> future) { return { std::move(future), this }; }
+
+			/**
+			 * Start a task on a worker thread without awaiting it.
+			 * Exceptions thrown by the task are discarded.
+			 *
+			 * @param task: The task.
+			 */
+			void Spawn(Task<void>&& task);
+
+		private:
+			/**
+			 * Schedule a coroutine to resume on a worker thread.
+			 */
+			void Resume(std::coroutine_handle<> handle)
+			{
+				mSystem.Schedule([handle] { handle.resume(); });
+			}
+
+			void AddTimer(std::chrono::steady_clock::time_point resumeTime, std::coroutine_handle<> handle);
+			void TimerFunction();
+
+			JobSystem& mSystem;	// The job system.
+
+			std::multimap<std::chrono::steady_clock::time_point, std::coroutine_handle<>> mTimers;	// Pending delays, by resume time.
+			std::mutex mTimerMutex;	// Guards the timers.
+			std::condition_variable mTimerCondition;	// The timer thread waits on this.
+			bool bIsRunning = true;	// Whether the timer thread should keep running.
+			std::thread mTimerThread;	// The timer thread.
+		};
+
+		/**
+		 * Await a command on the thread which completes it, usually the backend thread.
+		 * The coroutine must only do a little work before moving to a worker, as it holds up the backend. Use
+		 * CoroutineExecutor::Await() to continue on a worker instead.
+		 *
+		 * @param future: The future of the command.
+		 * @return The awaiter. The result of the co_await is the future.
+		 */
+		template<class Result>
+		CoroutineExecutor::CommandAwaiter<Result> operator co_await(CommandFuture<Result> future)
+		{
+			return { std::move(future), nullptr };
+		}
+	}
+}
@@ -0,0 +1,45 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Core/Types/DataTypes.h"
+
+namespace DMK
+{
+	namespace Thread
+	{
+		/**
+		 * Coroutine Frame Pool object.
+		 * Coroutine frames of the tasks are allocated from here. Freed frames are kept in per thread free lists,
+		 * one for every power of two size class from 64 bytes to 8 KiB, so a steady state of creating and
+		 * completing tasks does not touch the global heap. A frame can be freed on a different thread than the
+		 * one which allocated it, which is the common case when tasks move between workers.
+		 *
+		 * Frames larger than the largest size class are allocated from the global heap.
+		 */
+		class CoroutineFramePool {
+		public:
+			static constexpr UI64 SmallestFrameSize = 64;	// Size of the smallest size class.
+			static constexpr UI64 SizeClassCount = 8;	// Number of size classes.
+			static constexpr UI64 LargestFrameSize = SmallestFrameSize << (SizeClassCount - 1);	// Size of the largest size class.
+			static constexpr UI64 MaximumCachedFrames = 256;	// Frames kept per size class and thread.
+
+			/**
+			 * Allocate a frame.
+			 *
+			 * @param size: The frame size in bytes.
+			 * @return The frame pointer.
+			 */
+			static void* Allocate(UI64 size);
+
+			/**
+			 * Free a frame.
+			 *
+			 * @param pFrame: The frame pointer.
+			 * @param size: The size which was allocated.
+			 */
+			static void Deallocate(void* pFrame, UI64 size);
+		};
+	}
+}
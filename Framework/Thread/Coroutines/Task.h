@@ -0,0 +1,341 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "CoroutineFramePool.h"
+#include "Thread/Commands/CommandCompletion.h"
+
+#include <cassert>
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <optional>
+
+namespace DMK
+{
+	namespace Thread
+	{
+		template<class Type> class Task;
+
+		namespace _Helpers
+		{
+			/**
+			 * Task promise base.
+			 * Tasks start suspended and resume the coroutine awaiting them when they complete, by symmetric
+			 * transfer, so awaiting a chain of tasks does not grow the stack.
+			 */
+			class TaskPromiseBase {
+				/**
+				 * Final awaiter. Transfers to the awaiting coroutine.
+				 */
+				struct FinalAwaiter {
+					bool await_ready() const noexcept { return false; }
+
+					template<class Promise>
+					std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+					{
+						const std::coroutine_handle<> continuation = handle.promise().mContinuation;
+						return continuation ? continuation : std::noop_coroutine();
+					}
+
+					void await_resume() const noexcept {}
+				};
+
+			public:
+				std::suspend_always initial_suspend() const noexcept { return {}; }
+				FinalAwaiter final_suspend() const noexcept { return {}; }
+				void unhandled_exception() noexcept { pException = std::current_exception(); }
+
+				/**
+				 * Coroutine frames are allocated from the frame pool.
+				 */
+				static void* operator new(std::size_t size) { return CoroutineFramePool::Allocate(size); }
+				static void operator delete(void* pFrame, std::size_t size) { CoroutineFramePool::Deallocate(pFrame, size); }
+
+				/**
+				 * Rethrow the exception thrown by the task, if any.
+				 */
+				void RethrowException() const
+				{
+					if (pException)
+						std::rethrow_exception(pException);
+				}
+
+				std::coroutine_handle<> mContinuation = nullptr;	// The coroutine awaiting the task.
+				std::exception_ptr pException = nullptr;	// The exception thrown by the task.
+				bool bIsStarted = false;	// Whether the task was started by an awaiter.
+			};
+
+			/**
+			 * Task promise.
+			 */
+			template<class Type>
+			class TaskPromise : public TaskPromiseBase {
+			public:
+				Task<Type> get_return_object() noexcept;
+
+				template<class Value>
+				void return_value(Value&& value) { mValue.emplace(std::forward<Value>(value)); }
+
+				/**
+				 * Get the result, rethrowing the exception thrown by the task.
+				 */
+				Type& GetResult()
+				{
+					RethrowException();
+					return *mValue;
+				}
+
+			private:
+				std::optional<Type> mValue;	// The result.
+			};
+
+			template<>
+			class TaskPromise<void> : public TaskPromiseBase {
+			public:
+				Task<void> get_return_object() noexcept;
+
+				void return_void() const noexcept {}
+
+				/**
+				 * Rethrow the exception thrown by the task.
+				 */
+				void GetResult() const { RethrowException(); }
+			};
+
+			/**
+			 * Task ready awaiter.
+			 * Starts a task and resumes once it completes, without getting its result. Used by the combinators.
+			 * A task has a single continuation, so it must not already be started unless it has completed.
+			 */
+			struct TaskReadyAwaiter {
+				bool await_ready() const noexcept { return !mHandle || mHandle.done(); }
+
+				std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept
+				{
+					assert(!pPromise->bIsStarted && "The task is already running!");
+
+					pPromise->bIsStarted = true;
+					pPromise->mContinuation = continuation;
+					return mHandle;
+				}
+
+				void await_resume() const noexcept {}
+
+				std::coroutine_handle<> mHandle = nullptr;	// The task coroutine.
+				TaskPromiseBase* pPromise = nullptr;	// The promise of the task.
+			};
+
+			/**
+			 * Detached task.
+			 * A coroutine which starts immediately and frees itself once it completes. Used to run tasks nobody
+			 * awaits.
+			 */
+			struct DetachedTask {
+				struct promise_type {
+					DetachedTask get_return_object() const noexcept { return {}; }
+					std::suspend_never initial_suspend() const noexcept { return {}; }
+					std::suspend_never final_suspend() const noexcept { return {}; }
+					void return_void() const noexcept {}
+					void unhandled_exception() const noexcept { std::terminate(); }
+
+					static void* operator new(std::size_t size) { return CoroutineFramePool::Allocate(size); }
+					static void operator delete(void* pFrame, std::size_t size) { CoroutineFramePool::Deallocate(pFrame, size); }
+				};
+			};
+		}
+
+		/**
+		 * Task object.
+		 * A task is a coroutine which returns a value (or void) and is started when it is awaited. The awaiting
+		 * coroutine is resumed on the thread which completes the task. A task switches threads by awaiting a
+		 * CoroutineExecutor, for example co_await executor.Schedule() to continue on a worker of the job system.
+		 *
+		 * Usage:
+		 *	Thread::Task<UI64> LoadMesh(Thread::CoroutineExecutor& executor, const char* pPath)
+		 *	{
+		 *		auto bytes = co_await ReadFileAsync(executor, pPath);
+		 *		co_return ParseMesh(bytes);
+		 *	}
+		 *
+		 * Tasks are move only. Exceptions thrown by a task are rethrown to the coroutine which awaits it.
+		 *
+		 * @tparam Type: The result type. Default is void.
+		 */
+		template<class Type = void>
+		class [[nodiscard]] Task {
+		public:
+			using promise_type = _Helpers::TaskPromise<Type>;
+			using ResultType = Type;
+
+			Task() {}
+
+			/**
+			 * Construct the task using its coroutine handle.
+			 *
+			 * @param handle: The coroutine handle.
+			 */
+			explicit Task(std::coroutine_handle<promise_type> handle) : mHandle(handle) {}
+
+			Task(Task&& other) noexcept : mHandle(other.mHandle) { other.mHandle = nullptr; }
+
+			Task& operator=(Task&& other) noexcept
+			{
+				if (this != &other)
+				{
+					if (mHandle)
+						mHandle.destroy();
+
+					mHandle = other.mHandle;
+					other.mHandle = nullptr;
+				}
+
+				return *this;
+			}
+
+			/**
+			 * Destroy the coroutine. The task must not be running.
+			 */
+			~Task()
+			{
+				if (mHandle)
+					mHandle.destroy();
+			}
+
+			Task(const Task&) = delete;
+			Task& operator=(const Task&) = delete;
+
+			/**
+			 * Check if the task has a coroutine.
+			 *
+			 * @return Boolean value.
+			 */
+			bool IsValid() const { return mHandle != nullptr; }
+
+			/**
+			 * Check if the task has completed.
+			 *
+			 * @return Boolean value.
+			 */
+			bool IsReady() const { return !mHandle || mHandle.done(); }
+
+			/**
+			 * Get the result of a completed task.
+			 * This rethrows the exception thrown by the task.
+			 *
+			 * @return The result.
+			 */
+			decltype(auto) GetResult() const { return mHandle.promise().GetResult(); }
+
+			/**
+			 * Get an awaiter which starts the task and resumes once it completes, without getting the result.
+			 * The task must not already be started, unless it has completed.
+			 *
+			 * @return The awaiter.
+			 */
+			_Helpers::TaskReadyAwaiter WhenReady() const { return { mHandle, mHandle ? &mHandle.promise() : nullptr }; }
+
+			/**
+			 * Start the task and get its result once it completes.
+			 * The task must not already be started, unless it has completed.
+			 */
+			auto operator co_await() const& noexcept
+			{
+				struct Awaiter : _Helpers::TaskReadyAwaiter {
+					decltype(auto) await_resume() const { return std::coroutine_handle<promise_type>::from_address(mHandle.address()).promise().GetResult(); }
+				};
+
+				return Awaiter{ WhenReady() };
+			}
+
+			/**
+			 * Start the task and get its result once it completes.
+			 * The task must not already be started, unless it has completed. The result is moved out of an rvalue task.
+			 */
+			auto operator co_await() const&& noexcept
+			{
+				struct Awaiter : _Helpers::TaskReadyAwaiter {
+					decltype(auto) await_resume() const
+					{
+						if constexpr (std::is_void_v<Type>)
+							return std::coroutine_handle<promise_type>::from_address(mHandle.address()).promise().GetResult();
+						else
+							return std::move(std::coroutine_handle<promise_type>::from_address(mHandle.address()).promise().GetResult());
+					}
+				};
+
+				return Awaiter{ WhenReady() };
+			}
+
+		private:
+			std::coroutine_handle<promise_type> mHandle = nullptr;	// The coroutine handle.
+		};
+
+		namespace _Helpers
+		{
+			template<class Type>
+			Task<Type> TaskPromise<Type>::get_return_object() noexcept
+			{
+				return Task<Type>(std::coroutine_handle<TaskPromise<Type>>::from_promise(*this));
+			}
+
+			inline Task<void> TaskPromise<void>::get_return_object() noexcept
+			{
+				return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+			}
+
+			/**
+			 * Get the result of a completed task as a value, using NoResult for void tasks.
+			 */
+			template<class Type>
+			auto GetTaskValue(const Task<Type>& task)
+			{
+				if constexpr (std::is_void_v<Type>)
+				{
+					task.GetResult();
+					return NoResult();
+				}
+				else
+					return std::move(task.GetResult());
+			}
+		}
+
+		/**
+		 * Start a task and block the calling thread till it completes.
+		 * This is how threads which are not coroutines wait for tasks, for example the main thread. It must not
+		 * be called on a worker thread of the job system the task runs on, as that worker would be blocked.
+		 *
+		 * @param task: The task.
+		 * @return The result of the task.
+		 */
+		template<class Type>
+		Type SyncWait(Task<Type>&& task)
+		{
+			std::mutex mutex;
+			std::condition_variable condition;
+			bool bIsComplete = false;
+
+			// The flag is set under the lock, so this thread cannot return before the runner is done with them.
+			[](const Task<Type>& task, std::mutex& mutex, std::condition_variable& condition, bool& bIsComplete) -> _Helpers::DetachedTask
+			{
+				co_await task.WhenReady();
+
+				std::lock_guard<std::mutex> lock(mutex);
+				bIsComplete = true;
+				condition.notify_all();
+			}(task, mutex, condition, bIsComplete);
+
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				condition.wait(lock, [&bIsComplete] { return bIsComplete; });
+			}
+
+			if constexpr (std::is_void_v<Type>)
+				task.GetResult();
+			else
+				return std::move(task.GetResult());
+		}
+	}
+}
@@ -0,0 +1,125 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Task.h"
+
+#include <atomic>
+#include <tuple>
+#include <vector>
+
+namespace DMK
+{
+	namespace Thread
+	{
+		namespace _Helpers
+		{
+			/**
+			 * When All awaiter.
+			 * Starts a number of tasks and resumes once all of them have completed. The counter starts one higher
+			 * than the number of tasks and the awaiter removes the extra count after starting them all, so the
+			 * awaiting coroutine is not resumed while it is still starting tasks.
+			 */
+			class WhenAllAwaiter {
+			public:
+				explicit WhenAllAwaiter(std::vector<TaskReadyAwaiter>&& awaiters) : mAwaiters(std::move(awaiters)) {}
+
+				bool await_ready() const noexcept { return mAwaiters.empty(); }
+
+				bool await_suspend(std::coroutine_handle<> handle)
+				{
+					mContinuation = handle;
+					mRemainingCount.store(mAwaiters.size() + 1, std::memory_order_relaxed);
+
+					for (const TaskReadyAwaiter& awaiter : mAwaiters)
+						Run(awaiter, this);
+
+					return mRemainingCount.fetch_sub(1, std::memory_order_acq_rel) != 1;
+				}
+
+				void await_resume() const noexcept {}
+
+			private:
+				/**
+				 * Await a task and resume the awaiting coroutine if it was the last one.
+				 */
+				static DetachedTask Run(TaskReadyAwaiter awaiter, WhenAllAwaiter* pWhenAll)
+				{
+					co_await awaiter;
+
+					if (pWhenAll->mRemainingCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+						pWhenAll->mContinuation.resume();
+				}
+
+				std::vector<TaskReadyAwaiter> mAwaiters;	// The tasks.
+				std::atomic<UI64> mRemainingCount = { 0 };	// Tasks which have not completed, plus one while starting.
+				std::coroutine_handle<> mContinuation = nullptr;	// The awaiting coroutine.
+			};
+		}
+
+		/**
+		 * Run tasks concurrently and wait for all of them.
+		 * The tasks are started on the calling thread and run concurrently once they move to other threads, for
+		 * example by awaiting CoroutineExecutor::Schedule().
+		 *
+		 * @param tasks: The tasks.
+		 * @return A task which returns the results, in the order of the tasks.
+		 */
+		template<class Type>
+		Task<std::vector<Type>> WhenAll(std::vector<Task<Type>> tasks)
+		{
+			std::vector<_Helpers::TaskReadyAwaiter> awaiters;
+			awaiters.reserve(tasks.size());
+			for (const Task<Type>& task : tasks)
+				awaiters.push_back(task.WhenReady());
+
+			co_await _Helpers::WhenAllAwaiter(std::move(awaiters));
+
+			std::vector<Type> results;
+			results.reserve(tasks.size());
+			for (const Task<Type>& task : tasks)
+				results.push_back(std::move(task.GetResult()));
+
+			co_return results;
+		}
+
+		/**
+		 * Run tasks concurrently and wait for all of them.
+		 * The first exception thrown by the tasks, in their order, is rethrown.
+		 *
+		 * @param tasks: The tasks.
+		 * @return A task which completes once all of them completed.
+		 */
+		inline Task<void> WhenAll(std::vector<Task<void>> tasks)
+		{
+			std::vector<_Helpers::TaskReadyAwaiter> awaiters;
+			awaiters.reserve(tasks.size());
+			for (const Task<void>& task : tasks)
+				awaiters.push_back(task.WhenReady());
+
+			co_await _Helpers::WhenAllAwaiter(std::move(awaiters));
+
+			for (const Task<void>& task : tasks)
+				task.GetResult();
+		}
+
+		/**
+		 * Run tasks of different types concurrently and wait for all of them.
+		 * Void tasks have NoResult in the result tuple.
+		 *
+		 * Usage: auto [mesh, texture] = co_await Thread::WhenAll(LoadMesh(...), LoadTexture(...));
+		 *
+		 * @param tasks: The tasks.
+		 * @return A task which returns a tuple of the results.
+		 */
+		template<class... Types>
+		auto WhenAll(Task<Types>... tasks) -> Task<std::tuple<decltype(_Helpers::GetTaskValue(tasks))...>>
+		{
+			std::vector<_Helpers::TaskReadyAwaiter> awaiters = { tasks.WhenReady()... };
+			co_await _Helpers::WhenAllAwaiter(std::move(awaiters));
+
+			co_return std::tuple<decltype(_Helpers::GetTaskValue(tasks))...>(_Helpers::GetTaskValue(tasks)...);
+		}
+	}
+}
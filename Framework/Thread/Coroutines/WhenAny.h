@@ -0,0 +1,135 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Task.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace DMK
+{
+	namespace Thread
+	{
+		/**
+		 * Index returned by WhenAny() when it is given no tasks.
+		 */
+		constexpr UI64 InvalidTaskIndex = ~0ull;
+
+		/**
+		 * When Any Result structure.
+		 *
+		 * @tparam Type: The result type of the tasks.
+		 */
+		template<class Type>
+		struct WhenAnyResult {
+			UI64 mIndex = 0;	// The index of the first task to complete.
+			Type mValue = {};	// Its result.
+		};
+
+		namespace _Helpers
+		{
+			/**
+			 * When Any state.
+			 * The tasks which did not complete first keep running after the awaiting coroutine resumes, so the
+			 * tasks are owned by this state, which is shared with the coroutine running every task.
+			 */
+			template<class Type>
+			struct WhenAnyState {
+				std::vector<Task<Type>> mTasks;	// The tasks.
+				std::atomic<bool> bHasWinner = { false };	// Whether a task completed.
+				std::atomic<UI32> mResumeCount = { 2 };	// The first task to complete and the awaiter both decrement this.
+				UI64 mIndex = 0;	// The index of the first task to complete.
+				std::coroutine_handle<> mContinuation = nullptr;	// The awaiting coroutine.
+			};
+
+			/**
+			 * When Any awaiter.
+			 * Starts the tasks and resumes once the first one completes.
+			 */
+			template<class Type>
+			class WhenAnyAwaiter {
+			public:
+				explicit WhenAnyAwaiter(std::shared_ptr<WhenAnyState<Type>> pState) : pState(std::move(pState)) {}
+
+				bool await_ready() const noexcept { return false; }
+
+				bool await_suspend(std::coroutine_handle<> handle)
+				{
+					// The coroutine may be resumed and destroy this awaiter before the loop ends, so use a copy.
+					const std::shared_ptr<WhenAnyState<Type>> pLocalState = pState;
+					pLocalState->mContinuation = handle;
+
+					for (UI64 index = 0; index < pLocalState->mTasks.size(); index++)
+						Run(pLocalState, index);
+
+					return pLocalState->mResumeCount.fetch_sub(1, std::memory_order_acq_rel) != 1;
+				}
+
+				UI64 await_resume() const noexcept { return pState->mIndex; }
+
+			private:
+				/**
+				 * Await a task and resume the awaiting coroutine if it was the first one.
+				 */
+				static DetachedTask Run(std::shared_ptr<WhenAnyState<Type>> pState, UI64 index)
+				{
+					co_await pState->mTasks[index].WhenReady();
+
+					if (pState->bHasWinner.exchange(true, std::memory_order_acq_rel))
+						co_return;
+
+					pState->mIndex = index;
+					if (pState->mResumeCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+						pState->mContinuation.resume();
+				}
+
+				std::shared_ptr<WhenAnyState<Type>> pState = nullptr;	// The shared state.
+			};
+		}
+
+		/**
+		 * Run tasks concurrently and wait for the first one to complete.
+		 * The other tasks keep running, and their results and exceptions are discarded.
+		 *
+		 * @param tasks: The tasks.
+		 * @return A task which returns the index and the result of the first task to complete. The index is
+		 * InvalidTaskIndex and the result is Type() if there are no tasks.
+		 */
+		template<class Type>
+		Task<WhenAnyResult<Type>> WhenAny(std::vector<Task<Type>> tasks)
+		{
+			if (tasks.empty())
+				co_return WhenAnyResult<Type>{ InvalidTaskIndex, Type() };
+
+			auto pState = std::make_shared<_Helpers::WhenAnyState<Type>>();
+			pState->mTasks = std::move(tasks);
+
+			const UI64 index = co_await _Helpers::WhenAnyAwaiter<Type>(pState);
+			co_return WhenAnyResult<Type>{ index, std::move(pState->mTasks[index].GetResult()) };
+		}
+
+		/**
+		 * Run tasks concurrently and wait for the first one to complete.
+		 * The other tasks keep running, and their exceptions are discarded.
+		 *
+		 * @param tasks: The tasks.
+		 * @return A task which returns the index of the first task to complete. InvalidTaskIndex if there are no
+		 * tasks.
+		 */
+		inline Task<UI64> WhenAny(std::vector<Task<void>> tasks)
+		{
+			if (tasks.empty())
+				co_return InvalidTaskIndex;
+
+			auto pState = std::make_shared<_Helpers::WhenAnyState<void>>();
+			pState->mTasks = std::move(tasks);
+
+			const UI64 index = co_await _Helpers::WhenAnyAwaiter<void>(pState);
+			pState->mTasks[index].GetResult();
+			co_return index;
+		}
+	}
+}
@@ -0,0 +1,142 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Utilities.h"
+#include "Core/Benchmark/LatencyRecorder.h"
+
+namespace DMK
+{
+	namespace Thread
+	{
+		/**
+		 * Frame Pacer Statistics structure.
+		 * The jitter of a frame is how late the pacer returned after the frame's deadline.
+		 */
+		struct FramePacerStatistics {
+			UI64 mFrameCount = 0;	// Number of frames waited for.
+			UI64 mMissedFrameCount = 0;	// Number of deadlines skipped because a frame took longer than a period.
+			Utilities::Duration mMeanJitter = Utilities::Duration::zero();	// Mean jitter.
+			Utilities::Duration mJitterStandardDeviation = Utilities::Duration::zero();	// Standard deviation of the jitter.
+			Utilities::Duration mMedianJitter = Utilities::Duration::zero();	// 50th percentile of the jitter.
+			Utilities::Duration mPercentile99Jitter = Utilities::Duration::zero();	// 99th percentile of the jitter.
+			Utilities::Duration mMaxJitter = Utilities::Duration::zero();	// Highest jitter.
+		};
+
+		/**
+		 * Frame Pacer object.
+		 * This runs a loop at a fixed rate. The deadlines are absolute: deadline n is the start time plus n periods,
+		 * so the time taken by the frames and the wake up latency do not make the loop drift. If a frame takes
+		 * longer than a period, the deadlines it overran are skipped instead of being run back to back.
+		 *
+		 * Every wait sleeps with Utilities::SleepUntil(), which spins the last part of the wait. The spin threshold
+		 * trades CPU time for jitter, and it can be tuned per pacer.
+		 *
+		 * This object is not thread safe. It belongs to the thread which runs the loop.
+		 */
+		class FramePacer {
+		public:
+			/**
+			 * Construct the pacer.
+			 *
+			 * @param period: The time between two frames.
+			 * @param spinThreshold: How long to spin before a deadline. Default is Utilities::DefaultSpinThreshold.
+			 */
+			FramePacer(Utilities::Duration period, Utilities::Duration spinThreshold = Utilities::DefaultSpinThreshold)
+				: mPeriod(period), mSpinThreshold(spinThreshold) {}
+			~FramePacer() {}
+
+			/**
+			 * Start pacing. The first deadline is one period from now, and the statistics are reset.
+			 * On Linux this also lowers the timer slack of the calling thread, so that its sleeps are not delayed
+			 * by the default 50 microseconds.
+			 */
+			void Start();
+
+			/**
+			 * Sleep until the next deadline and record how late the wake up was.
+			 *
+			 * @return The number of deadlines which were missed before this one. 0 if the frame was on time.
+			 */
+			UI64 WaitForNextFrame();
+
+			/**
+			 * Run a function once every period until it returns false.
+			 *
+			 * @param function: The function, called as bool function().
+			 */
+			template<class Function>
+			void Run(Function&& function)
+			{
+				Start();
+				while (function())
+					WaitForNextFrame();
+			}
+
+			/**
+			 * Set the period. It applies from the next deadline on.
+			 *
+			 * @param period: The time between two frames.
+			 */
+			void SetPeriod(Utilities::Duration period) { mPeriod = period; }
+
+			/**
+			 * Get the period.
+			 *
+			 * @return The time between two frames.
+			 */
+			Utilities::Duration GetPeriod() const { return mPeriod; }
+
+			/**
+			 * Set the spin threshold.
+			 *
+			 * @param spinThreshold: How long to spin before a deadline.
+			 */
+			void SetSpinThreshold(Utilities::Duration spinThreshold) { mSpinThreshold = spinThreshold; }
+
+			/**
+			 * Get the spin threshold.
+			 *
+			 * @return How long the pacer spins before a deadline.
+			 */
+			Utilities::Duration GetSpinThreshold() const { return mSpinThreshold; }
+
+			/**
+			 * Get the next deadline.
+			 *
+			 * @return The time point.
+			 */
+			Utilities::TimePoint GetNextDeadline() const { return mNextDeadline; }
+
+			/**
+			 * Get the jitter statistics since the pacer was started or the statistics were reset.
+			 *
+			 * @return The statistics.
+			 */
+			FramePacerStatistics GetStatistics() const;
+
+			/**
+			 * Get the histogram of the jitter, in nanoseconds.
+			 *
+			 * @return The histogram.
+			 */
+			const Benchmark::LatencyHistogram& GetJitterHistogram() const { return mJitterHistogram; }
+
+			/**
+			 * Clear the jitter statistics.
+			 */
+			void ResetStatistics();
+
+		private:
+			Benchmark::LatencyHistogram mJitterHistogram;	// Jitter of every frame.
+			double mJitterMean = 0.0;	// Running mean of the jitter, in nanoseconds.
+			double mJitterSquaredDistance = 0.0;	// Running sum of the squared distances from the mean.
+			UI64 mMissedFrameCount = 0;	// Number of skipped deadlines.
+
+			Utilities::TimePoint mNextDeadline = {};	// When the next frame begins.
+			Utilities::Duration mPeriod = Utilities::Duration::zero();	// Time between two frames.
+			Utilities::Duration mSpinThreshold = Utilities::DefaultSpinThreshold;	// How long to spin before a deadline.
+		};
+	}
+}
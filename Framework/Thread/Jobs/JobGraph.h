@@ -0,0 +1,77 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "JobSystem.h"
+
+#include <functional>
+#include <vector>
+
+namespace DMK
+{
+	namespace Thread
+	{
+		/**
+		 * Job Graph object.
+		 * A reusable set of jobs with dependencies between them, for example the systems updated every frame.
+		 * Each execution schedules the nodes without dependencies, and a node is scheduled by the last of its
+		 * dependencies to complete. The graph must not contain cycles.
+		 */
+		class JobGraph {
+		public:
+			JobGraph() {}
+			~JobGraph() {}
+
+			/**
+			 * Add a node to the graph.
+			 *
+			 * @param function: The function to execute.
+			 * @return The node index.
+			 */
+			UI64 AddNode(std::function<void()> function);
+
+			/**
+			 * Make a node wait for another one.
+			 *
+			 * @param dependency: The node which must complete first.
+			 * @param node: The node which depends on it.
+			 */
+			void AddDependency(UI64 dependency, UI64 node);
+
+			/**
+			 * Get the number of nodes.
+			 *
+			 * @return The node count.
+			 */
+			UI64 GetNodeCount() const { return mNodes.size(); }
+
+			/**
+			 * Execute the graph and wait for all the nodes to complete.
+			 * The graph must not be modified or executed again while it executes.
+			 *
+			 * @param system: The job system to execute on.
+			 */
+			void Execute(JobSystem& system);
+
+		private:
+			/**
+			 * Node structure.
+			 */
+			struct Node {
+				std::function<void()> mFunction;	// The node function.
+				std::vector<UI64> mDependents;	// Nodes which depend on this one.
+				UI32 mDependencyCount = 0;	// Number of nodes this one depends on.
+			};
+
+			/**
+			 * Schedule a node whose dependencies have completed.
+			 */
+			void ScheduleNode(JobSystem& system, UI64 index, JobCounter& counter);
+
+			std::vector<Node> mNodes;	// The nodes.
+			std::unique_ptr<std::atomic<UI32>[]> pRemainingDependencies;	// Dependencies left per node while executing.
+			UI64 mRemainingDependencyCount = 0;	// Size of the array above.
+		};
+	}
+}
@@ -0,0 +1,265 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "WorkStealingDeque.h"
+#include "Thread/ThreadCreation.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace DMK
+{
+	namespace Thread
+	{
+		/**
+		 * Size of the storage a job has for its function object, in bytes.
+		 * Functions capturing more than this should capture a pointer to their data instead.
+		 */
+		constexpr UI64 JobStorageSize = 64;
+
+		/**
+		 * Thread index returned for threads which do not belong to a job system.
+		 */
+		constexpr UI32 InvalidJobThreadIndex = ~0u;
+
+		/**
+		 * Worker count which selects JobSystem::GetDefaultWorkerCount().
+		 */
+		constexpr UI32 DefaultJobWorkerCount = ~0u;
+
+		class JobSystem;
+		class JobCounter;
+
+		/**
+		 * Job structure.
+		 * Jobs are created by the job system and recycled after they are executed.
+		 */
+		struct Job {
+			void (*pInvoke)(Job& job) = nullptr;	// Calls and then destroys the function object.
+			JobCounter* pCounter = nullptr;	// The counter decremented once the job completes.
+			Job* pNext = nullptr;	// Free list and continuation list link.
+			UI32 mOwnerIndex = 0;	// The thread whose pool the job belongs to.
+			alignas(alignof(std::max_align_t)) BYTE mStorage[JobStorageSize] = {};	// The function object.
+		};
+
+		/**
+		 * Job Counter object.
+		 * A counter holds the number of unfinished jobs which were scheduled with it. Threads wait on counters, and
+		 * jobs can be scheduled to run after a counter reaches zero, which is how job graphs are expressed.
+		 *
+		 * A counter must outlive the jobs scheduled with it. It can be reused after it reaches zero.
+		 */
+		class JobCounter {
+		public:
+			JobCounter() {}
+			~JobCounter() {}
+
+			JobCounter(const JobCounter&) = delete;
+			JobCounter& operator=(const JobCounter&) = delete;
+
+			/**
+			 * Check if all the jobs of the counter have completed.
+			 *
+			 * @return Boolean value.
+			 */
+			bool IsComplete() const { return mValue.load(std::memory_order_acquire) == 0; }
+
+		private:
+			friend class JobSystem;
+
+			/**
+			 * Added while the last job completes and schedules the continuations. The counter is not complete until
+			 * this is removed, so a waiter cannot destroy it while it is still in use.
+			 */
+			static constexpr I64 CompletingUnit = I64(1) << 40;
+			static constexpr I64 PendingMask = CompletingUnit - 1;
+
+			alignas(DMK_CACHE_LINE_SIZE) std::atomic<I64> mValue = { 0 };	// Unfinished jobs.
+			std::mutex mContinuationMutex;	// Guards the continuation list.
+			Job* pContinuations = nullptr;	// Jobs scheduled to run after the counter reaches zero.
+		};
+
+		/**
+		 * Job System Create Info structure.
+		 */
+		struct JobSystemCreateInfo {
+			UI32 mWorkerCount = DefaultJobWorkerCount;	// The number of worker threads.
+			bool bShouldPinWorkers = false;	// Pin every thread, including the creating one, to its own logical processor.
+			I32 mNUMANode = -1;	// Keep the workers and their memory on a NUMA node, by topology index. -1 for all the nodes.
+			ThreadPriority mWorkerPriority = ThreadPriority::NORMAL;	// The priority of the worker threads.
+		};
+
+		/**
+		 * Job System object.
+		 * This is a work stealing scheduler. Every thread owns a Chase-Lev deque. Jobs scheduled by a thread are
+		 * pushed to its own deque and popped in last in first out order, and idle threads steal the oldest jobs
+		 * from the other deques. Threads which do not belong to the system submit to a shared queue.
+		 *
+		 * The thread which creates the system is thread 0 and it participates by executing jobs while it waits on
+		 * a counter. Idle worker threads spin briefly and then park until new jobs are scheduled.
+		 *
+		 * Job function objects are stored inline in recycled job objects, so scheduling does not allocate.
+		 *
+		 * Threads are placed using the CPU topology. Thread i takes the i-th processor of the placement order, so
+		 * threads get a core of their own before SMT siblings are used, and a thread looking for work steals from
+		 * the threads sharing its L3 cache first.
+		 */
+		class JobSystem {
+		public:
+			/**
+			 * Construct the job system and start the worker threads.
+			 * The calling thread becomes thread 0 of the system.
+			 *
+			 * @param workerCount: The number of worker threads. Default is GetDefaultWorkerCount().
+			 */
+			JobSystem(UI32 workerCount = GetDefaultWorkerCount());
+
+			/**
+			 * Construct the job system and start the worker threads.
+			 * The calling thread becomes thread 0 of the system. It is pinned too if the workers are pinned, until
+			 * the system is destroyed.
+			 *
+			 * @param createInfo: The job system create info.
+			 */
+			JobSystem(const JobSystemCreateInfo& createInfo);
+
+			/**
+			 * Stop and join the worker threads, and restore the affinity of the creating thread if it was pinned.
+			 * Must be called on the thread which created the system, after waiting for all the scheduled jobs.
+			 */
+			~JobSystem();
+
+			JobSystem(const JobSystem&) = delete;
+			JobSystem& operator=(const JobSystem&) = delete;
+
+			/**
+			 * Get the default number of worker threads.
+			 * This is one less than the number of hardware threads, as the creating thread participates.
+			 *
+			 * @return The worker count.
+			 */
+			static UI32 GetDefaultWorkerCount();
+
+			/**
+			 * Get the number of worker threads.
+			 *
+			 * @return The worker count.
+			 */
+			UI32 GetWorkerCount() const { return mThreadCount - 1; }
+
+			/**
+			 * Get the number of threads executing jobs, including the creating thread.
+			 *
+			 * @return The thread count.
+			 */
+			UI32 GetThreadCount() const { return mThreadCount; }
+
+			/**
+			 * Get the index of the calling thread in the system.
+			 *
+			 * @return The thread index. InvalidJobThreadIndex if the thread does not belong to the system.
+			 */
+			UI32 GetCurrentThreadIndex() const;
+
+			/**
+			 * Schedule a job.
+			 *
+			 * @param function: The function object to execute. Its size must not exceed JobStorageSize.
+			 * @param pCounter: The counter to increment now and decrement once the job completes. Default is nullptr.
+			 */
+			template<class Function>
+			void Schedule(Function&& function, JobCounter* pCounter = nullptr)
+			{
+				Submit(CreateJob(std::forward<Function>(function), pCounter));
+			}
+
+			/**
+			 * Schedule a job to run once a counter reaches zero.
+			 * The job is scheduled immediately if the counter is already complete.
+			 *
+			 * @param dependency: The counter to wait for.
+			 * @param function: The function object to execute. Its size must not exceed JobStorageSize.
+			 * @param pCounter: The counter to increment now and decrement once the job completes. Default is nullptr.
+			 */
+			template<class Function>
+			void ScheduleAfter(JobCounter& dependency, Function&& function, JobCounter* pCounter = nullptr)
+			{
+				SubmitAfter(dependency, CreateJob(std::forward<Function>(function), pCounter));
+			}
+
+			/**
+			 * Wait until a counter reaches zero.
+			 * Threads of the system execute jobs while waiting. Other threads block.
+			 *
+			 * @param counter: The counter to wait for.
+			 */
+			void Wait(JobCounter& counter);
+
+		private:
+			struct WorkerSlot;
+
+			/**
+			 * Create a job for a function object.
+			 */
+			template<class Function>
+			Job* CreateJob(Function&& function, JobCounter* pCounter)
+			{
+				using FunctionType = typename std::decay<Function>::type;
+				static_assert(sizeof(FunctionType) <= JobStorageSize, "The job function is too large! Capture a pointer to the data instead.");
+				static_assert(alignof(FunctionType) <= alignof(std::max_align_t), "The job function is over aligned!");
+
+				Job* pJob = AllocateJob();
+				new (pJob->mStorage) FunctionType(std::forward<Function>(function));
+				pJob->pInvoke = [](Job& job)
+				{
+					FunctionType* pFunction = std::launder(reinterpret_cast<FunctionType*>(job.mStorage));
+					(*pFunction)();
+					pFunction->~FunctionType();
+				};
+
+				pJob->pCounter = pCounter;
+				if (pCounter)
+					pCounter->mValue.fetch_add(1, std::memory_order_relaxed);
+
+				return pJob;
+			}
+
+			Job* AllocateJob();
+			void FreeJob(Job* pJob);
+			void Submit(Job* pJob);
+			void SubmitAfter(JobCounter& dependency, Job* pJob);
+			Job* FindJob(UI32 threadIndex);
+			void Execute(Job* pJob);
+			void CompleteJob(JobCounter& counter);
+			bool HasWork() const;
+			void WakeWorker();
+			void Park();
+			void WorkerFunction(UI32 threadIndex);
+
+			std::unique_ptr<WorkerSlot[]> pSlots;	// Per thread state. Slot 0 is the creating thread.
+			UI32 mThreadCount = 0;	// Number of slots.
+			CPUSet mCreatorAffinity;	// Affinity of the creating thread before it was pinned. Empty if it was not pinned.
+
+			alignas(DMK_CACHE_LINE_SIZE) std::atomic<UI32> mSleepingCount = { 0 };	// Number of parked workers.
+			std::atomic<UI64> mWakeEpoch = { 0 };	// Incremented to wake parked workers.
+			std::atomic<bool> bIsRunning = { true };	// Whether the workers should keep running.
+			std::mutex mParkMutex;	// Guards parking.
+			std::condition_variable mParkCondition;	// Parked workers wait on this.
+
+			alignas(DMK_CACHE_LINE_SIZE) std::atomic<UI64> mInjectedCount = { 0 };	// Number of jobs in the shared queue.
+			std::mutex mInjectionMutex;	// Guards the shared queue.
+			Job* pInjectedHead = nullptr;	// Jobs submitted by other threads.
+			Job* pInjectedTail = nullptr;
+
+			alignas(DMK_CACHE_LINE_SIZE) std::atomic<UI32> mExternalWaiterCount = { 0 };	// Number of blocked external waiters.
+			std::mutex mWaitMutex;	// Guards external waiting.
+			std::condition_variable mWaitCondition;	// External waiters wait on this.
+		};
+	}
+}
@@ -0,0 +1,122 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "ParallelReduce.h"
+
+#include <functional>
+
+namespace DMK
+{
+	namespace Thread
+	{
+		namespace _Helpers
+		{
+			/**
+			 * Compact a range of indexes.
+			 * The first pass counts the kept indexes of every block with the vectorized reduction, the counts are
+			 * turned into output offsets on the calling thread, and the second pass writes every block from its offset.
+			 *
+			 * @param system: The job system.
+			 * @param count: The number of indexes.
+			 * @param grainSize: The number of indexes handled by one job. 0 picks one.
+			 * @param test: The function stating if an index is kept, called as test(index).
+			 * @param write: The function writing a kept index, called as write(outputIndex, index).
+			 * @return The number of kept indexes.
+			 */
+			template<class Test, class Write>
+			UI64 CompactRange(JobSystem& system, UI64 count, UI64 grainSize, const Test& test, const Write& write)
+			{
+				if (!count)
+					return 0;
+
+				// The two passes only pay off when there is more than one thread.
+				if (!grainSize)
+					grainSize = system.GetThreadCount() > 1 ? GetDefaultGrainSize(system, count) : count;
+
+				const UI64 blockCount = GetBlockCount(count, grainSize);
+				if (blockCount == 1)
+				{
+					UI64 keptCount = 0;
+					for (UI64 index = 0; index < count; index++)
+						if (test(index))
+							write(keptCount++, index);
+
+					return keptCount;
+				}
+
+				std::vector<UI64> offsets(blockCount);
+
+				ParallelFor(system, 0, blockCount, 1, [&](UI64 block)
+					{
+						const UI64 begin = block * grainSize;
+						offsets[block] = ReduceRange<UI64>(begin, std::min(begin + grainSize, count), std::plus<UI64>(), [&test](UI64 index) -> UI64
+							{
+								return test(index) ? 1 : 0;
+							});
+					});
+
+				UI64 keptCount = 0;
+				for (UI64& offset : offsets)
+				{
+					const UI64 blockKeptCount = offset;
+					offset = keptCount;
+					keptCount += blockKeptCount;
+				}
+
+				ParallelFor(system, 0, blockCount, 1, [&](UI64 block)
+					{
+						const UI64 begin = block * grainSize;
+						const UI64 end = std::min(begin + grainSize, count);
+
+						UI64 outputIndex = offsets[block];
+						for (UI64 index = begin; index < end; index++)
+							if (test(index))
+								write(outputIndex++, index);
+					});
+
+				return keptCount;
+			}
+		}
+
+		/**
+		 * Copy the elements of an array which satisfy a predicate, keeping their order (stream compaction).
+		 * The predicate is called twice for every element, so expensive tests should write flags first and compact
+		 * on the flags.
+		 *
+		 * @param system: The job system.
+		 * @param pInput: The elements.
+		 * @param count: The number of elements.
+		 * @param pOutput: The kept elements. Must have room for count elements and must not overlap pInput.
+		 * @param predicate: The predicate, called as predicate(element) from any thread.
+		 * @param grainSize: The number of elements handled by one job. Default is 0, which picks one.
+		 * @return The number of kept elements.
+		 */
+		template<class Type, class Predicate>
+		UI64 ParallelCompact(JobSystem& system, const Type* pInput, UI64 count, Type* pOutput, const Predicate& predicate, UI64 grainSize = 0)
+		{
+			return _Helpers::CompactRange(system, count, grainSize,
+				[pInput, &predicate](UI64 index) { return predicate(pInput[index]); },
+				[pInput, pOutput](UI64 outputIndex, UI64 index) { pOutput[outputIndex] = pInput[index]; });
+		}
+
+		/**
+		 * Write the indexes which satisfy a predicate, in ascending order.
+		 * This is the form used for culling, where the kept indexes select the objects to draw.
+		 *
+		 * @param system: The job system.
+		 * @param count: The number of indexes.
+		 * @param pIndexes: The kept indexes. Must have room for count indexes.
+		 * @param predicate: The predicate, called as predicate(index) from any thread.
+		 * @param grainSize: The number of indexes handled by one job. Default is 0, which picks one.
+		 * @return The number of kept indexes.
+		 */
+		template<class Index, class Predicate>
+		UI64 ParallelCompactIndexes(JobSystem& system, UI64 count, Index* pIndexes, const Predicate& predicate, UI64 grainSize = 0)
+		{
+			return _Helpers::CompactRange(system, count, grainSize, predicate,
+				[pIndexes](UI64 outputIndex, UI64 index) { pIndexes[outputIndex] = static_cast<Index>(index); });
+		}
+	}
+}
@@ -0,0 +1,123 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "JobSystem.h"
+
+namespace DMK
+{
+	namespace Thread
+	{
+		namespace _Helpers
+		{
+			/**
+			 * Get the grain size used when none is given.
+			 * This creates about four ranges per thread, which leaves room for stealing to balance uneven work.
+			 *
+			 * @param system: The job system.
+			 * @param count: The number of indexes.
+			 * @return The grain size.
+			 */
+			inline UI64 GetDefaultGrainSize(const JobSystem& system, UI64 count)
+			{
+				const UI64 grainSize = count / (static_cast<UI64>(system.GetThreadCount()) * 4);
+				return grainSize ? grainSize : 1;
+			}
+
+			/**
+			 * Get the number of blocks needed to cover a range.
+			 *
+			 * @param count: The number of indexes.
+			 * @param blockSize: The number of indexes in a block.
+			 * @return The block count.
+			 */
+			constexpr UI64 GetBlockCount(UI64 count, UI64 blockSize)
+			{
+				return (count + blockSize - 1) / blockSize;
+			}
+
+			/**
+			 * Split a range in halves until it is no larger than the grain size, scheduling the upper halves and
+			 * executing the last range on the calling thread. Thieves take the oldest, and so the largest, halves.
+			 */
+			template<class Function>
+			void SplitRange(JobSystem& system, UI64 begin, UI64 end, UI64 grainSize, const Function* pFunction, JobCounter* pCounter)
+			{
+				while (end - begin > grainSize)
+				{
+					const UI64 middle = begin + (end - begin) / 2;
+					system.Schedule([&system, middle, end, grainSize, pFunction, pCounter]
+						{
+							SplitRange(system, middle, end, grainSize, pFunction, pCounter);
+						}, pCounter);
+
+					end = middle;
+				}
+
+				(*pFunction)(begin, end);
+			}
+		}
+
+		/**
+		 * Execute a function over sub ranges of a range in parallel, and wait for it.
+		 * The calling thread executes ranges too.
+		 *
+		 * @param system: The job system.
+		 * @param begin: The first index.
+		 * @param end: One past the last index.
+		 * @param grainSize: The largest sub range. 0 picks one based on the thread count.
+		 * @param function: The function, called as function(rangeBegin, rangeEnd) from any thread.
+		 */
+		template<class Function>
+		void ParallelForRange(JobSystem& system, UI64 begin, UI64 end, UI64 grainSize, const Function& function)
+		{
+			if (begin >= end)
+				return;
+
+			if (!grainSize)
+				grainSize = _Helpers::GetDefaultGrainSize(system, end - begin);
+
+			JobCounter counter;
+			_Helpers::SplitRange(system, begin, end, grainSize, &function, &counter);
+			system.Wait(counter);
+		}
+
+		/**
+		 * Execute a function for every index of a range in parallel, and wait for it.
+		 * The calling thread executes indexes too.
+		 *
+		 * @param system: The job system.
+		 * @param begin: The first index.
+		 * @param end: One past the last index.
+		 * @param grainSize: The largest number of indexes executed by one job. 0 picks one based on the thread count.
+		 * @param function: The function, called as function(index) from any thread.
+		 */
+		template<class Function>
+		void ParallelFor(JobSystem& system, UI64 begin, UI64 end, UI64 grainSize, const Function& function)
+		{
+			ParallelForRange(system, begin, end, grainSize, [&function](UI64 rangeBegin, UI64 rangeEnd)
+				{
+					for (UI64 index = rangeBegin; index < rangeEnd; index++)
+						function(index);
+				});
+		}
+
+		/**
+		 * Execute a function for every element of a container in parallel, and wait for it.
+		 *
+		 * @param system: The job system.
+		 * @param container: The container. It must support size() and operator[].
+		 * @param function: The function, called as function(element) from any thread.
+		 * @param grainSize: The largest number of elements executed by one job. Default is 0, which picks one.
+		 */
+		template<class Container, class Function>
+		void ParallelForEach(JobSystem& system, Container& container, const Function& function, UI64 grainSize = 0)
+		{
+			ParallelFor(system, 0, static_cast<UI64>(container.size()), grainSize, [&container, &function](UI64 index)
+				{
+					function(container[index]);
+				});
+		}
+	}
+}
@@ -0,0 +1,119 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "ParallelFor.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace DMK
+{
+	namespace Thread
+	{
+		namespace _Helpers
+		{
+			/**
+			 * Number of independent accumulators used by the reduction loops.
+			 * Eight 32 bit lanes fill an AVX register, so the compiler can keep the accumulators in one.
+			 */
+			constexpr UI64 ReductionLaneCount = 8;
+
+			/**
+			 * Reduce a non empty range of indexes.
+			 * The accumulators do not depend on each other, so the loop is vectorized for arithmetic operations.
+			 *
+			 * @param begin: The first index.
+			 * @param end: One past the last index. Must be greater than begin.
+			 * @param reduce: The reduction, called as reduce(lhs, rhs).
+			 * @param transform: The function producing the value of an index.
+			 * @return The reduced value.
+			 * @tparam Type: The type of the accumulators.
+			 */
+			template<class Type, class Reduce, class Transform>
+			Type ReduceRange(UI64 begin, UI64 end, const Reduce& reduce, const Transform& transform)
+			{
+				if (end - begin < ReductionLaneCount * 2)
+				{
+					Type result = transform(begin);
+					for (UI64 index = begin + 1; index < end; index++)
+						result = reduce(result, transform(index));
+
+					return result;
+				}
+
+				Type lanes[ReductionLaneCount];
+				for (UI64 lane = 0; lane < ReductionLaneCount; lane++)
+					lanes[lane] = transform(begin + lane);
+
+				UI64 index = begin + ReductionLaneCount;
+				for (; index + ReductionLaneCount <= end; index += ReductionLaneCount)
+					for (UI64 lane = 0; lane < ReductionLaneCount; lane++)
+						lanes[lane] = reduce(lanes[lane], transform(index + lane));
+
+				for (; index < end; index++)
+					lanes[0] = reduce(lanes[0], transform(index));
+
+				Type result = lanes[0];
+				for (UI64 lane = 1; lane < ReductionLaneCount; lane++)
+					result = reduce(result, lanes[lane]);
+
+				return result;
+			}
+		}
+
+		/**
+		 * Reduce the values of a range of indexes in parallel.
+		 * The range is split in blocks of the grain size and the block results are combined in order, so the result
+		 * only depends on the grain size and not on the thread count.
+		 *
+		 * @param system: The job system.
+		 * @param count: The number of indexes.
+		 * @param identity: The value returned for an empty range.
+		 * @param reduce: The reduction, called as reduce(lhs, rhs). It must be associative and commutative.
+		 * @param transform: The function producing the value of an index, called as transform(index) from any thread.
+		 * @param grainSize: The number of indexes reduced by one job. Default is 0, which picks one.
+		 * @return The reduced value.
+		 */
+		template<class Type, class Reduce, class Transform>
+		Type ParallelTransformReduce(JobSystem& system, UI64 count, Type identity, const Reduce& reduce, const Transform& transform, UI64 grainSize = 0)
+		{
+			if (!count)
+				return identity;
+
+			if (!grainSize)
+				grainSize = _Helpers::GetDefaultGrainSize(system, count);
+
+			std::vector<Type> partials(_Helpers::GetBlockCount(count, grainSize), identity);
+			ParallelFor(system, 0, partials.size(), 1, [&](UI64 block)
+				{
+					const UI64 begin = block * grainSize;
+					partials[block] = _Helpers::ReduceRange<Type>(begin, std::min(begin + grainSize, count), reduce, transform);
+				});
+
+			Type result = identity;
+			for (const Type& partial : partials)
+				result = reduce(result, partial);
+
+			return result;
+		}
+
+		/**
+		 * Reduce an array in parallel.
+		 *
+		 * @param system: The job system.
+		 * @param pData: The elements.
+		 * @param count: The number of elements.
+		 * @param identity: The value returned for an empty array.
+		 * @param reduce: The reduction, called as reduce(lhs, rhs). It must be associative and commutative.
+		 * @param grainSize: The number of elements reduced by one job. Default is 0, which picks one.
+		 * @return The reduced value.
+		 */
+		template<class Type, class Reduce>
+		Type ParallelReduce(JobSystem& system, const Type* pData, UI64 count, Type identity, const Reduce& reduce, UI64 grainSize = 0)
+		{
+			return ParallelTransformReduce(system, count, std::move(identity), reduce, [pData](UI64 index) -> const Type& { return pData[index]; }, grainSize);
+		}
+	}
+}
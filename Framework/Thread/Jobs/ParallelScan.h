@@ -0,0 +1,66 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "ParallelReduce.h"
+
+#include <functional>
+
+namespace DMK
+{
+	namespace Thread
+	{
+		/**
+		 * Compute the inclusive prefix of an array in parallel, so that output[i] = input[0] op ... op input[i].
+		 * The first pass reduces every block with the vectorized reduction, the block totals are scanned on the
+		 * calling thread, and the second pass scans every block starting from the total of the blocks before it.
+		 *
+		 * @param system: The job system.
+		 * @param pInput: The elements.
+		 * @param pOutput: The prefixes. May be the same as pInput.
+		 * @param count: The number of elements.
+		 * @param operation: The operation, called as operation(lhs, rhs). It must be associative and commutative, as the
+		 * blocks are reduced in lanes. Default is addition.
+		 * @param grainSize: The number of elements scanned by one job. Default is 0, which picks one.
+		 */
+		template<class Type, class Operation = std::plus<Type>>
+		void ParallelInclusiveScan(JobSystem& system, const Type* pInput, Type* pOutput, UI64 count, const Operation& operation = Operation(), UI64 grainSize = 0)
+		{
+			if (!count)
+				return;
+
+			// The two passes only pay off when there is more than one thread.
+			if (!grainSize)
+				grainSize = system.GetThreadCount() > 1 ? _Helpers::GetDefaultGrainSize(system, count) : count;
+
+			const UI64 blockCount = _Helpers::GetBlockCount(count, grainSize);
+			std::vector<Type> blockTotals(blockCount);
+
+			// The last block's total is not needed.
+			ParallelFor(system, 0, blockCount - 1, 1, [&](UI64 block)
+				{
+					const UI64 begin = block * grainSize;
+					blockTotals[block] = _Helpers::ReduceRange<Type>(begin, begin + grainSize, operation, [pInput](UI64 index) -> const Type& { return pInput[index]; });
+				});
+
+			for (UI64 block = 1; block < blockCount - 1; block++)
+				blockTotals[block] = operation(blockTotals[block - 1], blockTotals[block]);
+
+			ParallelFor(system, 0, blockCount, 1, [&](UI64 block)
+				{
+					const UI64 begin = block * grainSize;
+					const UI64 end = std::min(begin + grainSize, count);
+
+					Type value = block ? operation(blockTotals[block - 1], pInput[begin]) : pInput[begin];
+					pOutput[begin] = value;
+
+					for (UI64 index = begin + 1; index < end; index++)
+					{
+						value = operation(value, pInput[index]);
+						pOutput[index] = value;
+					}
+				});
+		}
+	}
+}
@@ -0,0 +1,320 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "ParallelReduce.h"
+
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace DMK
+{
+	namespace Thread
+	{
+		namespace _Helpers
+		{
+			constexpr UI64 RadixDigitBits = 8;	// Bits sorted by one radix pass.
+			constexpr UI64 RadixDigitCount = UI64(1) << RadixDigitBits;	// Buckets of one radix pass.
+			constexpr UI64 MinRadixBlockSize = 1 << 16;	// Smallest block of a radix pass, so that the histograms pay off.
+			constexpr UI64 MinMergeBlockSize = 1 << 12;	// Smallest sorted run and merged chunk of the merge sort.
+
+			/**
+			 * Map an arithmetic value to an unsigned key with the same order.
+			 * Signed integers get their sign bit flipped. Negative floating point values get all their bits flipped and
+			 * positive ones their sign bit, so that negative values sort below positive ones.
+			 *
+			 * @param value: The value.
+			 * @return The key.
+			 */
+			template<class Type>
+			auto GetRadixKey(Type value)
+			{
+				static_assert(std::is_arithmetic<Type>::value && !std::is_same<Type, bool>::value, "Radix keys must be integer or floating point values!");
+
+				if constexpr (std::is_floating_point<Type>::value)
+				{
+					using Bits = std::conditional_t<sizeof(Type) == sizeof(UI32), UI32, UI64>;
+					constexpr Bits SignBit = Bits(1) << (sizeof(Bits) * 8 - 1);
+
+					Bits bits = 0;
+					std::memcpy(&bits, &value, sizeof(Type));
+					return (bits & SignBit) ? static_cast<Bits>(~bits) : static_cast<Bits>(bits | SignBit);
+				}
+				else if constexpr (std::is_signed<Type>::value)
+				{
+					using Bits = std::make_unsigned_t<Type>;
+					return static_cast<Bits>(static_cast<Bits>(value) ^ (Bits(1) << (sizeof(Type) * 8 - 1)));
+				}
+				else
+					return value;
+			}
+
+			/**
+			 * Find how many elements of the first run come before an output position when merging two sorted runs.
+			 * This is the merge path search. Ties are taken from the first run, which keeps the merge stable.
+			 *
+			 * @param pFirst: The first run.
+			 * @param firstCount: The number of elements in the first run.
+			 * @param pSecond: The second run.
+			 * @param secondCount: The number of elements in the second run.
+			 * @param position: The output position.
+			 * @param compare: The comparison.
+			 * @return The number of elements taken from the first run.
+			 */
+			template<class Type, class Compare>
+			UI64 FindMergeSplit(const Type* pFirst, UI64 firstCount, const Type* pSecond, UI64 secondCount, UI64 position, const Compare& compare)
+			{
+				UI64 low = position > secondCount ? position - secondCount : 0;
+				UI64 high = std::min(position, firstCount);
+
+				while (low < high)
+				{
+					const UI64 middle = low + (high - low) / 2;
+					if (!compare(pSecond[position - middle - 1], pFirst[middle]))
+						low = middle + 1;
+					else
+						high = middle;
+				}
+
+				return low;
+			}
+
+			/**
+			 * Move the elements of a buffer to another in parallel.
+			 */
+			template<class Type>
+			void MoveElements(JobSystem& system, Type* pSource, Type* pDestination, UI64 count)
+			{
+				ParallelForRange(system, 0, count, 0, [pSource, pDestination](UI64 begin, UI64 end)
+					{
+						std::move(pSource + begin, pSource + end, pDestination + begin);
+					});
+			}
+		}
+
+		/**
+		 * Sort an array by unsigned integer keys in parallel, using a least significant digit radix sort.
+		 * Every pass sorts 8 bits: the blocks build histograms of the digit in parallel, the histograms are turned
+		 * into destination offsets, and the blocks scatter their elements in parallel. Passes over digits which are
+		 * the same in every key are skipped, so small keys cost fewer passes.
+		 *
+		 * The sort is stable. It needs a scratch buffer of count elements, so the type must be default constructible
+		 * and movable.
+		 *
+		 * @param system: The job system.
+		 * @param pData: The elements.
+		 * @param count: The number of elements.
+		 * @param getKey: The function returning the unsigned integer key of an element, called from any thread.
+		 * @param grainSize: The number of elements handled by one job. Default is 0, which picks one.
+		 */
+		template<class Type, class GetKey>
+		void ParallelRadixSortByKey(JobSystem& system, Type* pData, UI64 count, const GetKey& getKey, UI64 grainSize = 0)
+		{
+			using Key = std::decay_t<decltype(getKey(*pData))>;
+			static_assert(std::is_unsigned<Key>::value && !std::is_same<Key, bool>::value, "Radix sort keys must be unsigned integers!");
+
+			if (count < 2)
+				return;
+
+			if (!grainSize)
+				grainSize = std::max(count / system.GetThreadCount(), _Helpers::MinRadixBlockSize);
+
+			// Find the bits which differ between the keys.
+			const Key firstKey = getKey(pData[0]);
+			const Key differentBits = ParallelTransformReduce(system, count, Key(0), std::bit_or<Key>(), [pData, &getKey, firstKey](UI64 index) -> Key
+				{
+					return static_cast<Key>(getKey(pData[index]) ^ firstKey);
+				}, grainSize);
+
+			if (!differentBits)
+				return;
+
+			const UI64 blockCount = _Helpers::GetBlockCount(count, grainSize);
+			std::unique_ptr<Type[]> pScratch(new Type[count]);
+			std::unique_ptr<UI64[]> pOffsets(new UI64[blockCount * _Helpers::RadixDigitCount]);
+
+			Type* pSource = pData;
+			Type* pDestination = pScratch.get();
+
+			for (UI64 shift = 0; shift < sizeof(Key) * 8; shift += _Helpers::RadixDigitBits)
+			{
+				if (!((differentBits >> shift) & (_Helpers::RadixDigitCount - 1)))
+					continue;
+
+				ParallelFor(system, 0, blockCount, 1, [&](UI64 block)
+					{
+						UI64* pHistogram = pOffsets.get() + block * _Helpers::RadixDigitCount;
+						std::fill(pHistogram, pHistogram + _Helpers::RadixDigitCount, 0);
+
+						const UI64 end = std::min((block + 1) * grainSize, count);
+						for (UI64 index = block * grainSize; index < end; index++)
+							pHistogram[(getKey(pSource[index]) >> shift) & (_Helpers::RadixDigitCount - 1)]++;
+					});
+
+				// Digit major, so that the elements of a digit keep the order of the blocks.
+				UI64 offset = 0;
+				for (UI64 digit = 0; digit < _Helpers::RadixDigitCount; digit++)
+				{
+					for (UI64 block = 0; block < blockCount; block++)
+					{
+						UI64& blockOffset = pOffsets[block * _Helpers::RadixDigitCount + digit];
+						const UI64 digitCount = blockOffset;
+						blockOffset = offset;
+						offset += digitCount;
+					}
+				}
+
+				ParallelFor(system, 0, blockCount, 1, [&](UI64 block)
+					{
+						UI64* pBlockOffsets = pOffsets.get() + block * _Helpers::RadixDigitCount;
+
+						const UI64 end = std::min((block + 1) * grainSize, count);
+						for (UI64 index = block * grainSize; index < end; index++)
+							pDestination[pBlockOffsets[(getKey(pSource[index]) >> shift) & (_Helpers::RadixDigitCount - 1)]++] = std::move(pSource[index]);
+					});
+
+				std::swap(pSource, pDestination);
+			}
+
+			if (pSource != pData)
+				_Helpers::MoveElements(system, pSource, pData, count);
+		}
+
+		/**
+		 * Sort an array of integer or floating point values in parallel, using a least significant digit radix sort.
+		 *
+		 * @param system: The job system.
+		 * @param pData: The values.
+		 * @param count: The number of values.
+		 * @param grainSize: The number of values handled by one job. Default is 0, which picks one.
+		 */
+		template<class Type>
+		void ParallelRadixSort(JobSystem& system, Type* pData, UI64 count, UI64 grainSize = 0)
+		{
+			ParallelRadixSortByKey(system, pData, count, [](Type value) { return _Helpers::GetRadixKey(value); }, grainSize);
+		}
+
+		/**
+		 * Sort an array with a comparison in parallel, using a merge sort.
+		 * Runs of the grain size are sorted with std::sort in parallel. Every merge pass then splits the output into
+		 * chunks of the grain size and finds where each chunk starts in its two input runs with a binary search, so
+		 * even the last merge is spread over all the threads.
+		 *
+		 * Like std::sort, the order of equal elements is not kept. It needs a scratch buffer of count elements, so
+		 * the type must be default constructible and movable.
+		 *
+		 * @param system: The job system.
+		 * @param pData: The elements.
+		 * @param count: The number of elements.
+		 * @param compare: The strict weak ordering, called as compare(lhs, rhs) from any thread.
+		 * @param grainSize: The number of elements handled by one job. Default is 0, which picks one.
+		 */
+		template<class Type, class Compare>
+		void ParallelMergeSort(JobSystem& system, Type* pData, UI64 count, const Compare& compare, UI64 grainSize = 0)
+		{
+			if (count < 2)
+				return;
+
+			if (!grainSize)
+				grainSize = std::max(_Helpers::GetDefaultGrainSize(system, count), _Helpers::MinMergeBlockSize);
+
+			const UI64 blockCount = _Helpers::GetBlockCount(count, grainSize);
+			ParallelFor(system, 0, blockCount, 1, [&](UI64 block)
+				{
+					std::sort(pData + block * grainSize, pData + std::min((block + 1) * grainSize, count), compare);
+				});
+
+			if (blockCount == 1)
+				return;
+
+			std::unique_ptr<Type[]> pScratch(new Type[count]);
+			std::vector<UI64> firstSplits(blockCount);
+			Type* pSource = pData;
+			Type* pDestination = pScratch.get();
+
+			// Runs are a power of two multiple of the grain size, so a chunk never spans two pairs of runs. The splits
+			// are all found before any element is moved, as the searches read the whole pair of runs.
+			for (UI64 runSize = grainSize; runSize < count; runSize *= 2)
+			{
+				const auto getPair = [runSize, count](UI64 position, UI64& pairBegin, UI64& middle, UI64& pairEnd)
+				{
+					pairBegin = position / (runSize * 2) * (runSize * 2);
+					middle = std::min(pairBegin + runSize, count);
+					pairEnd = std::min(pairBegin + runSize * 2, count);
+				};
+
+				ParallelFor(system, 0, blockCount, 1, [&](UI64 chunk)
+					{
+						const UI64 chunkBegin = chunk * grainSize;
+
+						UI64 pairBegin = 0, middle = 0, pairEnd = 0;
+						getPair(chunkBegin, pairBegin, middle, pairEnd);
+
+						firstSplits[chunk] = _Helpers::FindMergeSplit<Type>(pSource + pairBegin, middle - pairBegin, pSource + middle, pairEnd - middle, chunkBegin - pairBegin, compare);
+					});
+
+				ParallelFor(system, 0, blockCount, 1, [&](UI64 chunk)
+					{
+						const UI64 chunkBegin = chunk * grainSize;
+						const UI64 chunkEnd = std::min(chunkBegin + grainSize, count);
+
+						UI64 pairBegin = 0, middle = 0, pairEnd = 0;
+						getPair(chunkBegin, pairBegin, middle, pairEnd);
+
+						// The chunk ends where the next one begins, unless it ends the pair.
+						const UI64 firstBegin = firstSplits[chunk];
+						const UI64 firstEnd = chunkEnd == pairEnd ? middle - pairBegin : firstSplits[chunk + 1];
+						const UI64 secondBegin = chunkBegin - pairBegin - firstBegin;
+						const UI64 secondEnd = chunkEnd - pairBegin - firstEnd;
+
+						Type* pFirst = pSource + pairBegin;
+						Type* pSecond = pSource + middle;
+						std::merge(std::make_move_iterator(pFirst + firstBegin), std::make_move_iterator(pFirst + firstEnd),
+							std::make_move_iterator(pSecond + secondBegin), std::make_move_iterator(pSecond + secondEnd),
+							pDestination + chunkBegin, compare);
+					});
+
+				std::swap(pSource, pDestination);
+			}
+
+			if (pSource != pData)
+				_Helpers::MoveElements(system, pSource, pData, count);
+		}
+
+		/**
+		 * Sort an array with a comparison in parallel.
+		 *
+		 * @param system: The job system.
+		 * @param pData: The elements.
+		 * @param count: The number of elements.
+		 * @param compare: The strict weak ordering, called as compare(lhs, rhs) from any thread.
+		 */
+		template<class Type, class Compare>
+		void ParallelSort(JobSystem& system, Type* pData, UI64 count, const Compare& compare)
+		{
+			ParallelMergeSort(system, pData, count, compare);
+		}
+
+		/**
+		 * Sort an array in ascending order in parallel.
+		 * Integer and floating point values use the radix sort, other types the merge sort with operator<.
+		 *
+		 * @param system: The job system.
+		 * @param pData: The elements.
+		 * @param count: The number of elements.
+		 */
+		template<class Type>
+		void ParallelSort(JobSystem& system, Type* pData, UI64 count)
+		{
+			if constexpr (std::is_arithmetic<Type>::value && !std::is_same<Type, bool>::value)
+				ParallelRadixSort(system, pData, count);
+			else
+				ParallelMergeSort(system, pData, count, std::less<Type>());
+		}
+	}
+}
@@ -0,0 +1,183 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Core/Types/DataTypes.h"
+#include "Core/Macros/Global.h"
+
+#include <atomic>
+#include <type_traits>
+#include <vector>
+
+namespace DMK
+{
+	namespace Thread
+	{
+		/**
+		 * Work Stealing Deque object.
+		 * This is the Chase-Lev deque, with the memory orders of Le, Pop, Cohen and Nardelli ("Correct and
+		 * Efficient Work-Stealing for Weak Memory Models", 2013).
+		 *
+		 * The owning thread pushes and pops at the bottom like a stack, which keeps the most recently created (and
+		 * cache warm) work local. Any other thread can steal from the top. The owner only synchronizes with thieves
+		 * when a single element is left.
+		 *
+		 * The storage grows when the deque is full. Old arrays are kept until the deque is destroyed, because a
+		 * thief may still be reading from them.
+		 *
+		 * @tparam Type: The element type. Must be trivially copyable, usually a pointer.
+		 */
+		template<class Type>
+		class WorkStealingDeque {
+			static_assert(std::is_trivially_copyable<Type>::value, "The elements of a work stealing deque must be trivially copyable!");
+
+			/**
+			 * Circular Array structure.
+			 */
+			struct CircularArray {
+				CircularArray(I64 capacity) : mCapacity(capacity), mMask(capacity - 1), pElements(new std::atomic<Type>[capacity]) {}
+				~CircularArray() { delete[] pElements; }
+
+				Type Get(I64 index) const { return pElements[index & mMask].load(std::memory_order_relaxed); }
+				void Put(I64 index, Type element) { pElements[index & mMask].store(element, std::memory_order_relaxed); }
+
+				/**
+				 * Create an array of twice the size holding the same elements.
+				 */
+				CircularArray* Grow(I64 bottom, I64 top) const
+				{
+					CircularArray* pArray = new CircularArray(mCapacity * 2);
+					for (I64 index = top; index < bottom; index++)
+						pArray->Put(index, Get(index));
+
+					return pArray;
+				}
+
+				const I64 mCapacity = 0;
+				const I64 mMask = 0;
+				std::atomic<Type>* pElements = nullptr;
+			};
+
+		public:
+			/**
+			 * Construct the deque.
+			 *
+			 * @param capacity: The initial capacity. Must be a power of two. Default is 1024.
+			 */
+			WorkStealingDeque(I64 capacity = 1024) : pArray(new CircularArray(capacity)) {}
+
+			~WorkStealingDeque()
+			{
+				delete pArray.load(std::memory_order_relaxed);
+
+				for (auto pRetired : mRetiredArrays)
+					delete pRetired;
+			}
+
+			WorkStealingDeque(const WorkStealingDeque&) = delete;
+			WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+			/**
+			 * Push an element to the bottom (owner only).
+			 *
+			 * @param element: The element to push.
+			 */
+			void Push(Type element)
+			{
+				const I64 bottom = mBottom.load(std::memory_order_relaxed);
+				const I64 top = mTop.load(std::memory_order_acquire);
+				CircularArray* pCurrentArray = pArray.load(std::memory_order_relaxed);
+
+				if (bottom - top > pCurrentArray->mCapacity - 1)
+				{
+					mRetiredArrays.push_back(pCurrentArray);
+					pCurrentArray = pCurrentArray->Grow(bottom, top);
+					pArray.store(pCurrentArray, std::memory_order_release);
+				}
+
+				pCurrentArray->Put(bottom, element);
+				mBottom.store(bottom + 1, std::memory_order_release);
+			}
+
+			/**
+			 * Pop an element from the bottom (owner only).
+			 * Returns false if the deque is empty or a thief took the last element.
+			 *
+			 * @param element: The variable to store the element in.
+			 * @return Boolean value.
+			 */
+			bool Pop(Type& element)
+			{
+				const I64 bottom = mBottom.load(std::memory_order_relaxed) - 1;
+				CircularArray* pCurrentArray = pArray.load(std::memory_order_relaxed);
+				mBottom.store(bottom, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				I64 top = mTop.load(std::memory_order_relaxed);
+
+				if (top > bottom)
+				{
+					mBottom.store(bottom + 1, std::memory_order_relaxed);
+					return false;
+				}
+
+				element = pCurrentArray->Get(bottom);
+				if (top == bottom)
+				{
+					// Last element. Race the thieves for it.
+					const bool bWon = mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+					mBottom.store(bottom + 1, std::memory_order_relaxed);
+					return bWon;
+				}
+
+				return true;
+			}
+
+			/**
+			 * Steal an element from the top (any thread).
+			 * Returns false if the deque is empty or another thread won the element. Callers usually move on to
+			 * another deque instead of retrying.
+			 *
+			 * @param element: The variable to store the element in.
+			 * @return Boolean value.
+			 */
+			bool Steal(Type& element)
+			{
+				I64 top = mTop.load(std::memory_order_acquire);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				const I64 bottom = mBottom.load(std::memory_order_acquire);
+
+				if (top >= bottom)
+					return false;
+
+				element = pArray.load(std::memory_order_acquire)->Get(top);
+				return mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+			}
+
+			/**
+			 * Get the approximate number of elements.
+			 *
+			 * @return The element count.
+			 */
+			I64 Size() const
+			{
+				const I64 bottom = mBottom.load(std::memory_order_relaxed);
+				const I64 top = mTop.load(std::memory_order_relaxed);
+				return bottom > top ? bottom - top : 0;
+			}
+
+			/**
+			 * Check if the deque is approximately empty.
+			 *
+			 * @return Boolean value.
+			 */
+			bool IsEmpty() const { return Size() == 0; }
+
+		private:
+			alignas(DMK_CACHE_LINE_SIZE) std::atomic<I64> mTop = { 0 };	// Index thieves steal from.
+			alignas(DMK_CACHE_LINE_SIZE) std::atomic<I64> mBottom = { 0 };	// Index the owner pushes to.
+			alignas(DMK_CACHE_LINE_SIZE) std::atomic<CircularArray*> pArray = { nullptr };	// The current storage.
+			std::vector<CircularArray*> mRetiredArrays;	// Storage replaced by a larger array.
+		};
+	}
+}
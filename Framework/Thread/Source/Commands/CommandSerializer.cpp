@@ -0,0 +1,46 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Thread/Commands/CommandSerializer.h"
+
+#include <fstream>
+
+namespace DMK
+{
+	namespace Thread
+	{
+		namespace _Helpers
+		{
+			bool WriteCommandRecordingFile(const std::string& path, const std::vector<BYTE>& data)
+			{
+				std::ofstream file(path, std::ios::binary | std::ios::trunc);
+				if (!file.is_open())
+					return false;
+
+				file.write(reinterpret_cast<const char*>(data.data()), data.size());
+				return static_cast<bool>(file);
+			}
+
+			bool ReadCommandRecordingFile(const std::string& path, std::vector<BYTE>& data)
+			{
+				data.clear();
+
+				std::ifstream file(path, std::ios::binary | std::ios::ate);
+				if (!file.is_open())
+					return false;
+
+				data.resize(static_cast<UI64>(file.tellg()));
+				file.seekg(0);
+				file.read(reinterpret_cast<char*>(data.data()), data.size());
+
+				if (!file)
+				{
+					data.clear();
+					return false;
+				}
+
+				return true;
+			}
+		}
+	}
+}
@@ -0,0 +1,43 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Thread/Coroutines/AsyncFile.h"
+
+#include <fstream>
+
+namespace DMK
+{
+	namespace Thread
+	{
+		Task<std::vector<BYTE>> ReadFileAsync(CoroutineExecutor& executor, std::string path)
+		{
+			co_await executor.Schedule();
+
+			std::vector<BYTE> bytes;
+			std::ifstream file(path, std::ios::binary | std::ios::ate);
+			if (!file.is_open())
+				co_return bytes;
+
+			bytes.resize(static_cast<UI64>(file.tellg()));
+			file.seekg(0);
+			file.read(reinterpret_cast<char*>(bytes.data()), bytes.size());
+
+			if (!file)
+				bytes.clear();
+
+			co_return bytes;
+		}
+
+		Task<bool> WriteFileAsync(CoroutineExecutor& executor, std::string path, std::vector<BYTE> bytes)
+		{
+			co_await executor.Schedule();
+
+			std::ofstream file(path, std::ios::binary | std::ios::trunc);
+			if (!file.is_open())
+				co_return false;
+
+			file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+			co_return static_cast<bool>(file);
+		}
+	}
+}
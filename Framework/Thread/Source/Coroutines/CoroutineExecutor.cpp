@@ -0,0 +1,76 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Thread/Coroutines/CoroutineExecutor.h"
+
+namespace DMK
+{
+	namespace Thread
+	{
+		CoroutineExecutor::CoroutineExecutor(JobSystem& system) : mSystem(system)
+		{
+			mTimerThread = std::thread([this] { TimerFunction(); });
+		}
+
+		CoroutineExecutor::~CoroutineExecutor()
+		{
+			{
+				std::lock_guard<std::mutex> lock(mTimerMutex);
+				bIsRunning = false;
+			}
+
+			mTimerCondition.notify_one();
+			mTimerThread.join();
+		}
+
+		void CoroutineExecutor::Spawn(Task<void>&& task)
+		{
+			[](CoroutineExecutor& executor, Task<void> task) -> _Helpers::DetachedTask
+			{
+				co_await executor.Schedule();
+				co_await task.WhenReady();
+			}(*this, std::move(task));
+		}
+
+		void CoroutineExecutor::AddTimer(std::chrono::steady_clock::time_point resumeTime, std::coroutine_handle<> handle)
+		{
+			bool bIsEarliest = false;
+			{
+				std::lock_guard<std::mutex> lock(mTimerMutex);
+				const auto timer = mTimers.emplace(resumeTime, handle);
+				bIsEarliest = timer == mTimers.begin();
+			}
+
+			// Only a new earliest timer changes how long the timer thread sleeps.
+			if (bIsEarliest)
+				mTimerCondition.notify_one();
+		}
+
+		void CoroutineExecutor::TimerFunction()
+		{
+			std::unique_lock<std::mutex> lock(mTimerMutex);
+			while (bIsRunning)
+			{
+				if (mTimers.empty())
+				{
+					mTimerCondition.wait(lock);
+					continue;
+				}
+
+				const auto resumeTime = mTimers.begin()->first;
+				if (resumeTime > std::chrono::steady_clock::now())
+				{
+					mTimerCondition.wait_until(lock, resumeTime);
+					continue;
+				}
+
+				const std::coroutine_handle<> handle = mTimers.begin()->second;
+				mTimers.erase(mTimers.begin());
+
+				lock.unlock();
+				Resume(handle);
+				lock.lock();
+			}
+		}
+	}
+}
@@ -0,0 +1,96 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Thread/Coroutines/CoroutineFramePool.h"
+
+#include <new>
+
+namespace DMK
+{
+	namespace Thread
+	{
+		namespace
+		{
+			/**
+			 * Free frame structure, stored in the freed frame itself.
+			 */
+			struct FreeFrame {
+				FreeFrame* pNext = nullptr;	// The next free frame.
+			};
+
+			/**
+			 * Per thread frame cache.
+			 */
+			struct FrameCache {
+				~FrameCache()
+				{
+					for (UI64 sizeClass = 0; sizeClass < CoroutineFramePool::SizeClassCount; sizeClass++)
+					{
+						while (pFreeFrames[sizeClass])
+						{
+							FreeFrame* pFrame = pFreeFrames[sizeClass];
+							pFreeFrames[sizeClass] = pFrame->pNext;
+							::operator delete(pFrame);
+						}
+					}
+				}
+
+				FreeFrame* pFreeFrames[CoroutineFramePool::SizeClassCount] = {};	// Free frames of every size class.
+				UI64 mFreeCounts[CoroutineFramePool::SizeClassCount] = {};	// Number of free frames of every size class.
+			};
+
+			thread_local FrameCache tFrameCache;
+
+			/**
+			 * Get the size class of a frame size. The size must not exceed the largest size class.
+			 */
+			UI64 GetSizeClass(UI64 size)
+			{
+				UI64 sizeClass = 0;
+				for (UI64 classSize = CoroutineFramePool::SmallestFrameSize; classSize < size; classSize <<= 1)
+					sizeClass++;
+
+				return sizeClass;
+			}
+		}
+
+		void* CoroutineFramePool::Allocate(UI64 size)
+		{
+			if (size > LargestFrameSize)
+				return ::operator new(size);
+
+			const UI64 sizeClass = GetSizeClass(size);
+			FrameCache& cache = tFrameCache;
+
+			if (FreeFrame* pFrame = cache.pFreeFrames[sizeClass])
+			{
+				cache.pFreeFrames[sizeClass] = pFrame->pNext;
+				cache.mFreeCounts[sizeClass]--;
+				return pFrame;
+			}
+
+			return ::operator new(SmallestFrameSize << sizeClass);
+		}
+
+		void CoroutineFramePool::Deallocate(void* pFrame, UI64 size)
+		{
+			if (size > LargestFrameSize)
+			{
+				::operator delete(pFrame);
+				return;
+			}
+
+			const UI64 sizeClass = GetSizeClass(size);
+			FrameCache& cache = tFrameCache;
+
+			if (cache.mFreeCounts[sizeClass] >= MaximumCachedFrames)
+			{
+				::operator delete(pFrame);
+				return;
+			}
+
+			cache.pFreeFrames[sizeClass] = new (pFrame) FreeFrame{ cache.pFreeFrames[sizeClass] };
+			cache.mFreeCounts[sizeClass]++;
+		}
+	}
+}
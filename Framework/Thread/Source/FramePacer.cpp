@@ -0,0 +1,80 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Thread/FramePacer.h"
+
+#include <cmath>
+
+#ifdef __linux__
+#include <sys/prctl.h>
+
+#endif
+
+namespace DMK
+{
+	namespace Thread
+	{
+		void FramePacer::Start()
+		{
+#ifdef __linux__
+			prctl(PR_SET_TIMERSLACK, 1ul, 0ul, 0ul, 0ul);
+
+#endif
+
+			ResetStatistics();
+			mNextDeadline = Utilities::Clock::now() + mPeriod;
+		}
+
+		UI64 FramePacer::WaitForNextFrame()
+		{
+			Utilities::SleepUntil(mNextDeadline, mSpinThreshold);
+
+			const Utilities::TimePoint wakeTime = Utilities::Clock::now();
+			const UI64 jitter = static_cast<UI64>(std::chrono::duration_cast<Utilities::Nanoseconds>(wakeTime - mNextDeadline).count());
+
+			// Welford's running variance.
+			mJitterHistogram.Record(jitter);
+			const double distance = static_cast<double>(jitter) - mJitterMean;
+			mJitterMean += distance / static_cast<double>(mJitterHistogram.GetCount());
+			mJitterSquaredDistance += distance * (static_cast<double>(jitter) - mJitterMean);
+
+			// The deadlines stay on the grid of the start time. Deadlines which already passed are skipped.
+			mNextDeadline += mPeriod;
+
+			UI64 missedFrameCount = 0;
+			if (mNextDeadline <= wakeTime && mPeriod > Utilities::Duration::zero())
+			{
+				missedFrameCount = static_cast<UI64>((wakeTime - mNextDeadline) / mPeriod) + 1;
+				mNextDeadline += mPeriod * static_cast<Utilities::Duration::rep>(missedFrameCount);
+				mMissedFrameCount += missedFrameCount;
+			}
+
+			return missedFrameCount;
+		}
+
+		FramePacerStatistics FramePacer::GetStatistics() const
+		{
+			const UI64 frameCount = mJitterHistogram.GetCount();
+			const auto toDuration = [](double nanoseconds) { return Utilities::Duration(static_cast<Utilities::Duration::rep>(nanoseconds + 0.5)); };
+
+			FramePacerStatistics statistics;
+			statistics.mFrameCount = frameCount;
+			statistics.mMissedFrameCount = mMissedFrameCount;
+			statistics.mMeanJitter = toDuration(mJitterMean);
+			statistics.mJitterStandardDeviation = toDuration(frameCount > 1 ? std::sqrt(mJitterSquaredDistance / static_cast<double>(frameCount - 1)) : 0.0);
+			statistics.mMedianJitter = Utilities::Duration(mJitterHistogram.GetPercentile(50.0));
+			statistics.mPercentile99Jitter = Utilities::Duration(mJitterHistogram.GetPercentile(99.0));
+			statistics.mMaxJitter = Utilities::Duration(mJitterHistogram.GetMax());
+
+			return statistics;
+		}
+
+		void FramePacer::ResetStatistics()
+		{
+			mJitterHistogram.Reset();
+			mJitterMean = 0.0;
+			mJitterSquaredDistance = 0.0;
+			mMissedFrameCount = 0;
+		}
+	}
+}
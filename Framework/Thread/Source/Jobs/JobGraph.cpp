@@ -0,0 +1,58 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Thread/Jobs/JobGraph.h"
+
+namespace DMK
+{
+	namespace Thread
+	{
+		UI64 JobGraph::AddNode(std::function<void()> function)
+		{
+			Node node;
+			node.mFunction = std::move(function);
+			mNodes.push_back(std::move(node));
+
+			return mNodes.size() - 1;
+		}
+
+		void JobGraph::AddDependency(UI64 dependency, UI64 node)
+		{
+			mNodes[dependency].mDependents.push_back(node);
+			mNodes[node].mDependencyCount++;
+		}
+
+		void JobGraph::Execute(JobSystem& system)
+		{
+			if (mRemainingDependencyCount < mNodes.size())
+			{
+				pRemainingDependencies.reset(new std::atomic<UI32>[mNodes.size()]);
+				mRemainingDependencyCount = mNodes.size();
+			}
+
+			for (UI64 index = 0; index < mNodes.size(); index++)
+				pRemainingDependencies[index].store(mNodes[index].mDependencyCount, std::memory_order_relaxed);
+
+			JobCounter counter;
+			for (UI64 index = 0; index < mNodes.size(); index++)
+				if (!mNodes[index].mDependencyCount)
+					ScheduleNode(system, index, counter);
+
+			system.Wait(counter);
+		}
+
+		void JobGraph::ScheduleNode(JobSystem& system, UI64 index, JobCounter& counter)
+		{
+			system.Schedule([this, &system, index, &counter]
+				{
+					const Node& node = mNodes[index];
+					node.mFunction();
+
+					// The dependents are scheduled before this job completes, so the counter cannot reach zero early.
+					for (const UI64 dependent : node.mDependents)
+						if (pRemainingDependencies[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1)
+							ScheduleNode(system, dependent, counter);
+				}, &counter);
+		}
+	}
+}
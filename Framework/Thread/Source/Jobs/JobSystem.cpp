@@ -0,0 +1,445 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Thread/Jobs/JobSystem.h"
+#include "Thread/Utilities.h"
+
+#include "Core/Benchmark/Profiler.h"
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace DMK
+{
+	namespace Thread
+	{
+		namespace _Helpers
+		{
+			constexpr UI64 JobBlockSize = 256;	// Number of jobs allocated at once by a thread.
+			constexpr UI32 IdleSpinCount = 128;	// Number of failed job searches before a worker parks.
+			constexpr UI32 ExternalJobOwner = ~0u;	// Owner of jobs created by threads outside the system.
+
+			thread_local JobSystem* pCurrentSystem = nullptr;	// The system the calling thread belongs to.
+			thread_local UI32 CurrentThreadIndex = InvalidJobThreadIndex;	// The calling thread's index in it.
+		}
+
+		/**
+		 * Worker Slot structure.
+		 * The state of a thread in the job system.
+		 */
+		struct alignas(DMK_CACHE_LINE_SIZE) JobSystem::WorkerSlot {
+			WorkStealingDeque<Job*> mDeque;	// Jobs scheduled by the thread.
+
+			Job* pFreeJobs = nullptr;	// Recycled jobs. Only used by the owning thread.
+			alignas(DMK_CACHE_LINE_SIZE) std::atomic<Job*> pReturnedJobs = { nullptr };	// Jobs recycled by other threads.
+			std::vector<std::unique_ptr<Job[]>> mJobBlocks;	// All the jobs the thread allocated.
+
+			UI64 mRandomState = 0;	// Victim selection state.
+			UI32 mL3DomainIndex = 0;	// The L3 domain the thread is placed in.
+			std::thread mThread;	// The worker thread. Empty for slot 0.
+		};
+
+		JobSystem::JobSystem(UI32 workerCount)
+			: JobSystem(JobSystemCreateInfo{ workerCount })
+		{
+		}
+
+		JobSystem::JobSystem(const JobSystemCreateInfo& createInfo)
+			: mThreadCount((createInfo.mWorkerCount == DefaultJobWorkerCount ? GetDefaultWorkerCount() : createInfo.mWorkerCount) + 1)
+		{
+			pSlots.reset(new WorkerSlot[mThreadCount]);
+
+			const CPUTopology& topology = CPUTopology::Get();
+			std::vector<UI32> placementOrder = topology.GetPlacementOrder(createInfo.mNUMANode);
+			if (placementOrder.empty())
+				placementOrder = topology.GetPlacementOrder();
+
+			for (UI32 index = 0; index < mThreadCount; index++)
+			{
+				pSlots[index].mRandomState = 0x9E3779B97F4A7C15ull * (index + 1);
+
+				if (const LogicalProcessor* pProcessor = topology.FindLogicalProcessor(placementOrder[index % placementOrder.size()]))
+					pSlots[index].mL3DomainIndex = pProcessor->mL3DomainIndex;
+			}
+
+			_Helpers::pCurrentSystem = this;
+			_Helpers::CurrentThreadIndex = 0;
+
+			// Without pinning, a NUMA node restricts every worker to the processors of the node.
+			CPUSet nodeSet;
+			if (createInfo.mNUMANode >= 0)
+				nodeSet = topology.GetNUMANodeSet(static_cast<UI32>(createInfo.mNUMANode));
+
+			// The creating thread's affinity is restored when the system is destroyed.
+			if (createInfo.bShouldPinWorkers)
+			{
+				CPUSet affinity;
+				affinity.Add(placementOrder.front());
+
+				mCreatorAffinity = GetCurrentThreadAffinity();
+				if (!SetCurrentThreadAffinity(affinity))
+					mCreatorAffinity = CPUSet();
+			}
+
+			// Memory policies take the operating system's node id, not the dense topology index.
+			const I32 nodeID = createInfo.mNUMANode >= 0 ? topology.GetNUMANodeID(static_cast<UI32>(createInfo.mNUMANode)) : -1;
+
+			for (UI32 index = 1; index < mThreadCount; index++)
+			{
+				ThreadCreateInfo threadInfo;
+				threadInfo.mName = "Job Worker " + std::to_string(index);
+				threadInfo.mPriority = createInfo.mWorkerPriority;
+				threadInfo.mNUMANodeID = nodeID;
+
+				if (createInfo.bShouldPinWorkers)
+					threadInfo.mAffinity.Add(placementOrder[index % placementOrder.size()]);
+				else
+					threadInfo.mAffinity = nodeSet;
+
+				pSlots[index].mThread = CreateThread(std::move(threadInfo), &JobSystem::WorkerFunction, this, index);
+			}
+		}
+
+		JobSystem::~JobSystem()
+		{
+			{
+				std::lock_guard<std::mutex> _lock(mParkMutex);
+				bIsRunning.store(false, std::memory_order_relaxed);
+				mWakeEpoch.fetch_add(1, std::memory_order_relaxed);
+			}
+			mParkCondition.notify_all();
+
+			for (UI32 index = 1; index < mThreadCount; index++)
+				pSlots[index].mThread.join();
+
+			if (_Helpers::pCurrentSystem == this)
+			{
+				_Helpers::pCurrentSystem = nullptr;
+				_Helpers::CurrentThreadIndex = InvalidJobThreadIndex;
+			}
+
+			if (!mCreatorAffinity.IsEmpty())
+				SetCurrentThreadAffinity(mCreatorAffinity);
+
+			// Free the jobs of external threads which were never executed.
+			for (Job* pJob = pInjectedHead; pJob;)
+			{
+				Job* pNext = pJob->pNext;
+				if (pJob->mOwnerIndex == _Helpers::ExternalJobOwner)
+					delete pJob;
+
+				pJob = pNext;
+			}
+		}
+
+		UI32 JobSystem::GetDefaultWorkerCount()
+		{
+			const UI32 hardwareThreads = std::thread::hardware_concurrency();
+			return hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+		}
+
+		UI32 JobSystem::GetCurrentThreadIndex() const
+		{
+			return _Helpers::pCurrentSystem == this ? _Helpers::CurrentThreadIndex : InvalidJobThreadIndex;
+		}
+
+		void JobSystem::Wait(JobCounter& counter)
+		{
+			const UI32 threadIndex = GetCurrentThreadIndex();
+
+			// Threads of the system execute jobs until the counter completes.
+			if (threadIndex != InvalidJobThreadIndex)
+			{
+				UI32 idleCount = 0;
+				while (!counter.IsComplete())
+				{
+					if (Job* pJob = FindJob(threadIndex))
+					{
+						Execute(pJob);
+						idleCount = 0;
+					}
+					else if (++idleCount < _Helpers::IdleSpinCount)
+						Utilities::Pause();
+					else
+						std::this_thread::yield();
+				}
+
+				return;
+			}
+
+			// Other threads block until a counter completes.
+			mExternalWaiterCount.fetch_add(1, std::memory_order_seq_cst);
+			{
+				std::unique_lock<std::mutex> _lock(mWaitMutex);
+				mWaitCondition.wait(_lock, [&counter] { return counter.IsComplete(); });
+			}
+			mExternalWaiterCount.fetch_sub(1, std::memory_order_relaxed);
+		}
+
+		Job* JobSystem::AllocateJob()
+		{
+			const UI32 threadIndex = GetCurrentThreadIndex();
+			if (threadIndex == InvalidJobThreadIndex)
+			{
+				Job* pJob = new Job;
+				pJob->mOwnerIndex = _Helpers::ExternalJobOwner;
+				return pJob;
+			}
+
+			WorkerSlot& slot = pSlots[threadIndex];
+			if (!slot.pFreeJobs)
+				slot.pFreeJobs = slot.pReturnedJobs.exchange(nullptr, std::memory_order_acquire);
+
+			if (!slot.pFreeJobs)
+			{
+				Job* pBlock = new Job[_Helpers::JobBlockSize];
+				slot.mJobBlocks.emplace_back(pBlock);
+
+				for (UI64 index = 0; index < _Helpers::JobBlockSize; index++)
+				{
+					pBlock[index].mOwnerIndex = threadIndex;
+					pBlock[index].pNext = index + 1 < _Helpers::JobBlockSize ? &pBlock[index + 1] : nullptr;
+				}
+
+				slot.pFreeJobs = pBlock;
+			}
+
+			Job* pJob = slot.pFreeJobs;
+			slot.pFreeJobs = pJob->pNext;
+			pJob->pNext = nullptr;
+			return pJob;
+		}
+
+		void JobSystem::FreeJob(Job* pJob)
+		{
+			if (pJob->mOwnerIndex == _Helpers::ExternalJobOwner)
+			{
+				delete pJob;
+				return;
+			}
+
+			WorkerSlot& slot = pSlots[pJob->mOwnerIndex];
+			if (GetCurrentThreadIndex() == pJob->mOwnerIndex)
+			{
+				pJob->pNext = slot.pFreeJobs;
+				slot.pFreeJobs = pJob;
+				return;
+			}
+
+			// Return the job to its owner. Only the owner takes the list, and it takes all of it, so this is free
+			// of the ABA problem.
+			Job* pHead = slot.pReturnedJobs.load(std::memory_order_relaxed);
+			do {
+				pJob->pNext = pHead;
+			} while (!slot.pReturnedJobs.compare_exchange_weak(pHead, pJob, std::memory_order_release, std::memory_order_relaxed));
+		}
+
+		void JobSystem::Submit(Job* pJob)
+		{
+			const UI32 threadIndex = GetCurrentThreadIndex();
+			if (threadIndex != InvalidJobThreadIndex)
+				pSlots[threadIndex].mDeque.Push(pJob);
+
+			else
+			{
+				std::lock_guard<std::mutex> _lock(mInjectionMutex);
+				pJob->pNext = nullptr;
+
+				if (pInjectedTail)
+					pInjectedTail->pNext = pJob;
+				else
+					pInjectedHead = pJob;
+
+				pInjectedTail = pJob;
+				mInjectedCount.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			WakeWorker();
+		}
+
+		void JobSystem::SubmitAfter(JobCounter& dependency, Job* pJob)
+		{
+			{
+				// The last job of the dependency takes the list while holding the lock, after the value reached zero.
+				std::lock_guard<std::mutex> _lock(dependency.mContinuationMutex);
+				if (dependency.mValue.load(std::memory_order_acquire) & JobCounter::PendingMask)
+				{
+					pJob->pNext = dependency.pContinuations;
+					dependency.pContinuations = pJob;
+					return;
+				}
+			}
+
+			Submit(pJob);
+		}
+
+		Job* JobSystem::FindJob(UI32 threadIndex)
+		{
+			WorkerSlot& slot = pSlots[threadIndex];
+			Job* pJob = nullptr;
+
+			// Newest local job first.
+			if (slot.mDeque.Pop(pJob))
+				return pJob;
+
+			// Then the jobs submitted by other threads.
+			if (mInjectedCount.load(std::memory_order_relaxed))
+			{
+				std::lock_guard<std::mutex> _lock(mInjectionMutex);
+				if (pInjectedHead)
+				{
+					pJob = pInjectedHead;
+					pInjectedHead = pJob->pNext;
+					if (!pInjectedHead)
+						pInjectedTail = nullptr;
+
+					mInjectedCount.fetch_sub(1, std::memory_order_relaxed);
+					return pJob;
+				}
+			}
+
+			// Then steal the oldest job of another thread, starting at a random one. Threads sharing the L3 cache
+			// are tried first, as their jobs' data is likely in it.
+			slot.mRandomState ^= slot.mRandomState << 13;
+			slot.mRandomState ^= slot.mRandomState >> 7;
+			slot.mRandomState ^= slot.mRandomState << 17;
+
+			const UI32 firstVictim = static_cast<UI32>(slot.mRandomState % mThreadCount);
+			for (UI32 pass = 0; pass < 2; pass++)
+			{
+				for (UI32 offset = 0; offset < mThreadCount; offset++)
+				{
+					const UI32 victim = (firstVictim + offset) % mThreadCount;
+					if (victim == threadIndex || (pSlots[victim].mL3DomainIndex == slot.mL3DomainIndex) != (pass == 0))
+						continue;
+
+					if (pSlots[victim].mDeque.Steal(pJob))
+						return pJob;
+				}
+			}
+
+			return nullptr;
+		}
+
+		void JobSystem::Execute(Job* pJob)
+		{
+			JobCounter* pCounter = pJob->pCounter;
+
+			pJob->pInvoke(*pJob);
+			FreeJob(pJob);
+
+			if (pCounter)
+				CompleteJob(*pCounter);
+		}
+
+		void JobSystem::CompleteJob(JobCounter& counter)
+		{
+			// The last job swaps its count for a completing unit, so that the counter is not complete until the
+			// continuations are scheduled.
+			I64 value = counter.mValue.load(std::memory_order_relaxed);
+			bool bIsLast = false;
+			do {
+				bIsLast = (value & JobCounter::PendingMask) == 1;
+			} while (!counter.mValue.compare_exchange_weak(value, value - 1 + (bIsLast ? JobCounter::CompletingUnit : 0), std::memory_order_acq_rel, std::memory_order_relaxed));
+
+			if (bIsLast)
+			{
+				Job* pContinuations = nullptr;
+				{
+					std::lock_guard<std::mutex> _lock(counter.mContinuationMutex);
+					pContinuations = counter.pContinuations;
+					counter.pContinuations = nullptr;
+				}
+
+				while (pContinuations)
+				{
+					Job* pNext = pContinuations->pNext;
+					Submit(pContinuations);
+					pContinuations = pNext;
+				}
+
+				// This is the last access to the counter.
+				counter.mValue.fetch_sub(JobCounter::CompletingUnit, std::memory_order_seq_cst);
+
+				if (mExternalWaiterCount.load(std::memory_order_seq_cst))
+				{
+					{
+						std::lock_guard<std::mutex> _lock(mWaitMutex);
+					}
+					mWaitCondition.notify_all();
+				}
+			}
+		}
+
+		bool JobSystem::HasWork() const
+		{
+			if (mInjectedCount.load(std::memory_order_relaxed))
+				return true;
+
+			for (UI32 index = 0; index < mThreadCount; index++)
+				if (!pSlots[index].mDeque.IsEmpty())
+					return true;
+
+			return false;
+		}
+
+		void JobSystem::WakeWorker()
+		{
+			// Pairs with the fence in Park(). Either the parking worker sees the new job, or this sees the worker.
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (!mSleepingCount.load(std::memory_order_relaxed))
+				return;
+
+			{
+				std::lock_guard<std::mutex> _lock(mParkMutex);
+				mWakeEpoch.fetch_add(1, std::memory_order_relaxed);
+			}
+			mParkCondition.notify_one();
+		}
+
+		void JobSystem::Park()
+		{
+			const UI64 epoch = mWakeEpoch.load(std::memory_order_acquire);
+			mSleepingCount.fetch_add(1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			if (!HasWork())
+			{
+				std::unique_lock<std::mutex> _lock(mParkMutex);
+				mParkCondition.wait(_lock, [this, epoch]
+					{
+						return mWakeEpoch.load(std::memory_order_relaxed) != epoch || !bIsRunning.load(std::memory_order_relaxed);
+					});
+			}
+
+			mSleepingCount.fetch_sub(1, std::memory_order_relaxed);
+		}
+
+		void JobSystem::WorkerFunction(UI32 threadIndex)
+		{
+			DMK_PROFILE_THREAD("Job Worker");
+
+			_Helpers::pCurrentSystem = this;
+			_Helpers::CurrentThreadIndex = threadIndex;
+
+			UI32 idleCount = 0;
+			while (bIsRunning.load(std::memory_order_relaxed))
+			{
+				if (Job* pJob = FindJob(threadIndex))
+				{
+					Execute(pJob);
+					idleCount = 0;
+				}
+				else if (++idleCount < _Helpers::IdleSpinCount)
+					Utilities::Pause();
+				else
+				{
+					Park();
+					idleCount = 0;
+				}
+			}
+		}
+	}
+}
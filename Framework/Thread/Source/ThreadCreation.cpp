@@ -0,0 +1,218 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Thread/ThreadCreation.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#endif
+
+namespace DMK
+{
+	namespace Thread
+	{
+		namespace _Helpers
+		{
+#ifdef __linux__
+			constexpr int MemoryPolicyPreferred = 1;	// MPOL_PREFERRED, from linux/mempolicy.h.
+
+			/**
+			 * Get the nice value of a priority.
+			 */
+			int GetNiceValue(ThreadPriority priority)
+			{
+				switch (priority)
+				{
+				case ThreadPriority::LOWEST:
+					return 19;
+				case ThreadPriority::LOW:
+					return 10;
+				case ThreadPriority::HIGH:
+					return -5;
+				case ThreadPriority::HIGHEST:
+				case ThreadPriority::REAL_TIME:
+					return -10;
+				default:
+					return 0;
+				}
+			}
+
+#elif defined(_WIN32)
+			/**
+			 * Get the Windows priority of a priority.
+			 */
+			int GetWindowsPriority(ThreadPriority priority)
+			{
+				switch (priority)
+				{
+				case ThreadPriority::LOWEST:
+					return THREAD_PRIORITY_LOWEST;
+				case ThreadPriority::LOW:
+					return THREAD_PRIORITY_BELOW_NORMAL;
+				case ThreadPriority::HIGH:
+					return THREAD_PRIORITY_ABOVE_NORMAL;
+				case ThreadPriority::HIGHEST:
+					return THREAD_PRIORITY_HIGHEST;
+				case ThreadPriority::REAL_TIME:
+					return THREAD_PRIORITY_TIME_CRITICAL;
+				default:
+					return THREAD_PRIORITY_NORMAL;
+				}
+			}
+
+#endif
+		}
+
+		bool SetCurrentThreadName(const std::string& name)
+		{
+#ifdef __linux__
+			return pthread_setname_np(pthread_self(), name.substr(0, 15).c_str()) == 0;
+
+#elif defined(_WIN32)
+			std::wstring wideName(name.size(), L'\0');
+			wideName.resize(MultiByteToWideChar(CP_UTF8, 0, name.data(), static_cast<int>(name.size()), wideName.data(), static_cast<int>(wideName.size())));
+			return SUCCEEDED(SetThreadDescription(GetCurrentThread(), wideName.c_str()));
+
+#else
+			return false;
+
+#endif
+		}
+
+		bool SetCurrentThreadAffinity(const CPUSet& affinity)
+		{
+			if (affinity.IsEmpty())
+				return false;
+
+#ifdef __linux__
+			cpu_set_t set;
+			CPU_ZERO(&set);
+			for (const UI32 index : affinity.GetIndexes())
+				if (index < CPU_SETSIZE)
+					CPU_SET(index, &set);
+
+			return sched_setaffinity(0, sizeof(set), &set) == 0;
+
+#elif defined(_WIN32)
+			DWORD_PTR mask = 0;
+			for (const UI32 index : affinity.GetIndexes())
+				if (index < sizeof(DWORD_PTR) * 8)
+					mask |= DWORD_PTR(1) << index;
+
+			return mask && SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+
+#else
+			return false;
+
+#endif
+		}
+
+		CPUSet GetCurrentThreadAffinity()
+		{
+			CPUSet affinity;
+
+#ifdef __linux__
+			cpu_set_t set;
+			CPU_ZERO(&set);
+			if (sched_getaffinity(0, sizeof(set), &set) == 0)
+				for (UI32 index = 0; index < CPU_SETSIZE && index < MaxLogicalProcessorCount; index++)
+					if (CPU_ISSET(index, &set))
+						affinity.Add(index);
+
+#elif defined(_WIN32)
+			// Windows has no query for the thread affinity. Setting a mask returns the previous one, which is
+			// then put back.
+			DWORD_PTR processMask = 0, systemMask = 0;
+			if (GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask) && processMask)
+			{
+				const DWORD_PTR mask = SetThreadAffinityMask(GetCurrentThread(), processMask);
+				if (mask)
+				{
+					SetThreadAffinityMask(GetCurrentThread(), mask);
+					for (UI32 index = 0; index < sizeof(DWORD_PTR) * 8; index++)
+						if (mask & (DWORD_PTR(1) << index))
+							affinity.Add(index);
+				}
+			}
+
+#endif
+
+			return affinity;
+		}
+
+		bool SetCurrentThreadPriority(ThreadPriority priority)
+		{
+#ifdef __linux__
+			// Real time threads are scheduled first in first out. Without the capability, fall back to the
+			// highest nice value.
+			if (priority == ThreadPriority::REAL_TIME)
+			{
+				sched_param parameters = {};
+				parameters.sched_priority = (sched_get_priority_min(SCHED_FIFO) + sched_get_priority_max(SCHED_FIFO)) / 2;
+				if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &parameters) == 0)
+					return true;
+			}
+			else
+			{
+				sched_param parameters = {};
+				pthread_setschedparam(pthread_self(), SCHED_OTHER, &parameters);
+			}
+
+			// Nice values are per thread on Linux.
+			return setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), _Helpers::GetNiceValue(priority)) == 0;
+
+#elif defined(_WIN32)
+			return SetThreadPriority(GetCurrentThread(), _Helpers::GetWindowsPriority(priority)) != 0;
+
+#else
+			return false;
+
+#endif
+		}
+
+		bool BindCurrentThreadMemory(UI32 nodeID)
+		{
+#if defined(__linux__) && defined(SYS_set_mempolicy)
+			constexpr UI64 BitsPerWord = sizeof(unsigned long) * 8;
+
+			unsigned long nodeMask[MaxLogicalProcessorCount / BitsPerWord] = {};
+			if (nodeID >= MaxLogicalProcessorCount)
+				return false;
+
+			nodeMask[nodeID / BitsPerWord] |= 1ul << (nodeID % BitsPerWord);
+			return syscall(SYS_set_mempolicy, _Helpers::MemoryPolicyPreferred, nodeMask, MaxLogicalProcessorCount + 1) == 0;
+
+#else
+			return false;
+
+#endif
+		}
+
+		bool ApplyThreadCreateInfo(const ThreadCreateInfo& createInfo)
+		{
+			bool bIsApplied = true;
+
+			if (!createInfo.mName.empty())
+				bIsApplied &= SetCurrentThreadName(createInfo.mName);
+
+			if (!createInfo.mAffinity.IsEmpty())
+				bIsApplied &= SetCurrentThreadAffinity(createInfo.mAffinity);
+
+			if (createInfo.mPriority != ThreadPriority::NORMAL)
+				bIsApplied &= SetCurrentThreadPriority(createInfo.mPriority);
+
+			if (createInfo.mNUMANodeID >= 0)
+				bIsApplied &= BindCurrentThreadMemory(static_cast<UI32>(createInfo.mNUMANodeID));
+
+			return bIsApplied;
+		}
+	}
+}
@@ -0,0 +1,346 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#include "Thread/Topology.h"
+
+#include <algorithm>
+#include <map>
+#include <thread>
+
+#ifdef _WIN32
+#include <Windows.h>
+
+#elif defined(__linux__)
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#endif
+
+namespace DMK
+{
+	namespace Thread
+	{
+		namespace _Helpers
+		{
+			/**
+			 * Replace the keys of a field with dense indexes, in the order of their first appearance. The keys can
+			 * be stored by index, to map the dense indexes back.
+			 */
+			template<class Getter>
+			UI32 MakeDenseIndexes(std::vector<LogicalProcessor>& processors, Getter getter, std::vector<UI32>* pKeys = nullptr)
+			{
+				std::map<UI32, UI32> indexes;
+				for (LogicalProcessor& processor : processors)
+				{
+					UI32& value = getter(processor);
+					const auto [iterator, bIsInserted] = indexes.emplace(value, static_cast<UI32>(indexes.size()));
+					if (bIsInserted && pKeys)
+						pKeys->push_back(value);
+
+					value = iterator->second;
+				}
+
+				return static_cast<UI32>(indexes.size());
+			}
+
+#ifdef __linux__
+			/**
+			 * Read the first line of a file. Empty if the file cannot be read.
+			 */
+			std::string ReadLine(const std::string& path)
+			{
+				std::string line;
+				if (FILE* pFile = fopen(path.c_str(), "r"))
+				{
+					char buffer[4096] = {};
+					if (fgets(buffer, sizeof(buffer), pFile))
+						line = buffer;
+
+					fclose(pFile);
+				}
+
+				while (!line.empty() && (line.back() == '\n' || line.back() == ' '))
+					line.pop_back();
+
+				return line;
+			}
+
+			/**
+			 * Parse a CPU list such as "0-3,8,10-11".
+			 */
+			std::vector<UI32> ParseCPUList(const std::string& list)
+			{
+				std::vector<UI32> indexes;
+				const char* pValue = list.c_str();
+				while (*pValue)
+				{
+					char* pEnd = nullptr;
+					const UI32 first = static_cast<UI32>(strtoul(pValue, &pEnd, 10));
+					if (pEnd == pValue)
+						break;
+
+					UI32 last = first;
+					if (*pEnd == '-')
+					{
+						pValue = pEnd + 1;
+						last = static_cast<UI32>(strtoul(pValue, &pEnd, 10));
+					}
+
+					for (UI32 index = first; index <= last && index < MaxLogicalProcessorCount; index++)
+						indexes.push_back(index);
+
+					pValue = *pEnd == ',' ? pEnd + 1 : pEnd;
+				}
+
+				return indexes;
+			}
+
+			/**
+			 * Discover the topology from /sys/devices/system.
+			 */
+			std::vector<LogicalProcessor> DiscoverProcessors()
+			{
+				std::vector<LogicalProcessor> processors;
+				for (const UI32 index : ParseCPUList(ReadLine("/sys/devices/system/cpu/online")))
+				{
+					const std::string cpuPath = "/sys/devices/system/cpu/cpu" + std::to_string(index);
+
+					LogicalProcessor processor;
+					processor.mIndex = index;
+					processor.mPackageIndex = static_cast<UI32>(atoi(ReadLine(cpuPath + "/topology/physical_package_id").c_str()));
+					processor.mCoreIndex = (processor.mPackageIndex << 16) | static_cast<UI32>(atoi(ReadLine(cpuPath + "/topology/core_id").c_str()));
+
+					// The L3 domain is named by its first processor. Without an L3 cache, the package is the domain.
+					processor.mL3DomainIndex = MaxLogicalProcessorCount + processor.mPackageIndex;
+					for (UI32 cacheIndex = 0; cacheIndex < 8; cacheIndex++)
+					{
+						const std::string cachePath = cpuPath + "/cache/index" + std::to_string(cacheIndex);
+						const std::string level = ReadLine(cachePath + "/level");
+						if (level.empty())
+							break;
+
+						if (level == "3")
+						{
+							const std::vector<UI32> sharedProcessors = ParseCPUList(ReadLine(cachePath + "/shared_cpu_list"));
+							if (!sharedProcessors.empty())
+								processor.mL3DomainIndex = sharedProcessors.front();
+						}
+					}
+
+					processors.push_back(processor);
+				}
+
+				// Nodes list their processors. Machines without NUMA support have no node directories.
+				for (const UI32 node : ParseCPUList(ReadLine("/sys/devices/system/node/online")))
+					for (const UI32 index : ParseCPUList(ReadLine("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist")))
+						for (LogicalProcessor& processor : processors)
+							if (processor.mIndex == index)
+								processor.mNUMANodeIndex = node;
+
+				return processors;
+			}
+
+#elif defined(_WIN32)
+			/**
+			 * Call a function for every processor of the first group in a group mask.
+			 */
+			template<class Function>
+			void ForEachProcessor(const GROUP_AFFINITY& affinity, Function function)
+			{
+				if (affinity.Group != 0)
+					return;
+
+				for (UI32 index = 0; index < sizeof(KAFFINITY) * 8; index++)
+					if (affinity.Mask & (KAFFINITY(1) << index))
+						function(index);
+			}
+
+			/**
+			 * Discover the topology using GetLogicalProcessorInformationEx().
+			 */
+			std::vector<LogicalProcessor> DiscoverProcessors()
+			{
+				DWORD size = 0;
+				GetLogicalProcessorInformationEx(RelationAll, nullptr, &size);
+
+				std::vector<BYTE> buffer(size);
+				auto pFirst = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data());
+				if (!size || !GetLogicalProcessorInformationEx(RelationAll, pFirst, &size))
+					return {};
+
+				std::map<UI32, LogicalProcessor> processors;
+				UI32 coreIndex = 0, packageIndex = 0, domainIndex = 0;
+
+				for (DWORD offset = 0; offset < size;)
+				{
+					auto pInfo = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.data() + offset);
+					switch (pInfo->Relationship)
+					{
+					case RelationProcessorCore:
+						ForEachProcessor(pInfo->Processor.GroupMask[0], [&](UI32 index) { processors[index].mIndex = index; processors[index].mCoreIndex = coreIndex; });
+						coreIndex++;
+						break;
+
+					case RelationProcessorPackage:
+						for (WORD group = 0; group < pInfo->Processor.GroupCount; group++)
+							ForEachProcessor(pInfo->Processor.GroupMask[group], [&](UI32 index) { processors[index].mPackageIndex = packageIndex; });
+						packageIndex++;
+						break;
+
+					case RelationCache:
+						if (pInfo->Cache.Level == 3)
+						{
+							ForEachProcessor(pInfo->Cache.GroupMask, [&](UI32 index) { processors[index].mL3DomainIndex = domainIndex; });
+							domainIndex++;
+						}
+						break;
+
+					case RelationNumaNode:
+						ForEachProcessor(pInfo->NumaNode.GroupMask, [&](UI32 index) { processors[index].mNUMANodeIndex = pInfo->NumaNode.NodeNumber; });
+						break;
+
+					default:
+						break;
+					}
+
+					offset += pInfo->Size;
+				}
+
+				std::vector<LogicalProcessor> result;
+				for (const auto& entry : processors)
+					result.push_back(entry.second);
+
+				return result;
+			}
+
+#else
+			std::vector<LogicalProcessor> DiscoverProcessors() { return {}; }
+
+#endif
+		}
+
+		const CPUTopology& CPUTopology::Get()
+		{
+			static const CPUTopology topology = Discover();
+			return topology;
+		}
+
+		CPUTopology CPUTopology::Discover()
+		{
+			std::vector<LogicalProcessor> processors = _Helpers::DiscoverProcessors();
+
+			// Fall back to one core per hardware thread.
+			if (processors.empty())
+			{
+				const UI32 count = std::max(std::thread::hardware_concurrency(), 1u);
+				for (UI32 index = 0; index < count; index++)
+				{
+					LogicalProcessor processor;
+					processor.mIndex = index;
+					processor.mCoreIndex = index;
+					processors.push_back(processor);
+				}
+			}
+
+			return Create(std::move(processors));
+		}
+
+		CPUTopology CPUTopology::Create(std::vector<LogicalProcessor> processors)
+		{
+			std::sort(processors.begin(), processors.end(), [](const LogicalProcessor& lhs, const LogicalProcessor& rhs) { return lhs.mIndex < rhs.mIndex; });
+
+			CPUTopology topology;
+			topology.mCoreCount = _Helpers::MakeDenseIndexes(processors, [](LogicalProcessor& processor) -> UI32& { return processor.mCoreIndex; });
+			topology.mPackageCount = _Helpers::MakeDenseIndexes(processors, [](LogicalProcessor& processor) -> UI32& { return processor.mPackageIndex; });
+			topology.mL3DomainCount = _Helpers::MakeDenseIndexes(processors, [](LogicalProcessor& processor) -> UI32& { return processor.mL3DomainIndex; });
+			topology.mNUMANodeCount = _Helpers::MakeDenseIndexes(processors, [](LogicalProcessor& processor) -> UI32& { return processor.mNUMANodeIndex; }, &topology.mNUMANodeIDs);
+
+			std::vector<UI32> siblingCounts(topology.mCoreCount, 0);
+			for (LogicalProcessor& processor : processors)
+				processor.mSMTIndex = siblingCounts[processor.mCoreIndex]++;
+
+			topology.mProcessors = std::move(processors);
+			return topology;
+		}
+
+		const LogicalProcessor* CPUTopology::FindLogicalProcessor(UI32 index) const
+		{
+			for (const LogicalProcessor& processor : mProcessors)
+				if (processor.mIndex == index)
+					return &processor;
+
+			return nullptr;
+		}
+
+		CPUSet CPUTopology::GetCoreSet(UI32 coreIndex) const
+		{
+			CPUSet set;
+			for (const LogicalProcessor& processor : mProcessors)
+				if (processor.mCoreIndex == coreIndex)
+					set.Add(processor.mIndex);
+
+			return set;
+		}
+
+		CPUSet CPUTopology::GetL3DomainSet(UI32 domainIndex) const
+		{
+			CPUSet set;
+			for (const LogicalProcessor& processor : mProcessors)
+				if (processor.mL3DomainIndex == domainIndex)
+					set.Add(processor.mIndex);
+
+			return set;
+		}
+
+		I32 CPUTopology::GetNUMANodeID(UI32 nodeIndex) const
+		{
+			return nodeIndex < mNUMANodeIDs.size() ? static_cast<I32>(mNUMANodeIDs[nodeIndex]) : -1;
+		}
+
+		CPUSet CPUTopology::GetNUMANodeSet(UI32 nodeIndex) const
+		{
+			CPUSet set;
+			for (const LogicalProcessor& processor : mProcessors)
+				if (processor.mNUMANodeIndex == nodeIndex)
+					set.Add(processor.mIndex);
+
+			return set;
+		}
+
+		CPUSet CPUTopology::GetPrimarySet() const
+		{
+			CPUSet set;
+			for (const LogicalProcessor& processor : mProcessors)
+				if (!processor.mSMTIndex)
+					set.Add(processor.mIndex);
+
+			return set;
+		}
+
+		std::vector<UI32> CPUTopology::GetPlacementOrder(I32 nodeIndex) const
+		{
+			std::vector<const LogicalProcessor*> candidates;
+			for (const LogicalProcessor& processor : mProcessors)
+				if (nodeIndex < 0 || processor.mNUMANodeIndex == static_cast<UI32>(nodeIndex))
+					candidates.push_back(&processor);
+
+			std::stable_sort(candidates.begin(), candidates.end(), [](const LogicalProcessor* pLHS, const LogicalProcessor* pRHS)
+				{
+					if (pLHS->mSMTIndex != pRHS->mSMTIndex)
+						return pLHS->mSMTIndex < pRHS->mSMTIndex;
+
+					if (pLHS->mL3DomainIndex != pRHS->mL3DomainIndex)
+						return pLHS->mL3DomainIndex < pRHS->mL3DomainIndex;
+
+					return pLHS->mCoreIndex < pRHS->mCoreIndex;
+				});
+
+			std::vector<UI32> order;
+			for (const LogicalProcessor* pProcessor : candidates)
+				order.push_back(pProcessor->mIndex);
+
+			return order;
+		}
+	}
+}
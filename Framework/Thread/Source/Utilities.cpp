@@ -3,19 +3,106 @@
 
 #include "Thread/Utilities.h"
 
-#include <chrono>
 #include <thread>
 
+#ifdef _WIN32
+#include <Windows.h>
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+
+#endif
+
+#elif defined(__linux__)
+#include <cerrno>
+#include <time.h>
+
+#endif
+
 namespace DMK
 {
 	namespace Thread
 	{
 		namespace Utilities
 		{
-			void Sleep(UI64 duration)
+			namespace _Helpers
+			{
+#ifdef _WIN32
+				/**
+				 * Get the waitable timer of the calling thread. High resolution timers need Windows 10 1803, and
+				 * older versions get a normal one.
+				 */
+				HANDLE GetThreadTimer()
+				{
+					struct TimerHandle {
+						TimerHandle()
+						{
+							mHandle = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+							if (!mHandle)
+								mHandle = CreateWaitableTimerExW(nullptr, nullptr, 0, TIMER_ALL_ACCESS);
+						}
+
+						~TimerHandle() { if (mHandle) CloseHandle(mHandle); }
+
+						HANDLE mHandle = nullptr;
+					};
+
+					thread_local TimerHandle timer;
+					return timer.mHandle;
+				}
+
+#endif
+
+				/**
+				 * Block the thread until a time point, which may be woken up late.
+				 */
+				void BlockUntil(TimePoint wakeTime)
+				{
+#if defined(__linux__)
+					// The steady clock is CLOCK_MONOTONIC on Linux.
+					const auto sinceEpoch = std::chrono::duration_cast<Nanoseconds>(wakeTime.time_since_epoch()).count();
+
+					timespec time = {};
+					time.tv_sec = static_cast<time_t>(sinceEpoch / 1000000000);
+					time.tv_nsec = static_cast<long>(sinceEpoch % 1000000000);
+
+					while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &time, nullptr) == EINTR);
+
+#elif defined(_WIN32)
+					// Waitable timers take negative due times in 100 nanosecond units as relative times.
+					const HANDLE timer = GetThreadTimer();
+					const auto remaining = std::chrono::duration_cast<Nanoseconds>(wakeTime - Clock::now()).count();
+					if (remaining <= 0)
+						return;
+
+					LARGE_INTEGER dueTime = {};
+					dueTime.QuadPart = -static_cast<LONGLONG>(remaining / 100);
+					if (timer && SetWaitableTimerEx(timer, &dueTime, 0, nullptr, nullptr, nullptr, 0))
+						WaitForSingleObject(timer, INFINITE);
+					else
+						std::this_thread::sleep_until(wakeTime);
+
+#else
+					std::this_thread::sleep_until(wakeTime);
+
+#endif
+				}
+			}
+
+			void SleepUntil(TimePoint deadline, Duration spinThreshold)
+			{
+				const TimePoint wakeTime = deadline - spinThreshold;
+				if (Clock::now() < wakeTime)
+					_Helpers::BlockUntil(wakeTime);
+
+				while (Clock::now() < deadline)
+					Pause();
+			}
+
+			void Sleep(Duration duration, Duration spinThreshold)
 			{
-				std::this_thread::sleep_for(std::chrono::microseconds(duration));
+				SleepUntil(Clock::now() + duration, spinThreshold);
 			}
 		}
 	}
-}
\ No newline at end of file
+}
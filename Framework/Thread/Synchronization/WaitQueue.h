@@ -0,0 +1,157 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Thread/Utilities.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace DMK
+{
+	namespace Thread
+	{
+		/**
+		 * Wait Queue object.
+		 * Threads wait here until a condition holds. A waiter first spins for a while, as the condition usually
+		 * becomes true within a few microseconds when the other thread is busy, and then parks on a condition
+		 * variable (a futex on Linux) so that an idle thread does not use any CPU time.
+		 *
+		 * The spin limit adapts: it grows when spinning succeeds and shrinks when the waiter had to park anyway.
+		 *
+		 * The thread which makes the condition true must call NotifyOne() or NotifyAll() afterwards. Notifying is
+		 * a fence and a load when nobody is parked.
+		 */
+		class WaitQueue {
+		public:
+			static constexpr UI32 MinimumSpinCount = 16;	// The smallest spin limit.
+			static constexpr UI32 MaximumSpinCount = 4096;	// The largest spin limit.
+
+			WaitQueue() {}
+			~WaitQueue() {}
+
+			WaitQueue(const WaitQueue&) = delete;
+			WaitQueue& operator=(const WaitQueue&) = delete;
+
+			/**
+			 * Wait until a condition holds.
+			 *
+			 * @param condition: The condition, called as condition() and returning a boolean.
+			 */
+			template<class Condition>
+			void Wait(Condition&& condition)
+			{
+				if (Spin(condition))
+					return;
+
+				mParkedCount.fetch_add(1, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);	// Pairs with the fence in Notify.
+				{
+					std::unique_lock<std::mutex> _lock(mMutex);
+					mCondition.wait(_lock, condition);
+				}
+				mParkedCount.fetch_sub(1, std::memory_order_relaxed);
+			}
+
+			/**
+			 * Wait until a condition holds or a timeout expires.
+			 *
+			 * @param condition: The condition, called as condition() and returning a boolean.
+			 * @param timeout: The longest time to wait.
+			 * @return True if the condition holds, false if the wait timed out.
+			 */
+			template<class Condition, class Rep, class Period>
+			bool WaitFor(Condition&& condition, std::chrono::duration<Rep, Period> timeout)
+			{
+				if (Spin(condition))
+					return true;
+
+				mParkedCount.fetch_add(1, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+
+				bool bResult = false;
+				{
+					std::unique_lock<std::mutex> _lock(mMutex);
+					bResult = mCondition.wait_for(_lock, timeout, condition);
+				}
+				mParkedCount.fetch_sub(1, std::memory_order_relaxed);
+
+				return bResult;
+			}
+
+			/**
+			 * Wake one parked thread, if any.
+			 */
+			DMK_FORCEINLINE void NotifyOne()
+			{
+				if (HasParkedThreads())
+				{
+					{
+						std::lock_guard<std::mutex> _lock(mMutex);
+					}
+					mCondition.notify_one();
+				}
+			}
+
+			/**
+			 * Wake all the parked threads, if any.
+			 */
+			DMK_FORCEINLINE void NotifyAll()
+			{
+				if (HasParkedThreads())
+				{
+					{
+						std::lock_guard<std::mutex> _lock(mMutex);
+					}
+					mCondition.notify_all();
+				}
+			}
+
+		private:
+			/**
+			 * Spin until the condition holds or the spin limit is reached, and adapt the limit.
+			 */
+			template<class Condition>
+			bool Spin(Condition& condition)
+			{
+				const UI32 spinLimit = mSpinLimit.load(std::memory_order_relaxed);
+				for (UI32 iteration = 0; iteration < spinLimit; iteration++)
+				{
+					if (condition())
+					{
+						if (spinLimit < MaximumSpinCount)
+							mSpinLimit.store(spinLimit * 2, std::memory_order_relaxed);
+
+						return true;
+					}
+
+					Utilities::Pause();
+				}
+
+				if (spinLimit > MinimumSpinCount)
+					mSpinLimit.store(spinLimit / 2, std::memory_order_relaxed);
+
+				return condition();
+			}
+
+			/**
+			 * Check if any thread is parked.
+			 * The condition was made true before this is called. Either the parking thread sees it when it checks
+			 * the condition under the mutex, or this sees the parked count.
+			 */
+			DMK_FORCEINLINE bool HasParkedThreads() const
+			{
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				return mParkedCount.load(std::memory_order_relaxed) != 0;
+			}
+
+			std::mutex mMutex;	// Guards parking.
+			std::condition_variable mCondition;	// Parked threads wait on this.
+			std::atomic<UI32> mParkedCount = { 0 };	// Number of parked threads.
+			std::atomic<UI32> mSpinLimit = { 256 };	// Current spin limit.
+		};
+	}
+}
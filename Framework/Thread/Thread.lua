@@ -7,7 +7,7 @@ project "Thread"
 	kind "StaticLib"
 	language "C++"
 	systemversion "latest"
-	cppdialect "C++17"
+	cppdialect "C++20"
 	staticruntime "On"
 
 	defines {
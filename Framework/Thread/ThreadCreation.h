@@ -0,0 +1,119 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Topology.h"
+
+#include <functional>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace DMK
+{
+	namespace Thread
+	{
+		/**
+		 * Thread Priority enum.
+		 */
+		enum class ThreadPriority : UI8 {
+			LOWEST,
+			LOW,
+			NORMAL,
+			HIGH,
+			HIGHEST,
+
+			/**
+			 * Real time scheduling. SCHED_FIFO on Linux, which needs CAP_SYS_NICE (HIGHEST is used without it), and
+			 * THREAD_PRIORITY_TIME_CRITICAL on Windows.
+			 */
+			REAL_TIME,
+		};
+
+		/**
+		 * Thread Create Info structure.
+		 * Describes where and how a thread runs. The defaults leave the thread as the operating system creates it.
+		 */
+		struct ThreadCreateInfo {
+			std::string mName;	// The thread name shown by debuggers and profilers. Linux keeps the first 15 characters.
+			CPUSet mAffinity;	// The logical processors the thread may run on. Empty for all of them.
+			ThreadPriority mPriority = ThreadPriority::NORMAL;	// The scheduling priority.
+			I32 mNUMANodeID = -1;	// The operating system's id of the NUMA node to allocate memory from. -1 for the default policy.
+		};
+
+		/**
+		 * Set the name of the calling thread.
+		 *
+		 * @param name: The thread name.
+		 * @return Boolean value stating if the name was set.
+		 */
+		bool SetCurrentThreadName(const std::string& name);
+
+		/**
+		 * Restrict the calling thread to a set of logical processors.
+		 * On Windows only the processors of the first processor group are used.
+		 *
+		 * @param affinity: The CPU set. Must not be empty.
+		 * @return Boolean value stating if the affinity was set.
+		 */
+		bool SetCurrentThreadAffinity(const CPUSet& affinity);
+
+		/**
+		 * Get the logical processors the calling thread may run on.
+		 * On Windows only the processors of the first processor group are reported.
+		 *
+		 * @return The CPU set. Empty if the affinity cannot be queried.
+		 */
+		CPUSet GetCurrentThreadAffinity();
+
+		/**
+		 * Set the scheduling priority of the calling thread.
+		 * On Linux the priorities above NORMAL need CAP_SYS_NICE or a raised RLIMIT_NICE.
+		 *
+		 * @param priority: The priority.
+		 * @return Boolean value stating if the priority was set.
+		 */
+		bool SetCurrentThreadPriority(ThreadPriority priority);
+
+		/**
+		 * Prefer a NUMA node for the memory the calling thread allocates from now on.
+		 * Memory is first touched by the worker which uses it, so this keeps a pinned worker's memory local.
+		 *
+		 * @param nodeID: The operating system's id of the NUMA node, which is not the dense topology index. See
+		 * CPUTopology::GetNUMANodeID().
+		 * @return Boolean value stating if the policy was set. Always false on machines without NUMA support, and on
+		 * Windows, which has no thread memory policy and allocates on the node of the processor touching the memory.
+		 */
+		bool BindCurrentThreadMemory(UI32 nodeID);
+
+		/**
+		 * Apply a create info to the calling thread.
+		 * Every setting is attempted, and a failed one does not prevent the others.
+		 *
+		 * @param createInfo: The thread create info.
+		 * @return Boolean value stating if all the settings were applied.
+		 */
+		bool ApplyThreadCreateInfo(const ThreadCreateInfo& createInfo);
+
+		/**
+		 * Create a thread with a name, affinity, priority and memory node.
+		 * The settings are applied by the new thread before it calls the function, so the function never runs
+		 * with the default placement.
+		 *
+		 * @param createInfo: The thread create info.
+		 * @param function: The function to execute.
+		 * @param arguments: The arguments to pass to the function.
+		 * @return The thread object.
+		 */
+		template<class Function, class... Arguments>
+		std::thread CreateThread(ThreadCreateInfo createInfo, Function&& function, Arguments&&... arguments)
+		{
+			return std::thread([createInfo = std::move(createInfo)](auto&& function, auto&&... arguments)
+				{
+					ApplyThreadCreateInfo(createInfo);
+					std::invoke(std::move(function), std::move(arguments)...);
+				}, std::forward<Function>(function), std::forward<Arguments>(arguments)...);
+		}
+	}
+}
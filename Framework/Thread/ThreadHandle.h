@@ -4,6 +4,7 @@
 #pragma once
 
 #include "Commands/CommandQueue.h"
+#include "ThreadCreation.h"
 
 #include <thread>
 #include <queue>
@@ -46,6 +47,19 @@ namespace DMK
 			{
 			}
 
+			/**
+			 * Start the thread with a name, affinity, priority and memory node.
+			 *
+			 * @param createInfo: The thread create info.
+			 * @param function: The function to execute.
+			 * @param arguments: The arguments to pass to the function.
+			 */
+			template<class Function, class... Arguments>
+			void StartThread(ThreadCreateInfo createInfo, Function&& function, Arguments&&... arguments)
+			{
+				mThread = CreateThread(std::move(createInfo), std::forward<Function>(function), std::forward<Arguments>(arguments)...);
+			}
+
 		private:
 
 		protected:
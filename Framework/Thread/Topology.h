@@ -0,0 +1,216 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "Core/Types/DataTypes.h"
+
+#include <bitset>
+#include <vector>
+
+namespace DMK
+{
+	namespace Thread
+	{
+		/**
+		 * Largest number of logical processors the engine can address.
+		 */
+		constexpr UI32 MaxLogicalProcessorCount = 1024;
+
+		/**
+		 * CPU Set object.
+		 * A set of logical processor indexes, used as an affinity mask.
+		 */
+		class CPUSet {
+		public:
+			CPUSet() {}
+			~CPUSet() {}
+
+			/**
+			 * Add a logical processor.
+			 *
+			 * @param index: The logical processor index.
+			 */
+			void Add(UI32 index) { if (index < MaxLogicalProcessorCount) mBits.set(index); }
+
+			/**
+			 * Remove a logical processor.
+			 *
+			 * @param index: The logical processor index.
+			 */
+			void Remove(UI32 index) { if (index < MaxLogicalProcessorCount) mBits.reset(index); }
+
+			/**
+			 * Check if the set contains a logical processor.
+			 *
+			 * @param index: The logical processor index.
+			 * @return Boolean value.
+			 */
+			bool Contains(UI32 index) const { return index < MaxLogicalProcessorCount && mBits.test(index); }
+
+			/**
+			 * Get the number of logical processors in the set.
+			 *
+			 * @return The count.
+			 */
+			UI32 Count() const { return static_cast<UI32>(mBits.count()); }
+
+			/**
+			 * Check if the set is empty.
+			 *
+			 * @return Boolean value.
+			 */
+			bool IsEmpty() const { return mBits.none(); }
+
+			/**
+			 * Get the logical processor indexes in the set, in ascending order.
+			 *
+			 * @return The indexes.
+			 */
+			std::vector<UI32> GetIndexes() const
+			{
+				std::vector<UI32> indexes;
+				for (UI32 index = 0; index < MaxLogicalProcessorCount; index++)
+					if (mBits.test(index))
+						indexes.push_back(index);
+
+				return indexes;
+			}
+
+			CPUSet operator|(const CPUSet& other) const { CPUSet set; set.mBits = mBits | other.mBits; return set; }
+			CPUSet operator&(const CPUSet& other) const { CPUSet set; set.mBits = mBits & other.mBits; return set; }
+			bool operator==(const CPUSet& other) const { return mBits == other.mBits; }
+			bool operator!=(const CPUSet& other) const { return mBits != other.mBits; }
+
+		private:
+			std::bitset<MaxLogicalProcessorCount> mBits;	// One bit per logical processor.
+		};
+
+		/**
+		 * Logical Processor structure.
+		 * Describes where a logical processor (a hardware thread) is. All the indexes are dense, starting at 0.
+		 */
+		struct LogicalProcessor {
+			UI32 mIndex = 0;	// The operating system's index of the logical processor.
+			UI32 mCoreIndex = 0;	// The physical core.
+			UI32 mSMTIndex = 0;	// The index among the SMT siblings of the core. 0 is the primary thread.
+			UI32 mPackageIndex = 0;	// The socket.
+			UI32 mL3DomainIndex = 0;	// The processors sharing a last level cache.
+			UI32 mNUMANodeIndex = 0;	// The memory node.
+		};
+
+		/**
+		 * CPU Topology object.
+		 * The topology is discovered from the operating system once: /sys/devices/system on Linux and
+		 * GetLogicalProcessorInformationEx() on Windows, where only the first processor group is used. If it
+		 * cannot be discovered, every hardware thread is reported as its own core in one domain and node.
+		 */
+		class CPUTopology {
+		public:
+			CPUTopology() {}
+			~CPUTopology() {}
+
+			/**
+			 * Get the topology of the machine.
+			 *
+			 * @return The topology reference.
+			 */
+			static const CPUTopology& Get();
+
+			/**
+			 * Discover the topology of the machine.
+			 *
+			 * @return The topology.
+			 */
+			static CPUTopology Discover();
+
+			/**
+			 * Create a topology from a list of logical processors, for example to test placement. The core,
+			 * L3 domain and NUMA node indexes are made dense and the SMT indexes are assigned.
+			 *
+			 * @param processors: The logical processors. The indexes may be any unique numbers.
+			 * @return The topology.
+			 */
+			static CPUTopology Create(std::vector<LogicalProcessor> processors);
+
+			/**
+			 * Get the logical processors, ordered by index.
+			 *
+			 * @return The logical processors.
+			 */
+			const std::vector<LogicalProcessor>& GetLogicalProcessors() const { return mProcessors; }
+
+			/**
+			 * Find a logical processor by its operating system index.
+			 *
+			 * @param index: The logical processor index.
+			 * @return The logical processor pointer. nullptr if there is none.
+			 */
+			const LogicalProcessor* FindLogicalProcessor(UI32 index) const;
+
+			UI32 GetLogicalProcessorCount() const { return static_cast<UI32>(mProcessors.size()); }
+			UI32 GetCoreCount() const { return mCoreCount; }
+			UI32 GetPackageCount() const { return mPackageCount; }
+			UI32 GetL3DomainCount() const { return mL3DomainCount; }
+			UI32 GetNUMANodeCount() const { return mNUMANodeCount; }
+
+			/**
+			 * Get the operating system's id of a NUMA node. The ids can be sparse, while the node indexes of the
+			 * topology are dense, so memory policies must be given the id.
+			 *
+			 * @param nodeIndex: The NUMA node index.
+			 * @return The node id. -1 if there is no such node.
+			 */
+			I32 GetNUMANodeID(UI32 nodeIndex) const;
+
+			/**
+			 * Get the logical processors of a core, which are SMT siblings.
+			 *
+			 * @param coreIndex: The core index.
+			 * @return The CPU set.
+			 */
+			CPUSet GetCoreSet(UI32 coreIndex) const;
+
+			/**
+			 * Get the logical processors sharing a last level cache.
+			 *
+			 * @param domainIndex: The L3 domain index.
+			 * @return The CPU set.
+			 */
+			CPUSet GetL3DomainSet(UI32 domainIndex) const;
+
+			/**
+			 * Get the logical processors of a NUMA node.
+			 *
+			 * @param nodeIndex: The NUMA node index.
+			 * @return The CPU set.
+			 */
+			CPUSet GetNUMANodeSet(UI32 nodeIndex) const;
+
+			/**
+			 * Get the primary logical processor of every core, which excludes the SMT siblings.
+			 *
+			 * @return The CPU set.
+			 */
+			CPUSet GetPrimarySet() const;
+
+			/**
+			 * Get the order to place threads of a pool in.
+			 * The primary processors come first, grouped by L3 domain, so that threads get a core of their own
+			 * and neighbouring threads share a cache. The SMT siblings follow in the same order.
+			 *
+			 * @param nodeIndex: The NUMA node to place on. Default is -1, which is all the nodes.
+			 * @return The logical processor indexes.
+			 */
+			std::vector<UI32> GetPlacementOrder(I32 nodeIndex = -1) const;
+
+		private:
+			std::vector<LogicalProcessor> mProcessors;	// The logical processors.
+			UI32 mCoreCount = 0;	// Number of physical cores.
+			UI32 mPackageCount = 0;	// Number of sockets.
+			UI32 mL3DomainCount = 0;	// Number of last level cache domains.
+			UI32 mNUMANodeCount = 0;	// Number of memory nodes.
+			std::vector<UI32> mNUMANodeIDs;	// Operating system id of every memory node, by node index.
+		};
+	}
+}
@@ -4,15 +4,14 @@
 #pragma once
 
 #include "Core/Types/DataTypes.h"
+#include "Core/Macros/Global.h"
 
-#define GET_MICROSECONDS_FROM_MILLISECONDS(x)			x * 1000
-#define GET_MICROSECONDS_FROM_SECONDS(x)					x * 1000000
+#include <chrono>
 
-#define GET_MILLISECONDS_FROM_MICROSECONDS(x)			x / 1000
-#define GET_MILLISECONDS_FROM_SECONDS(x)				x * 1000
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
 
-#define GET_SECONDS_FROM_MILLISECONDS(x)				x / 1000
-#define GET_SECONDS_FROM_MICROSECONDS(x)					x / 1000000
+#endif
 
 namespace DMK
 {
@@ -20,12 +19,102 @@ namespace DMK
 	{
 		namespace Utilities
 		{
+			using Clock = std::chrono::steady_clock;	// The clock used for sleeping and pacing.
+			using TimePoint = Clock::time_point;	// A point in time of the clock.
+			using Duration = std::chrono::nanoseconds;	// Durations are stored in nanoseconds.
+
+			using Nanoseconds = std::chrono::nanoseconds;
+			using Microseconds = std::chrono::microseconds;
+			using Milliseconds = std::chrono::milliseconds;
+			using Seconds = std::chrono::seconds;
+
+			/**
+			 * How long before a deadline the sleeping functions stop sleeping and start spinning.
+			 * The operating system wakes threads late by tens of microseconds on Linux and up to a millisecond on
+			 * Windows, so the last part of a wait is spun. A larger value costs more CPU time and gives less jitter.
+			 */
+			constexpr Duration DefaultSpinThreshold = Microseconds(200);
+
+			/**
+			 * Convert a duration to fractional seconds.
+			 *
+			 * @param duration: The duration.
+			 * @return The seconds.
+			 */
+			template<class Representation, class Period>
+			constexpr double ToSeconds(std::chrono::duration<Representation, Period> duration)
+			{
+				return std::chrono::duration<double>(duration).count();
+			}
+
+			/**
+			 * Convert a duration to fractional milliseconds.
+			 *
+			 * @param duration: The duration.
+			 * @return The milliseconds.
+			 */
+			template<class Representation, class Period>
+			constexpr double ToMilliseconds(std::chrono::duration<Representation, Period> duration)
+			{
+				return std::chrono::duration<double, std::milli>(duration).count();
+			}
+
+			/**
+			 * Convert a duration to fractional microseconds.
+			 *
+			 * @param duration: The duration.
+			 * @return The microseconds.
+			 */
+			template<class Representation, class Period>
+			constexpr double ToMicroseconds(std::chrono::duration<Representation, Period> duration)
+			{
+				return std::chrono::duration<double, std::micro>(duration).count();
+			}
+
+			/**
+			 * Get the duration of one period of a frequency.
+			 *
+			 * @param frequency: The frequency in hertz. Must be greater than 0.
+			 * @return The period.
+			 */
+			constexpr Duration GetPeriod(double frequency)
+			{
+				return Duration(static_cast<Duration::rep>(1e9 / frequency + 0.5));
+			}
+
+			/**
+			 * Sleep the thread until a deadline.
+			 * The thread sleeps until the spin threshold before the deadline using an absolute timer
+			 * (clock_nanosleep() with TIMER_ABSTIME on Linux, a high resolution waitable timer on Windows), so time
+			 * spent before the call does not add up, and spins for the rest.
+			 *
+			 * @param deadline: The time to wake up at.
+			 * @param spinThreshold: How long to spin before the deadline. Default is DefaultSpinThreshold.
+			 */
+			void SleepUntil(TimePoint deadline, Duration spinThreshold = DefaultSpinThreshold);
+
 			/**
 			 * Sleep the thread for a specific duration.
 			 *
-			 * @param duration: The duration in microseconds.
+			 * @param duration: The duration. Any std::chrono duration converts to it, for example Milliseconds(5).
+			 * @param spinThreshold: How long to spin before waking up. Default is DefaultSpinThreshold.
 			 */
-			void Sleep(UI64 duration);
+			void Sleep(Duration duration, Duration spinThreshold = DefaultSpinThreshold);
+
+			/**
+			 * Tell the CPU that the thread is spin waiting.
+			 * This saves power and frees execution resources for the sibling hyper thread.
+			 */
+			DMK_FORCEINLINE void Pause()
+			{
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+				_mm_pause();
+
+#elif defined(__aarch64__)
+				asm volatile("yield");
+
+#endif
+			}
 		}
 	}
-}
\ No newline at end of file
+}
@@ -4,6 +4,7 @@
 #include "VulkanBackend/VulkanInstance.h"
 #include "VulkanBackend/Macros.h"
 #include "Core/ErrorHandler/Logger.h"
+#include "Core/ErrorHandler/BinaryLogger.h"
 #include "Core/Types/Utilities.h"
 
 #include "VulkanBackend/VulkanDisplay.h"
@@ -109,6 +110,28 @@ namespace DMK
 				const VkDebugUtilsMessengerCallbackDataEXT* pCallbackData,
 				void* pUserData)
 			{
+				// Validation messages can be very frequent. When binary logging is enabled, only the raw message is
+				// copied and the text is built offline.
+				if (BinaryLogger::IsOpen())
+				{
+					switch (messageSeverity) {
+					case VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT:
+						DMK_BINARY_LOG_DEBUG("Vulkan Validation Layer (type: {}): {}", messageType, pCallbackData->pMessage);
+						break;
+					case VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT:
+						DMK_BINARY_LOG_INFO("Vulkan Validation Layer (type: {}): {}", messageType, pCallbackData->pMessage);
+						break;
+					case VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT:
+						DMK_BINARY_LOG_WARN("Vulkan Validation Layer (type: {}): {}", messageType, pCallbackData->pMessage);
+						break;
+					default:
+						DMK_BINARY_LOG_ERROR("Vulkan Validation Layer (type: {}): {}", messageType, pCallbackData->pMessage);
+						break;
+					}
+
+					return VK_FALSE;
+				}
+
 				WString myMessageStatement = TEXT("Vulkan Validation Layer ");
 				WString myMessagePreStatement = TEXT(": ");
 
@@ -4,146 +4,148 @@
 #include "XAudio2Backend/XAudio2BackendFunction.h"
 #include "XAudio2Backend/XAudio2Instance.h"
 
-#include "AudioCore/Commands/CoreCommands.h"
-#include "AudioCore/Commands/AudioObjectCommands.h"
-#include "AudioCore/Commands/PlaybackCommands.h"
+#include "AudioCore/Commands/CommandRegistry.h"
+#include "Thread/Commands/CommandDispatcher.h"
+
+#include "Core/Benchmark/LatencyRecorder.h"
+#include "Core/Benchmark/Profiler.h"
 
 namespace DMK
 {
 	namespace XAudio2Backend
 	{
+		namespace _Helpers
+		{
+			/**
+			 * XAudio2 command handler.
+			 * Contains a handler for every command of the audio command registry.
+			 */
+			struct XAudio2CommandHandler {
+				XAudio2CommandHandler(XAudio2Instance& instance) : mInstance(instance) {}
+
+				/**
+				 * Initialize the instance.
+				 */
+				bool operator()(Thread::Command<AudioCore::Commands::InitializeBackend>& command)
+				{
+					mInstance.Initialize(command->enableDebugging);
+					return true;
+				}
+
+				/**
+				 * Terminate the instance and stop the backend thread.
+				 */
+				bool operator()(Thread::Command<AudioCore::Commands::TerminateBackend>& command)
+				{
+					mInstance.Terminate();
+					bShouldRun = false;
+					return true;
+				}
+
+				/**
+				 * Load audio data from a file.
+				 */
+				bool operator()(Thread::Command<AudioCore::Commands::LoadAudioFromFile>& command)
+				{
+					// Check and execute if an asset path is set.
+					if (!command->pAsset)
+						return false;
+
+					// Check and asign data to the pHandle and the future after loading the data.
+					const AudioCore::AudioObjectHandle handle = mInstance.CreateAudioObject(command->pAsset);
+					if (command->pHandle)
+						*command->pHandle = handle;
+
+					command.SetResult(handle);
+					return true;
+				}
+
+				/**
+				 * Get the cache of an audio object.
+				 */
+				bool operator()(Thread::Command<AudioCore::Commands::GetAudioObjectCache>& command)
+				{
+					// Check and complete if the cache pointer or the future is valid.
+					if (!command->pCache && !command.pCompletion)
+						return false;
+
+					const AudioCore::AudioObjectCache cache = mInstance.GetAudioCache(command->mHandle);
+					if (command->pCache)
+						*command->pCache = cache;
+
+					command.SetResult(cache);
+					return true;
+				}
+
+				/**
+				 * Play an audio file directly.
+				 */
+				bool operator()(Thread::Command<AudioCore::Commands::DirectPlayback>& command)
+				{
+					// Check and complete if the asset path is valid.
+					if (!command->pAsset)
+						return false;
+
+					// Play the audio track.
+					mInstance.PlayLoop(command->pAsset, command->loopCount);
+					return true;
+				}
+
+				/**
+				 * Play a buffered audio object.
+				 */
+				bool operator()(Thread::Command<AudioCore::Commands::BufferedPlayback>& command)
+				{
+					// Play if the cache is specified. Play using the handle if not.
+					if (command->mCache)
+						mInstance.PlayLoop(command->mCache, command->loopCount);
+					else
+						mInstance.PlayLoop(command->mHandle, command->loopCount);
+
+					return true;
+				}
+
+				XAudio2Instance& mInstance;	// The backend instance.
+				bool bShouldRun = true;	// Main loop state.
+			};
+		}
+
 		void XAudio2BackendFunction(Thread::CommandQueue<THREAD_MAX_COMMAND_COUNT>* pCommandQueue)
 		{
+			// Name the thread for the profilers.
+			DMK_PROFILE_THREAD("XAudio2 Backend");
+
 			// Create the instance object.
 			XAudio2Instance mInstance = {};
 
-			// Main loop state.
-			bool bShouldRun = true;
+			// Create the command handler.
+			_Helpers::XAudio2CommandHandler mHandler(mInstance);
+
+			// Time taken to execute a command.
+			Benchmark::LatencyRecorder& mCommandLatency = Benchmark::Metrics::GetLatencyRecorder("Audio.CommandExecution");
 
 			// Main execution loop.
 			do {
-				// Check if a command is present.
-				if (pCommandQueue->Count())
+				// Wait till a command is present. The thread parks while the queue is idle.
+				if (pCommandQueue->WaitForCommand())
 				{
-					// Get the first command.
-					auto pCommand = pCommandQueue->GetAndPop();
-					SET_COMMAND_PENDING(pCommand);
-
-					// Check if the command is to initialize the backend.
-					if (TYPE_NAME(AudioCore::Commands::InitializeBackend) == pCommand->GetCommandName())
-					{
-						SET_COMMAND_EXECUTING(pCommand);
-
-						// Initialize the instance.
-						mInstance.Initialize(pCommand->GetData<AudioCore::Commands::InitializeBackend>().enableDebugging);
-						SET_COMMAND_SUCCESS(pCommand);
-
-						DELETE_COMMAND(pCommand, AudioCore::Commands::InitializeBackend);
-					}
-
-					// Check if the command is to terminate the backend.
-					else if (TYPE_NAME(AudioCore::Commands::TerminateBackend) == pCommand->GetCommandName())
-					{
-						SET_COMMAND_EXECUTING(pCommand);
-
-						// Terminate the instance.
-						mInstance.Terminate();
-						SET_COMMAND_SUCCESS(pCommand);
-
-						DELETE_COMMAND(pCommand, AudioCore::Commands::TerminateBackend);
-
-						bShouldRun = false;
-					}
-
-					// Check if the command is to load audio data from a file.
-					else if (TYPE_NAME(AudioCore::Commands::LoadAudioFromFile) == pCommand->GetCommandName())
-					{
-						SET_COMMAND_EXECUTING(pCommand);
-
-						// Get the actual command.
-						auto& mCommand = pCommand->GetData<AudioCore::Commands::LoadAudioFromFile>();
-
-						// Check and execute if an asset path is set.
-						if (mCommand.pAsset)
-						{
-							// Check and asign data to the pHandle after loading the data.
-							if (mCommand.pHandle)
-								*mCommand.pHandle = mInstance.CreateAudioObject(mCommand.pAsset);
-							else
-								mInstance.CreateAudioObject(mCommand.pAsset);
-
-							SET_COMMAND_SUCCESS(pCommand);
-
-							DELETE_COMMAND(pCommand, AudioCore::Commands::LoadAudioFromFile);
-						}
-					}
-
-					// Check if the command is to get audio object cache.
-					else if (TYPE_NAME(AudioCore::Commands::GetAudioObjectCache) == pCommand->GetCommandName())
-					{
-						SET_COMMAND_EXECUTING(pCommand);
-
-						// Get the actual command.
-						auto& mCommand = pCommand->GetData<AudioCore::Commands::GetAudioObjectCache>();
-
-						// Check and complete if the cache pointer is valid.
-						if (mCommand.pCache)
-						{
-							*mCommand.pCache = mInstance.GetAudioCache(mCommand.mHandle);
-							SET_COMMAND_SUCCESS(pCommand);
-
-							DELETE_COMMAND(pCommand, AudioCore::Commands::GetAudioObjectCache);
-						}
-					}
-
-					// Check if the command is for direct playback.
-					else if (TYPE_NAME(AudioCore::Commands::DirectPlayback) == pCommand->GetCommandName())
-					{
-						SET_COMMAND_EXECUTING(pCommand);
-
-						// Get the actual command.
-						auto& mCommand = pCommand->GetData<AudioCore::Commands::DirectPlayback>();
-
-						// Check and complete if the cache pointer is valid.
-						if (mCommand.pAsset)
-						{
-							// Play the audio track.
-							mInstance.PlayLoop(mCommand.pAsset, mCommand.loopCount);
-							SET_COMMAND_SUCCESS(pCommand);
-
-							DELETE_COMMAND(pCommand, AudioCore::Commands::GetAudioObjectCache);
-						}
-					}
-
-					// Check if the command is for buffered playback.
-					else if (TYPE_NAME(AudioCore::Commands::BufferedPlayback) == pCommand->GetCommandName())
-					{
-						SET_COMMAND_EXECUTING(pCommand);
-
-						// Get the actual command.
-						auto& mCommand = pCommand->GetData<AudioCore::Commands::BufferedPlayback>();
-
-						// Play if the cache is specified. Play using the handle if not.
-						if (mCommand.mCache)
-							mInstance.PlayLoop(mCommand.mCache, mCommand.loopCount);
-						else
-							mInstance.PlayLoop(mCommand.mHandle, mCommand.loopCount);
-
-						SET_COMMAND_SUCCESS(pCommand);
-
-						DELETE_COMMAND(pCommand, AudioCore::Commands::BufferedPlayback);
-					}
-
-					// If execution failed.
-					if (pCommand)
-					{
-						SET_COMMAND_FAILED(pCommand);
-
-						// Delete the command.
-						delete pCommand;
-					}
+					// Get the first command. It stays in the queue till it is popped.
+					auto pCommand = pCommandQueue->GetCommand();
+					SET_COMMAND_EXECUTING(pCommand);
+
+					Benchmark::LatencyScope _latencyScope(mCommandLatency);
+
+					// Mark the command for the profiler and the external profilers.
+					DMK_PROFILE_ZONE("Audio.Command");
+					DMK_MARKER_COMMAND(pCommand->GetCommandID(), pCommand->GetCommandName());
+
+					// Dispatch the command through the jump table and report the result.
+					pCommand->SetState(Thread::CommandDispatcher<AudioCore::Commands::AudioCommandRegistry>::Dispatch(mHandler, pCommand));
+
+					// Destroy the command and free its slot.
+					pCommandQueue->PopCommand();
 				}
-			} while (bShouldRun);
+			} while (mHandler.bShouldRun);
 		}
 	}
-}
\ No newline at end of file
+}
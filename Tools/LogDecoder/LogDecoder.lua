@@ -0,0 +1,27 @@
+-- Copyright 2020 Dhiraj Wishal
+-- SPDX-License-Identifier: Apache-2.0
+
+---------- LogDecoder project description ----------
+
+project "LogDecoder"
+	kind "ConsoleApp"
+	language "C++"
+	systemversion "latest"
+	cppdialect "C++17"
+	staticruntime "On"
+
+	targetdir "$(SolutionDir)Builds/Tools/Binaries/$(Configuration)-$(Platform)"
+	objdir "$(SolutionDir)Builds/Tools/Intermediate/$(Configuration)-$(Platform)/$(ProjectName)"
+
+	files {
+		"**.txt",
+		"**.cpp",
+		"**.h",
+		"**.lua",
+		"**.txt",
+		"**.md",
+	}
+
+	includedirs {
+		"$(SolutionDir)Framework/",
+	}
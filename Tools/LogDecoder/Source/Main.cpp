@@ -0,0 +1,392 @@
+// Copyright 2020 Dhiraj Wishal
+// SPDX-License-Identifier: Apache-2.0
+
+/**
+ * Log Decoder.
+ * This tool converts a binary log file written by DMK::BinaryLogger to text.
+ *
+ * Usage: LogDecoder <binary log file> [output file]
+ * The text is written to the console if no output file is given.
+ */
+
+#include "Core/ErrorHandler/BinaryLogger.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iterator>
+#include <unordered_map>
+
+using namespace DMK;
+
+namespace _Helpers
+{
+	const char* SEVERITY_NAMES[5] = {
+		"INFO-> ",
+		"WARN-> ",
+		"ERROR-> ",
+		"FATAL-> ",
+		"DEBUG-> ",
+	};
+
+	/**
+	 * Decoded format structure.
+	 */
+	struct Format {
+		std::vector<BinaryLogger::ArgumentType> mArgumentTypes;
+		String mFile;
+		String mFormat;
+		UI32 mLine = 0;
+		UI8 mSeverity = 0;
+	};
+
+	/**
+	 * Decoded record structure.
+	 */
+	struct Record {
+		UI64 mTimeStamp = 0;	// Nanoseconds since the session started.
+		UI64 mThreadIndex = 0;
+		UI8 mSeverity = 0;
+		String mText;
+	};
+
+	/**
+	 * Binary log reader object.
+	 */
+	class Reader {
+	public:
+		Reader(const UI8* pBegin, const UI8* pEnd) : pCurrent(pBegin), pEnd(pEnd) {}
+
+		bool ReadByte(UI8& value)
+		{
+			if (pCurrent >= pEnd)
+				return false;
+
+			value = *pCurrent++;
+			return true;
+		}
+
+		bool ReadVarInt(UI64& value)
+		{
+			pCurrent = BinaryLogger::ReadVarInt(pCurrent, pEnd, value);
+			return pCurrent != nullptr;
+		}
+
+		bool ReadBytes(void* pData, UI64 size)
+		{
+			if (static_cast<UI64>(pEnd - pCurrent) < size)
+				return false;
+
+			memcpy(pData, pCurrent, size);
+			pCurrent += size;
+			return true;
+		}
+
+		bool ReadString(String& string)
+		{
+			UI64 length = 0;
+			if (!ReadVarInt(length) || static_cast<UI64>(pEnd - pCurrent) < length)
+				return false;
+
+			string.assign(reinterpret_cast<const char*>(pCurrent), length);
+			pCurrent += length;
+			return true;
+		}
+
+		void Skip(UI64 size) { pCurrent += size; }
+
+		bool IsEnd() const { return pCurrent >= pEnd; }
+		const UI8* GetCurrent() const { return pCurrent; }
+		UI64 GetRemaining() const { return static_cast<UI64>(pEnd - pCurrent); }
+
+	private:
+		const UI8* pCurrent = nullptr;
+		const UI8* pEnd = nullptr;
+	};
+
+	/**
+	 * Decode a single argument and append it to a string.
+	 *
+	 * @param reader: The reader.
+	 * @param type: The argument type.
+	 * @param text: The string to append to.
+	 * @return False if the data is corrupted.
+	 */
+	bool DecodeArgument(Reader& reader, BinaryLogger::ArgumentType type, String& text)
+	{
+		char buffer[64] = {};
+		UI64 value = 0;
+
+		switch (type)
+		{
+		case BinaryLogger::ArgumentType::UNSIGNED:
+			if (!reader.ReadVarInt(value))
+				return false;
+
+			snprintf(buffer, sizeof(buffer), "%llu", value);
+			break;
+
+		case BinaryLogger::ArgumentType::SIGNED:
+			if (!reader.ReadVarInt(value))
+				return false;
+
+			snprintf(buffer, sizeof(buffer), "%lld", BinaryLogger::ZigZagDecode(value));
+			break;
+
+		case BinaryLogger::ArgumentType::POINTER:
+			if (!reader.ReadVarInt(value))
+				return false;
+
+			snprintf(buffer, sizeof(buffer), "0x%016llx", value);
+			break;
+
+		case BinaryLogger::ArgumentType::FLOAT:
+		{
+			double number = 0.0;
+			if (!reader.ReadBytes(&number, sizeof(double)))
+				return false;
+
+			snprintf(buffer, sizeof(buffer), "%g", number);
+			break;
+		}
+
+		case BinaryLogger::ArgumentType::BOOLEAN:
+		{
+			UI8 boolean = 0;
+			if (!reader.ReadByte(boolean))
+				return false;
+
+			text.append(boolean ? "true" : "false");
+			return true;
+		}
+
+		case BinaryLogger::ArgumentType::STRING:
+		{
+			String string;
+			if (!reader.ReadString(string))
+				return false;
+
+			text.append(string);
+			return true;
+		}
+
+		default:
+			return false;
+		}
+
+		text.append(buffer);
+		return true;
+	}
+
+	/**
+	 * Decode the arguments of a record and substitute them to the format string.
+	 *
+	 * @param reader: The reader.
+	 * @param format: The record format.
+	 * @param text: The string to store the text in.
+	 * @return False if the data is corrupted.
+	 */
+	bool DecodeRecord(Reader& reader, const Format& format, String& text)
+	{
+		UI64 argumentIndex = 0;
+		for (UI64 index = 0; index < format.mFormat.size(); index++)
+		{
+			if (format.mFormat[index] == '{' && index + 1 < format.mFormat.size() && format.mFormat[index + 1] == '}' && argumentIndex < format.mArgumentTypes.size())
+			{
+				if (!DecodeArgument(reader, format.mArgumentTypes[argumentIndex++], text))
+					return false;
+
+				index++;
+			}
+			else
+				text.push_back(format.mFormat[index]);
+		}
+
+		// Arguments without a placeholder are appended to the end.
+		for (; argumentIndex < format.mArgumentTypes.size(); argumentIndex++)
+		{
+			text.push_back(' ');
+			if (!DecodeArgument(reader, format.mArgumentTypes[argumentIndex], text))
+				return false;
+		}
+
+		return true;
+	}
+
+	/**
+	 * Decode a binary log file.
+	 *
+	 * @param bytes: The file contents.
+	 * @param records: The vector to store the records in.
+	 * @param startTime: The variable to store the session start time (microseconds since epoch) in.
+	 * @return False if the file is not a binary log file. Corrupted data at the end is ignored.
+	 */
+	bool Decode(const std::vector<UI8>& bytes, std::vector<Record>& records, UI64& startTime)
+	{
+		Reader reader(bytes.data(), bytes.data() + bytes.size());
+
+		char magic[8] = {};
+		UI32 version = 0;
+		if (!reader.ReadBytes(magic, sizeof(magic)) || memcmp(magic, BinaryLogger::FileMagic, sizeof(magic)) != 0)
+			return false;
+
+		if (!reader.ReadBytes(&version, sizeof(version)) || version != BinaryLogger::FileVersion)
+			return false;
+
+		if (!reader.ReadBytes(&startTime, sizeof(startTime)))
+			return false;
+
+		std::unordered_map<UI64, Format> formats;
+		std::unordered_map<UI64, UI64> lastTimeStamps;
+		UI64 lastTimeStamp = 0;
+
+		while (!reader.IsEnd())
+		{
+			UI8 blockType = 0;
+			reader.ReadByte(blockType);
+
+			if (blockType == static_cast<UI8>(BinaryLogger::BlockType::FORMAT))
+			{
+				UI64 formatID = 0, line = 0;
+				UI8 argumentCount = 0;
+				Format format;
+
+				if (!reader.ReadVarInt(formatID) || !reader.ReadByte(format.mSeverity) || !reader.ReadVarInt(line) || !reader.ReadByte(argumentCount))
+					return true;
+
+				format.mArgumentTypes.resize(argumentCount);
+				if (!reader.ReadBytes(format.mArgumentTypes.data(), argumentCount) || !reader.ReadString(format.mFile) || !reader.ReadString(format.mFormat))
+					return true;
+
+				format.mLine = static_cast<UI32>(line);
+				formats[formatID] = std::move(format);
+			}
+			else if (blockType == static_cast<UI8>(BinaryLogger::BlockType::DATA))
+			{
+				UI64 threadIndex = 0, size = 0;
+				if (!reader.ReadVarInt(threadIndex) || !reader.ReadVarInt(size) || reader.GetRemaining() < size)
+					return true;
+
+				Reader dataReader(reader.GetCurrent(), reader.GetCurrent() + size);
+				reader.Skip(size);
+
+				UI64& timeStamp = lastTimeStamps[threadIndex];
+				while (!dataReader.IsEnd())
+				{
+					UI64 formatID = 0, delta = 0;
+					if (!dataReader.ReadVarInt(formatID) || !dataReader.ReadVarInt(delta))
+						return true;
+
+					auto format = formats.find(formatID);
+					if (format == formats.end())
+						return true;
+
+					timeStamp += delta;
+
+					Record record;
+					record.mTimeStamp = timeStamp;
+					record.mThreadIndex = threadIndex;
+					record.mSeverity = format->second.mSeverity;
+					if (!DecodeRecord(dataReader, format->second, record.mText))
+						return true;
+
+					record.mText.append(" (").append(format->second.mFile).append(":").append(std::to_string(format->second.mLine)).append(")");
+					records.push_back(std::move(record));
+
+					lastTimeStamp = std::max(lastTimeStamp, timeStamp);
+				}
+			}
+			else if (blockType == static_cast<UI8>(BinaryLogger::BlockType::DROPPED))
+			{
+				UI64 count = 0;
+				if (!reader.ReadVarInt(count))
+					return true;
+
+				Record record;
+				record.mTimeStamp = lastTimeStamp;
+				record.mThreadIndex = 0;
+				record.mSeverity = 1;
+				record.mText = std::to_string(count) + " record(s) were dropped because a log buffer was full.";
+				records.push_back(std::move(record));
+			}
+			else
+				return true;
+		}
+
+		return true;
+	}
+
+	/**
+	 * Write the decoded records as text.
+	 *
+	 * @param pOutput: The output stream.
+	 * @param records: The records.
+	 * @param startTime: The session start time in microseconds since epoch.
+	 */
+	void Print(FILE* pOutput, const std::vector<Record>& records, UI64 startTime)
+	{
+		for (const auto& record : records)
+		{
+			const UI64 time = startTime + record.mTimeStamp / 1000;
+			const time_t seconds = static_cast<time_t>(time / 1000000);
+			tm localTime = {};
+
+#ifdef _MSC_VER
+			localtime_s(&localTime, &seconds);
+
+#else
+			localtime_r(&seconds, &localTime);
+
+#endif
+
+			char timeBuffer[16] = {};
+			strftime(timeBuffer, sizeof(timeBuffer), "%H:%M:%S", &localTime);
+
+			fprintf(pOutput, "[%s.%06llu] [T%llu] %s%s\n", timeBuffer, time % 1000000, record.mThreadIndex, SEVERITY_NAMES[record.mSeverity < 5 ? record.mSeverity : 0], record.mText.c_str());
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		fprintf(stderr, "Usage: %s <binary log file> [output file]\n", argv[0]);
+		return 1;
+	}
+
+	std::ifstream inputFile(argv[1], std::ios::binary);
+	if (!inputFile.is_open())
+	{
+		fprintf(stderr, "Failed to open %s!\n", argv[1]);
+		return 1;
+	}
+
+	const std::vector<UI8> bytes((std::istreambuf_iterator<char>(inputFile)), std::istreambuf_iterator<char>());
+
+	std::vector<_Helpers::Record> records;
+	UI64 startTime = 0;
+	if (!_Helpers::Decode(bytes, records, startTime))
+	{
+		fprintf(stderr, "%s is not a binary log file!\n", argv[1]);
+		return 1;
+	}
+
+	// Each thread's records are in order. Merge the threads by time.
+	std::stable_sort(records.begin(), records.end(), [](const _Helpers::Record& lhs, const _Helpers::Record& rhs) { return lhs.mTimeStamp < rhs.mTimeStamp; });
+
+	FILE* pOutput = argc > 2 ? fopen(argv[2], "w") : stdout;
+	if (!pOutput)
+	{
+		fprintf(stderr, "Failed to open %s!\n", argv[2]);
+		return 1;
+	}
+
+	_Helpers::Print(pOutput, records, startTime);
+
+	if (pOutput != stdout)
+		fclose(pOutput);
+
+	return 0;
+}
@@ -1,6 +1,17 @@
 -- Copyright 2020 Dhiraj Wishal
 -- SPDX-License-Identifier: Apache-2.0
 
+-- External profiler markers. See Framework/Core/Benchmark/ExternalMarkers.h.
+newoption {
+	trigger = "with-itt",
+	description = "Emit Intel ITT markers for VTune (requires the VTune SDK)"
+}
+
+newoption {
+	trigger = "with-usdt",
+	description = "Emit USDT probes for perf and bpftrace on Linux (requires sys/sdt.h)"
+}
+
 workspace "Dynamik"
 	architecture "x64"
 
@@ -35,6 +46,20 @@ workspace "Dynamik"
 		defines { "DMK_DISTRIBUTION" }
 		optimize "On"
 
+	filter "options:with-itt"
+		defines { "DMK_ENABLE_ITT" }
+		includedirs { "%{IncludeDir.ITT}" }
+		libdirs { "%{IncludeLib.ITT}" }
+
+	filter { "options:with-itt", "system:windows" }
+		links { "libittnotify" }
+
+	filter { "options:with-itt", "system:linux" }
+		links { "ittnotify", "dl" }
+
+	filter { "options:with-usdt", "system:linux" }
+		defines { "DMK_ENABLE_USDT" }
+
 
 -- Libraries
 IncludeDir = {}
@@ -50,6 +75,7 @@ IncludeDir["glslang"] = "$(SolutionDir)Dependencies/ThirdParty/glslang/"
 IncludeDir["FreeImage"] = "$(SolutionDir)Dependencies/ThirdParty/FreeImage/Include"
 IncludeDir["SDL2"] = "$(SolutionDir)Dependencies/ThirdParty/SDL2-2.0.12/include"
 IncludeDir["xxhash"] = "$(SolutionDir)Dependencies/ThirdParty/xxhash/include"
+IncludeDir["ITT"] = (os.getenv("VTUNE_PROFILER_2020_DIR") or "/opt/intel/vtune_profiler") .. "/sdk/include"
 
 IncludeDir["boost"] = "E:/Dynamik/Libraries/boost_1_70_0"
 IncludeDir["jpeg"] = "$(SolutionDir)Dependencies/ThirdParty/gil/jpeg-6b"
@@ -68,6 +94,7 @@ IncludeLib["Assimp"] = "$(SolutionDir)Dependencies/ThirdParty/Binaries/Assimp"
 IncludeLib["SPIRVTools"] = "$(SolutionDir)Dependencies/ThirdParty/Binaries/SPIRV-Tools/"
 IncludeLib["SDL2"] = "$(SolutionDir)Dependencies/ThirdParty/Binaries/SDL2-2.0.12/bin/x64/"
 IncludeLib["xxhash"] = "$(SolutionDir)Dependencies/ThirdParty/Binaries/xxhash/lib/"
+IncludeLib["ITT"] = (os.getenv("VTUNE_PROFILER_2020_DIR") or "/opt/intel/vtune_profiler") .. "/sdk/lib64"
 
 IncludeLib["zlib"] = ""	-- TODO
 IncludeLib["glslang"] = "$(SolutionDir)Dependencies/ThirdParty/Binaries/glslang/"
@@ -83,6 +110,7 @@ include "Framework/Graphics/Graphics.lua"
 include "Framework/GraphicsCore/GraphicsCore.lua"
 include "Framework/Inputs/Inputs.lua"
 include "Framework/Intellect/Intellect.lua"
+include "Framework/NullBackend/NullBackend.lua"
 include "Framework/ShaderTools/ShaderTools.lua"
 include "Framework/Thread/Thread.lua"
 include "Framework/VulkanBackend/VulkanBackend.lua"
@@ -90,6 +118,12 @@ include "Framework/XAudio2Backend/XAudio2Backend.lua"
 
 group "Demos"
 
+group "Tools"
+include "Tools/LogDecoder/LogDecoder.lua"
+
+group "Benchmarks"
+include "Benchmarks/Benchmarks.lua"
+
 group "Third Party"
 include "Dependencies/ThirdParty/SPIRV-Cross/SPIRV-Cross.lua"
 --include "Dependencies/ThirdParty/imgui/imgui.lua"